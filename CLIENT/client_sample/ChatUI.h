@@ -8,22 +8,22 @@ class ChatUI {
 public:
     ChatUI(sf::Font& font, unsigned int charSize = 16, std::size_t maxLines = 10);
 
-    // ڰ Ű Է  ȣ
+    // 사용자가 키 입력할 때 호출
     void handleTextEntered(sf::Uint32 unicode);
     void handleKeyPressed(const sf::Event::KeyEvent& key);
 
-    // Ʈũ SC_CHAT_PACKET ޾  ȣ
+    // 네트워크에서 SC_CHAT_PACKET을 받았을 때 호출
     void addMessage(int senderId, const std::string& text);
 
-    //   ׸
+    // 매 프레임 그리기
     void draw(sf::RenderWindow& window);
 
-    //  Ŷ  Լ (Enter Է )
+    // 보낼 패킷을 꺼내는 함수 (Enter 입력 시)
     bool popOutgoing(std::vector<char>& outPacket);
 
     void processChar(char32_t c)
     {
-        // 1)  ۿ ִ ѱ/  
+        // 1) 현재 버퍼에 있는 한글/영문 개수 세기
         std::size_t hangulCount = 0, engCount = 0;
         for (char32_t ch : _inputBuffer32) {
             if (isHangul(ch))        ++hangulCount;
@@ -34,15 +34,15 @@ public:
             }
         }
 
-        // 2)     ִġ ˻
+        // 2) 들어올 문자의 종류에 따라 최대치 검사
         if (isHangul(c)) {
             if (hangulCount >= MAX_HAN_INPUT)
-                return;  // ѱ ѵ ʰ
+                return;  // 한글 한도 초과
         }
 
         else if (isEnglish(c)) {
             if (engCount >= MAX_ENG_INPUT)
-                return;  //  ѵ ʰ
+                return;  // 영문 한도 초과
         }
 
         else {
@@ -53,7 +53,7 @@ public:
         _inputBuffer32.push_back(c);
     }
 
-    // IME  ڿ Ʈ
+    // IME 조합 문자열 업데이트
     void setComposition(const std::u32string& comp)
     {
         if (_inInput) {
@@ -61,7 +61,7 @@ public:
         }
     }
 
-    // IME Ȯ ڿ Ŀ
+    // IME 확정 문자열 커밋
     void commitComposition(const std::u32string& result32)
     {
         if (!_inInput) return;
@@ -96,15 +96,15 @@ private:
     float _caretHeightRatio = 1.0f;
 
 private:
-    //  ť  CS_CHAT_PACKET ȭ Ʈ
+    // 내부 큐에 저장된 CS_CHAT_PACKET 직렬화 바이트열
     std::vector<std::vector<char>> _outgoingPackets;
 
-    // Ŷ ȭ  ( PacketFactory::Serialize)
+    // 패킷 직렬화 헬퍼 (가령 PacketFactory::Serialize)
     std::vector<char> makeChatPacket(const std::string& msg);
 
     static bool isHangul(char32_t c)
     {
-        return (c >= 0xAC00 && c <= 0xD7A3)  // ϼ ѱ
+        return (c >= 0xAC00 && c <= 0xD7A3)  // 완성된 한글
             or (c >= 0x1100 && c <= 0x11FF)  // Hangul Jamo
             or (c >= 0x3130 && c <= 0x318F)  // Hangul Compatibility Jamo
             or (c >= 0xA960 && c <= 0xA97F)  // Hangul Jamo Extended-A
@@ -118,29 +118,29 @@ private:
 
 
 public:
-    // UTF-32  UTF-8 
+    // UTF-32 → UTF-8 구현
     static std::string utf32_to_utf8(const std::u32string& src) {
         std::string out;
-        out.reserve(src.size() * 3); // ѱ  Ƶ 뷫 3Ʈ 
+        out.reserve(src.size() * 3); // 한글 쪽이 많아도 대략 3바이트 예상
 
         for (char32_t c : src) {
             if (c < 0x80) {
-                // 1Ʈ (ASCII)
+                // 1바이트 (ASCII)
                 out.push_back(static_cast<char>(c));
             }
             else if (c < 0x800) {
-                // 2Ʈ
+                // 2바이트
                 out.push_back(static_cast<char>(0xC0 | (c >> 6)));
                 out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
             }
             else if (c < 0x10000) {
-                // 3Ʈ (ѱ  )
+                // 3바이트 (한글 음절 포함)
                 out.push_back(static_cast<char>(0xE0 | (c >> 12)));
                 out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
                 out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
             }
             else {
-                // 4Ʈ ( )
+                // 4바이트 (보충 평면)
                 out.push_back(static_cast<char>(0xF0 | (c >> 18)));
                 out.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
                 out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
@@ -151,7 +151,7 @@ public:
         return out;
     }
 
-    // UTF-8  UTF-32 ȯ 
+    // UTF-8 → UTF-32 변환 헬퍼
     static std::u32string utf8_to_utf32(const std::string & utf8) {
         std::u32string out;
         size_t i = 0, len = utf8.size();
@@ -171,7 +171,7 @@ public:
          return out;
     }
 
-    // u32string  sf::String (Uint32 ) ȯ 
+    // u32string → sf::String (Uint32 기반) 변환 헬퍼
     static sf::String utf32_to_sf(const std::u32string & src) {
         sf::String out;
         for (char32_t c : src)
@@ -180,7 +180,7 @@ public:
         return out;
     }
 
-    // helper: UTF-16(WCHAR)  UTF-32 ȯ
+    // helper: UTF-16(WCHAR) → UTF-32 변환
     static std::u32string wstr_to_u32(const std::wstring& ws) {
         std::u32string out;
         out.reserve(ws.size());
@@ -189,17 +189,17 @@ public:
         return out;
     }
 
-    // UTF-32 ڵƮ UTF-16(wchar_t) ȯ
+    // UTF-32 코드포인트를 UTF-16(wchar_t)으로 변환
     static std::wstring utf32_to_utf16(const std::u32string& src) {
         std::wstring out;
         out.reserve(src.size());
         for (char32_t c : src) {
             if (c <= 0xFFFF) {
-                // BMP 
+                // BMP 영역
                 out.push_back(static_cast<wchar_t>(c));
             }
             else {
-                // supplementary plane: Ʈ  
+                // supplementary plane: 서러게이트 페어 생성
                 char32_t cp = c - 0x10000;
                 wchar_t high = static_cast<wchar_t>((cp >> 10) + 0xD800);
                 wchar_t low = static_cast<wchar_t>((cp & 0x3FF) + 0xDC00);
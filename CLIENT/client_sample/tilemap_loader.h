@@ -17,7 +17,7 @@ inline std::vector<std::vector<int>> load_tilemap(const std::string& filename)
 {
     std::ifstream file(filename);
     if (!file.is_open()) {
-        std::cerr << "  : " << filename << '\n';
+        std::cerr << "파일 열기 실패: " << filename << '\n';
         std::exit(EXIT_FAILURE);
     }
 
@@ -26,14 +26,14 @@ inline std::vector<std::vector<int>> load_tilemap(const std::string& filename)
     std::string_view view{ json };
     auto data_pos = view.find("\"data\": [");
     if (data_pos == std::string_view::npos) {
-        std::cerr << "data 迭 ã  ϴ.\n";
+        std::cerr << "data 배열을 찾을 수 없습니다.\n";
         std::exit(EXIT_FAILURE);
     }
 
-    data_pos += 8; // "data":[  
+    data_pos += 8; // "data":[ 의 길이
     auto data_end = view.find("]", data_pos);
     if (data_end == std::string_view::npos) {
-        std::cerr << "data 迭 Ḧ ã  ϴ.\n";
+        std::cerr << "data 배열 종료를 찾을 수 없습니다.\n";
         std::exit(EXIT_FAILURE);
     }
 
@@ -45,7 +45,7 @@ inline std::vector<std::vector<int>> load_tilemap(const std::string& filename)
     size_t i = 0;
 
     while (i < data_view.size() && y < MAP_HEIGHT) {
-        // , ǥ 
+        // 공백, 쉼표 무시
         if (!std::isdigit(data_view[i])) {
             ++i;
             continue;
@@ -54,7 +54,7 @@ inline std::vector<std::vector<int>> load_tilemap(const std::string& filename)
         int val = 0;
         auto [ptr, ec] = std::from_chars(&data_view[i], &data_view[data_view.size()], val);
         if (ec != std::errc{}) {
-            std::cerr << " Ľ \n";
+            std::cerr << "숫자 파싱 오류\n";
             std::exit(EXIT_FAILURE);
         }
 
@@ -69,7 +69,7 @@ inline std::vector<std::vector<int>> load_tilemap(const std::string& filename)
     }
 
     if (y < MAP_HEIGHT) {
-        std::cerr << " Ͱ մϴ. : " << y << '\n';
+        std::cerr << "맵 데이터가 부족합니다. 행: " << y << '\n';
         std::exit(EXIT_FAILURE);
     }
 
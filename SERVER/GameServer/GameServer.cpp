@@ -1,20 +1,106 @@
 ﻿#include "pch.h"
 #include "Service.h"
 
-int main()
+// GameServer.exe [zoneId zoneCount [database [trace]]]
+// GameServer.exe --compile-spawns [script [table]] : monster_spawn.lua를 Binary Spawn Table로 변환하고 종료
+// zoneCount가 2 이상이면 Gateway 뒤에서 x축 기준 한 Zone만 담당
+// database : ODBC DSN 또는 "sqlite:<path>" (USE_SQLITE_STORAGE Build)
+// trace : 받은 Packet을 기록할 Packet Trace 파일 (STRESS_TEST/Replay로 재생)
+// Zone Server는 GSPG_ZONE_SECRET (Gateway와 같은 값), GSPG_ZONE_BIND (기본 127.0.0.1) 환경 변수 사용
+// GSPG_REGIONS="<x>x<y>" : Region Thread 분할 (없으면 Core 수로 정함)
+namespace
+{
+	constexpr const char* REGION_COUNT_ENV = "GSPG_REGIONS";
+
+	std::string GetEnv(const char* name)
+	{
+		char* value{ nullptr };
+		size_t length{ 0 };
+		if ((0 != _dupenv_s(&value, &length, name)) or (nullptr == value)) {
+			return {};
+		}
+
+		std::string result{ value };
+		free(value);
+		return result;
+	}
+
+	// 잘못된 값이면 0 x 0 (Service::Create가 기본값 사용)
+	std::pair<int, int> GetRegionCount()
+	{
+		std::string value = GetEnv(REGION_COUNT_ENV);
+		if (value.empty()) {
+			return { 0, 0 };
+		}
+
+		int x{ 0 }, y{ 0 };
+		if ((2 != sscanf_s(value.c_str(), "%dx%d", &x, &y)) or (x <= 0) or (y <= 0)) {
+			std::cout << REGION_COUNT_ENV << " 형식이 잘못되었습니다 (예 : 4x2), 기본값 사용\n";
+			return { 0, 0 };
+		}
+
+		return { x, y };
+	}
+}
+
+int main(int argc, char* argv[])
 {
 	setlocale(LC_ALL, "korean");
 
 	Logger::Init();
 	Logger::SetLevel(LogLevel::Error);
 
+	if ((argc >= 2) and (std::string{ argv[1] } == "--compile-spawns")) {
+		std::string script = (argc >= 3) ? argv[2] : ScriptManager::SPAWN_SCRIPT;
+		std::string table = (argc >= 4) ? argv[3] : ScriptManager::SPAWN_TABLE;
+
+		bool result = ScriptManager::CompileSpawnTable(script, table);
+		std::cout << (result ? "Spawn Table 변환 완료 : " : "Spawn Table 변환 실패 : ") << table << '\n';
+
+		Logger::Shutdown();
+		return result ? 0 : 1;
+	}
+
 	IocpCorePtr iocpCore = std::make_shared<IocpCore>();
-	ServicePtr service = Service::Create(iocpCore, MAX_USER);
+	auto [regionCountX, regionCountY] = GetRegionCount();
+	ServicePtr service = Service::Create(iocpCore, MAX_USER, regionCountX, regionCountY);
+
+	if (argc >= 3) {
+		service->SetZone(std::atoi(argv[1]), std::atoi(argv[2]));
+
+		if (std::atoi(argv[2]) > 1) {
+			std::string bindAddress = GetEnv(ZONE_BIND_ENV);
+			service->SetZoneGateway(GetEnv(ZONE_SECRET_ENV), bindAddress.empty() ? ZONE_DEFAULT_BIND : bindAddress);
+		}
+	}
+
+	std::string database = (argc >= 4) ? argv[3] : "2021182017_GameServer_DB";
+
+	if (argc >= 5) {
+		service->SetPacketTracePath(argv[4]);
+	}
+
+	service->Start(database, "mapdata.txt");
+
+	// 콘솔 명령 : "profile <sec>" 은 sec초 동안 Profile Zone 기록 후 JSON 저장
+	// "reload" 는 monster_spawn.lua / monster_ai.lua 다시 Load, 빈 줄은 종료
+	std::cout << "profile <sec> : Profile 기록, reload : Script 다시 읽기, 종료하려면 Enter 키를 누르세요...\n";
 
-	service->Start("2021182017_GameServer_DB", "mapdata.txt");
+	std::string line;
+	while (std::getline(std::cin, line) and not line.empty()) {
+		if (line == "reload") {
+			std::cout << (service->ReloadScripts() ? "Script 다시 읽기 완료\n" : "Script 다시 읽기 실패, 이전 Script 유지\n");
+			continue;
+		}
 
-	std::cout << "종료하려면 Enter 키를 누르세요...\n";
-	std::cin.get();
+		int seconds{ 0 };
+		if (1 == sscanf_s(line.c_str(), "profile %d", &seconds) and seconds > 0) {
+			std::string path = "profile_zone" + std::string{ (argc >= 3) ? argv[1] : "0" } + "_" + std::to_string(std::time(nullptr)) + ".json";
+			if (Profiler::Capture(path, seconds * 1000)) {
+				std::cout << path << " 에 " << seconds << "초 동안 기록합니다\n";
+			}
+		}
+	}
 
 	service->CloseService();
 
@@ -0,0 +1,629 @@
+// Zone Server 앞에서 Client TCP 연결을 유지하는 Gateway
+// Client 하나당 현재 Zone으로 Local TCP 연결 하나를 열고 Packet을 그대로 중계
+// Zone이 ZG_HANDOFF를 보내면 Zone 연결만 바꾸고 Client 연결은 그대로 유지
+// 이전 Zone에 이미 보낸 Client Packet은 GZ_HANDOFF_DRAIN으로 돌려받아(ZG_HANDOFF_REPLAY) 새 Zone에 순서대로 보냄
+//
+// usage : gateway <zoneCount> [listenPort] [zoneHost]
+// Zone Server와 같은 GSPG_ZONE_SECRET 환경 변수가 필요 (모든 Zone 연결의 첫 Packet GZ_HELLO로 전달)
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../ServerCore/protocol.h"
+#include "../ServerCore/ZoneProtocol.h"
+
+namespace
+{
+	struct Link {
+		int clientFd{ -1 };
+		int zoneFd{ -1 };
+		int zoneId{ 0 };
+
+		std::vector<char> clientIn;		// Client -> Gateway, 아직 Packet 단위로 못 자른 데이터
+		std::vector<char> zoneIn;		// Zone -> Gateway
+		std::vector<char> clientOut;	// Gateway -> Client, 아직 못 보낸 데이터
+		std::vector<char> zoneOut;		// Gateway -> Zone, 항상 Packet 단위로 보관 (Handoff 때 새 Zone으로 옮김)
+		size_t zoneOutSent{ 0 };		// zoneOut 첫 Packet 중 이미 보낸 byte 수
+
+		bool zoneConnecting{ false };	// Non-Blocking Connect 완료 대기 중 (POLLOUT)
+
+		// Handoff 중인 이전 Zone 연결. ZG_HANDOFF_DONE(또는 연결 종료 / 시간 초과)까지 유지
+		int oldZoneFd{ -1 };
+		std::vector<char> oldZoneIn;
+		std::vector<char> oldZoneOut;	// 반쯤 보낸 Client Packet의 나머지 + GZ_HANDOFF_DRAIN
+		std::vector<char> replay;		// 이전 Zone이 돌려보낸 Client Packet, 새 Zone에 가장 먼저 보냄
+		std::vector<char> held;			// Drain 중에 받은 Client Packet, replay 뒤에 보냄
+		std::chrono::steady_clock::time_point drainDeadline;
+
+		bool overLimit{ false };		// 보낼 데이터가 MAX_LINK_BUFFER 이상 (반대쪽 읽기 중지)
+		std::chrono::steady_clock::time_point overLimitSince;
+	};
+
+	// 이전 Zone이 이 시간 안에 ZG_HANDOFF_DONE을 보내지 않으면 받은 replay까지만 넘기고 진행
+	constexpr auto DRAIN_TIMEOUT = std::chrono::seconds(2);
+
+	// Link 방향마다 쌓아 둘 수 있는 byte 수. 넘으면 보내는 쪽 연결을 읽지 않고 (Backpressure)
+	// OVER_LIMIT_TIMEOUT 동안 계속 넘어 있으면 받는 쪽이 읽지 않는 것으로 보고 Link를 닫음
+	constexpr size_t MAX_LINK_BUFFER = 256 * 1024;
+	constexpr auto OVER_LIMIT_TIMEOUT = std::chrono::seconds(5);
+
+	// Client로 보낼 데이터가 가득 차면 Zone에서 더 읽지 않음
+	bool ClientOutFull(const Link& link)
+	{
+		return link.clientOut.size() >= MAX_LINK_BUFFER;
+	}
+
+	// Zone으로 보낼 데이터(Drain 중에 모은 held 포함)가 가득 차면 Client에서 더 읽지 않음
+	bool ZoneOutFull(const Link& link)
+	{
+		return link.zoneOut.size() + link.held.size() >= MAX_LINK_BUFFER;
+	}
+
+	int g_zoneCount{ 1 };
+	std::string g_zoneHost{ "127.0.0.1" };
+	char g_zoneSecret[ZONE_SECRET_SIZE]{};
+
+	bool SetNonBlocking(int fd)
+	{
+		int flags = fcntl(fd, F_GETFL, 0);
+		return (flags >= 0) and (fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0);
+	}
+
+	// Non-Blocking Connect. 완료는 poll의 POLLOUT 후 SO_ERROR로 확인 (FinishConnect)
+	int ConnectZone(Link& link, int zoneId)
+	{
+		int fd = socket(AF_INET, SOCK_STREAM, 0);
+		if (fd < 0) {
+			return -1;
+		}
+
+		if (not SetNonBlocking(fd)) {
+			close(fd);
+			return -1;
+		}
+
+		int noDelay{ 1 };
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+		sockaddr_in addr{};
+		addr.sin_family = AF_INET;
+		addr.sin_port = htons(static_cast<unsigned short>(ZONE_BASE_PORT + zoneId));
+		inet_pton(AF_INET, g_zoneHost.c_str(), &addr.sin_addr);
+
+		// Connect 하나가 늦어져도 다른 Client의 중계는 멈추지 않음
+		link.zoneConnecting = false;
+		if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+			if (errno != EINPROGRESS) {
+				std::fprintf(stderr, "[Gateway] connect zone %d failed: %s\n", zoneId, std::strerror(errno));
+				close(fd);
+				return -1;
+			}
+
+			link.zoneConnecting = true;
+		}
+
+		return fd;
+	}
+
+	bool FinishConnect(Link& link)
+	{
+		int error{ 0 };
+		socklen_t length = sizeof(error);
+		if ((getsockopt(link.zoneFd, SOL_SOCKET, SO_ERROR, &error, &length) != 0) or (error != 0)) {
+			std::fprintf(stderr, "[Gateway] connect zone %d failed: %s\n", link.zoneId, std::strerror(error));
+			return false;
+		}
+
+		link.zoneConnecting = false;
+		return true;
+	}
+
+	// Zone은 Secret을 확인한 연결의 Packet만 처리하므로 새 Zone 연결마다 가장 먼저 보냄
+	void QueueHello(std::vector<char>& out)
+	{
+		GZ_HELLO_PACKET hello;
+		hello.size = sizeof(hello);
+		hello.type = static_cast<char>(GZ_HELLO);
+		std::memcpy(hello.secret, g_zoneSecret, sizeof(hello.secret));
+
+		const char* raw = reinterpret_cast<const char*>(&hello);
+		out.insert(out.end(), raw, raw + sizeof(hello));
+	}
+
+	// 보낼 수 있는 만큼 보내고 나머지는 out에 남김
+	bool Flush(int fd, std::vector<char>& out)
+	{
+		while (not out.empty()) {
+			ssize_t sent = send(fd, out.data(), out.size(), MSG_NOSIGNAL);
+			if (sent < 0) {
+				if ((errno == EAGAIN) or (errno == EWOULDBLOCK)) {
+					return true;
+				}
+
+				return false;
+			}
+
+			out.erase(out.begin(), out.begin() + sent);
+		}
+
+		return true;
+	}
+
+	// zoneOut은 다 보낸 Packet만 지움. Handoff 때 반쯤 보낸 Packet을 새 Zone에 처음부터 다시 보내기 위함
+	bool FlushZone(Link& link)
+	{
+		while (link.zoneOutSent < link.zoneOut.size()) {
+			ssize_t sent = send(link.zoneFd, link.zoneOut.data() + link.zoneOutSent, link.zoneOut.size() - link.zoneOutSent, MSG_NOSIGNAL);
+			if (sent < 0) {
+				if ((errno == EAGAIN) or (errno == EWOULDBLOCK)) {
+					break;
+				}
+
+				return false;
+			}
+
+			link.zoneOutSent += sent;
+		}
+
+		size_t done{ 0 };
+		while (done < link.zoneOut.size()) {
+			size_t size = static_cast<unsigned char>(link.zoneOut[done]);
+			if (done + size > link.zoneOutSent) {
+				break;
+			}
+
+			done += size;
+		}
+
+		link.zoneOut.erase(link.zoneOut.begin(), link.zoneOut.begin() + done);
+		link.zoneOutSent -= done;
+		return true;
+	}
+
+	// 한 번에 MAX_LINK_BUFFER까지만 읽음. 남은 데이터는 다음 poll에서
+	bool ReadAll(int fd, std::vector<char>& in)
+	{
+		char buf[4096];
+		while (in.size() < MAX_LINK_BUFFER) {
+			ssize_t received = recv(fd, buf, sizeof(buf), 0);
+			if (received > 0) {
+				in.insert(in.end(), buf, buf + received);
+				continue;
+			}
+
+			if (received == 0) {
+				return false;
+			}
+
+			return (errno == EAGAIN) or (errno == EWOULDBLOCK);
+		}
+
+		return true;
+	}
+
+	// Drain 종료 : 이전 Zone 연결을 닫고 (이전 Zone은 ReleaseSession으로 Player 정리)
+	// 돌려받은 Packet, Drain 중에 받은 Packet 순서로 새 Zone에 보냄
+	void FinishDrain(Link& link)
+	{
+		close(link.oldZoneFd);
+		link.oldZoneFd = -1;
+		link.oldZoneIn.clear();
+		link.oldZoneOut.clear();
+
+		link.zoneOut.insert(link.zoneOut.end(), link.replay.begin(), link.replay.end());
+		link.zoneOut.insert(link.zoneOut.end(), link.held.begin(), link.held.end());
+		link.replay.clear();
+		link.held.clear();
+	}
+
+	// 이전 Zone -> Gateway : ZG_HANDOFF_REPLAY는 풀어서 replay로, ZG_HANDOFF_DONE이면 Drain 종료
+	// 나머지는 이미 떠난 Player에게 보낸 것이므로 버림
+	bool RelayFromOldZone(Link& link)
+	{
+		size_t offset{ 0 };
+		while (offset < link.oldZoneIn.size()) {
+			unsigned char size = static_cast<unsigned char>(link.oldZoneIn[offset]);
+			if (size < 2) {
+				return false;
+			}
+
+			if (offset + size > link.oldZoneIn.size()) {
+				break;
+			}
+
+			unsigned char type = static_cast<unsigned char>(link.oldZoneIn[offset + 1]);
+			if (type == ZG_HANDOFF_DONE) {
+				FinishDrain(link);
+				return true;
+			}
+
+			if (type == ZG_HANDOFF_REPLAY) {
+				const size_t header = sizeof(ZG_HANDOFF_REPLAY_HEADER);
+				unsigned char innerSize = (size > header) ? static_cast<unsigned char>(link.oldZoneIn[offset + header]) : 0;
+				unsigned char innerType = (size > header + 1) ? static_cast<unsigned char>(link.oldZoneIn[offset + header + 1]) : ZONE_PACKET_BEGIN;
+				if ((innerSize + header != size) or (innerType >= ZONE_PACKET_BEGIN)) {
+					return false;
+				}
+
+				link.replay.insert(link.replay.end(), link.oldZoneIn.begin() + offset + header, link.oldZoneIn.begin() + offset + size);
+			}
+
+			offset += size;
+		}
+
+		link.oldZoneIn.erase(link.oldZoneIn.begin(), link.oldZoneIn.begin() + offset);
+		return true;
+	}
+
+	// Zone이 보낸 Handoff를 받아 새 Zone으로 연결을 옮김
+	bool Handoff(Link& link, const ZG_HANDOFF_PACKET& handoff)
+	{
+		int targetZone = handoff.targetZone;
+		if ((targetZone < 0) or (targetZone >= g_zoneCount)) {
+			std::fprintf(stderr, "[Gateway] invalid handoff target %d\n", targetZone);
+			return false;
+		}
+
+		// 새 Zone은 HANDOFF_IN 전에는 넘길 수 없으므로 Drain 중에 다시 오면 Zone 쪽 오류
+		if (link.oldZoneFd >= 0) {
+			std::fprintf(stderr, "[Gateway] handoff during drain (user %d)\n", handoff.state.userId);
+			return false;
+		}
+
+		// 1. 이전 Zone 연결은 Drain이 끝날 때까지 유지. ZG_HANDOFF 뒤에 이미 받은 데이터는 Drain 응답
+		// 반쯤 보낸 Packet은 마저 보내서 이전 Zone이 돌려보내게 하고, 그 뒤에 GZ_HANDOFF_DRAIN
+		// 아직 보내지 않은 Packet은 held로 옮겨서 돌려받은 Packet 뒤에 새 Zone으로 보냄
+		link.oldZoneFd = link.zoneFd;
+		link.oldZoneIn = std::move(link.zoneIn);
+		link.zoneIn.clear();
+		link.drainDeadline = std::chrono::steady_clock::now() + DRAIN_TIMEOUT;
+
+		size_t offset{ 0 };
+		if (link.zoneOutSent > 0) {
+			offset = static_cast<unsigned char>(link.zoneOut[0]);
+			link.oldZoneOut.assign(link.zoneOut.begin() + link.zoneOutSent, link.zoneOut.begin() + offset);
+		}
+
+		GZ_HANDOFF_DRAIN_PACKET drain;
+		drain.size = sizeof(drain);
+		drain.type = static_cast<char>(GZ_HANDOFF_DRAIN);
+
+		const char* drainRaw = reinterpret_cast<const char*>(&drain);
+		link.oldZoneOut.insert(link.oldZoneOut.end(), drainRaw, drainRaw + sizeof(drain));
+
+		for (; offset < link.zoneOut.size(); ) {
+			unsigned char size = static_cast<unsigned char>(link.zoneOut[offset]);
+			unsigned char type = static_cast<unsigned char>(link.zoneOut[offset + 1]);
+			if (type < ZONE_PACKET_BEGIN) {
+				link.held.insert(link.held.end(), link.zoneOut.begin() + offset, link.zoneOut.begin() + offset + size);
+			}
+
+			offset += size;
+		}
+
+		// 2. 새 Zone 연결
+		link.zoneFd = ConnectZone(link, targetZone);
+		if (link.zoneFd < 0) {
+			return false;
+		}
+
+		// 3. Hello, Handoff 상태. Client Packet은 Drain이 끝나면 이어서 보냄 (FinishDrain)
+		std::vector<char> out;
+		QueueHello(out);
+
+		GZ_HANDOFF_IN_PACKET handoffIn;
+		handoffIn.size = sizeof(handoffIn);
+		handoffIn.type = static_cast<char>(GZ_HANDOFF_IN);
+		handoffIn.state = handoff.state;
+
+		const char* raw = reinterpret_cast<const char*>(&handoffIn);
+		out.insert(out.end(), raw, raw + sizeof(handoffIn));
+
+		link.zoneOut = std::move(out);
+		link.zoneOutSent = 0;
+
+		std::printf("[Gateway] user %d zone %d -> %d\n", handoff.state.userId, link.zoneId, targetZone);
+		link.zoneId = targetZone;
+
+		// ZG_HANDOFF와 같이 받은 데이터에 DONE까지 있을 수 있음
+		return RelayFromOldZone(link);
+	}
+
+	// Client -> Zone : Zone 전용 Packet은 Client가 보낼 수 없으므로 버림
+	// Drain 중에는 이전 Zone이 돌려보낼 Packet보다 뒤에 가도록 held에 모음
+	bool RelayFromClient(Link& link)
+	{
+		std::vector<char>& out = (link.oldZoneFd >= 0) ? link.held : link.zoneOut;
+
+		size_t offset{ 0 };
+		while (offset < link.clientIn.size()) {
+			unsigned char size = static_cast<unsigned char>(link.clientIn[offset]);
+			if (size < 2) {
+				return false;
+			}
+
+			if (offset + size > link.clientIn.size()) {
+				break;
+			}
+
+			unsigned char type = static_cast<unsigned char>(link.clientIn[offset + 1]);
+			if (type < ZONE_PACKET_BEGIN) {
+				out.insert(out.end(), link.clientIn.begin() + offset, link.clientIn.begin() + offset + size);
+			}
+
+			offset += size;
+		}
+
+		link.clientIn.erase(link.clientIn.begin(), link.clientIn.begin() + offset);
+		return true;
+	}
+
+	// Zone -> Client : ZG_HANDOFF만 Gateway가 처리하고 나머지는 그대로 전달
+	bool RelayFromZone(Link& link)
+	{
+		size_t offset{ 0 };
+		while (offset < link.zoneIn.size()) {
+			unsigned char size = static_cast<unsigned char>(link.zoneIn[offset]);
+			if (size < 2) {
+				return false;
+			}
+
+			if (offset + size > link.zoneIn.size()) {
+				break;
+			}
+
+			unsigned char type = static_cast<unsigned char>(link.zoneIn[offset + 1]);
+			if (type == ZG_HANDOFF) {
+				if (size != sizeof(ZG_HANDOFF_PACKET)) {
+					return false;
+				}
+
+				ZG_HANDOFF_PACKET handoff;
+				std::memcpy(&handoff, link.zoneIn.data() + offset, sizeof(handoff));
+
+				// ZG_HANDOFF 앞의 Packet은 위에서 이미 clientOut으로 넘김
+				link.zoneIn.erase(link.zoneIn.begin(), link.zoneIn.begin() + offset + size);
+				return Handoff(link, handoff);
+			}
+
+			link.clientOut.insert(link.clientOut.end(), link.zoneIn.begin() + offset, link.zoneIn.begin() + offset + size);
+			offset += size;
+		}
+
+		link.zoneIn.erase(link.zoneIn.begin(), link.zoneIn.begin() + offset);
+		return true;
+	}
+
+	int Listen(unsigned short port)
+	{
+		int fd = socket(AF_INET, SOCK_STREAM, 0);
+		if (fd < 0) {
+			return -1;
+		}
+
+		int reuse{ 1 };
+		setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+		sockaddr_in addr{};
+		addr.sin_family = AF_INET;
+		addr.sin_port = htons(port);
+		addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+		if ((bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) or (listen(fd, SOMAXCONN) != 0)) {
+			std::fprintf(stderr, "[Gateway] listen on %u failed: %s\n", port, std::strerror(errno));
+			close(fd);
+			return -1;
+		}
+
+		SetNonBlocking(fd);
+		return fd;
+	}
+
+	void CloseLink(Link& link)
+	{
+		if (link.clientFd >= 0) close(link.clientFd);
+		if (link.zoneFd >= 0) close(link.zoneFd);
+		if (link.oldZoneFd >= 0) close(link.oldZoneFd);
+
+		link.clientFd = -1;
+		link.zoneFd = -1;
+		link.oldZoneFd = -1;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2) {
+		std::fprintf(stderr, "usage : %s <zoneCount> [listenPort] [zoneHost]\n", argv[0]);
+		return 1;
+	}
+
+	g_zoneCount = std::atoi(argv[1]);
+	if ((g_zoneCount < 1) or (g_zoneCount > MAX_ZONE_COUNT)) {
+		std::fprintf(stderr, "zoneCount must be 1..%d\n", MAX_ZONE_COUNT);
+		return 1;
+	}
+
+	unsigned short listenPort = (argc >= 3) ? static_cast<unsigned short>(std::atoi(argv[2])) : static_cast<unsigned short>(PORT_NUM);
+	if (argc >= 4) {
+		g_zoneHost = argv[3];
+	}
+
+	const char* secret = std::getenv(ZONE_SECRET_ENV);
+	if ((nullptr == secret) or ('\0' == secret[0])) {
+		std::fprintf(stderr, "%s must be set to the zone servers' secret\n", ZONE_SECRET_ENV);
+		return 1;
+	}
+	FillZoneSecret(g_zoneSecret, secret);
+
+	signal(SIGPIPE, SIG_IGN);
+
+	int listenFd = Listen(listenPort);
+	if (listenFd < 0) {
+		return 1;
+	}
+
+	std::printf("[Gateway] listening on %u, %d zones from port %d\n", listenPort, g_zoneCount, ZONE_BASE_PORT);
+
+	// key : clientFd
+	std::unordered_map<int, std::unique_ptr<Link>> links;
+	std::vector<pollfd> fds;
+
+	while (true) {
+		// 1. poll 목록 구성
+		fds.clear();
+		fds.push_back(pollfd{ listenFd, POLLIN, 0 });
+
+		// Link마다 Client, Zone, 이전 Zone 순서로 3개 (이전 Zone이 없으면 fd -1, poll이 무시)
+		// 반대쪽으로 보낼 데이터가 가득 찬 연결은 POLLIN을 빼서 읽지 않음
+		bool waiting{ false };
+		for (auto& [clientFd, link] : links) {
+			short clientEvents = (ZoneOutFull(*link) ? 0 : POLLIN) | (link->clientOut.empty() ? 0 : POLLOUT);
+			short zoneEvents = link->zoneConnecting ? POLLOUT : ((ClientOutFull(*link) ? 0 : POLLIN) | (link->zoneOut.empty() ? 0 : POLLOUT));
+			short oldZoneEvents = POLLIN | (link->oldZoneOut.empty() ? 0 : POLLOUT);
+
+			fds.push_back(pollfd{ link->clientFd, clientEvents, 0 });
+			fds.push_back(pollfd{ link->zoneFd, zoneEvents, 0 });
+			fds.push_back(pollfd{ link->oldZoneFd, oldZoneEvents, 0 });
+
+			waiting = waiting or (link->oldZoneFd >= 0) or link->overLimit;
+		}
+
+		// Drain 중이거나 한도를 넘은 Link가 있으면 시간 초과 검사를 위해 주기적으로 깨어남
+		if (poll(fds.data(), fds.size(), waiting ? 200 : -1) < 0) {
+			if (errno == EINTR) continue;
+
+			std::fprintf(stderr, "[Gateway] poll failed: %s\n", std::strerror(errno));
+			break;
+		}
+
+		// 2. 새 Client는 첫 Zone에 연결, 다른 Zone 위치면 Login 후 Zone이 Handoff를 보냄
+		if (fds[0].revents & POLLIN) {
+			while (true) {
+				int clientFd = accept(listenFd, nullptr, nullptr);
+				if (clientFd < 0) break;
+
+				int noDelay{ 1 };
+				setsockopt(clientFd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+				SetNonBlocking(clientFd);
+
+				auto link = std::make_unique<Link>();
+				link->clientFd = clientFd;
+				link->zoneId = 0;
+				link->zoneFd = ConnectZone(*link, 0);
+
+				if (link->zoneFd < 0) {
+					close(clientFd);
+					continue;
+				}
+
+				QueueHello(link->zoneOut);
+
+				links.emplace(clientFd, std::move(link));
+			}
+		}
+
+		// 3. 기존 연결 처리
+		std::vector<int> closed;
+		auto now = std::chrono::steady_clock::now();
+		for (size_t i = 1; i + 2 < fds.size(); i += 3) {
+			const pollfd& clientPoll = fds[i];
+			const pollfd& zonePoll = fds[i + 1];
+			const pollfd& oldZonePoll = fds[i + 2];
+
+			auto it = links.find(clientPoll.fd);
+			if (it == links.end()) continue;
+
+			Link& link = *it->second;
+			bool alive{ true };
+
+			// 연결이 닫혔어도 그 전에 받은 데이터는 먼저 전달
+			if (clientPoll.revents & (POLLIN | POLLHUP | POLLERR)) {
+				bool open = ReadAll(link.clientFd, link.clientIn);
+				alive = RelayFromClient(link) and open;
+			}
+
+			// Handoff로 zoneFd가 바뀌었으면 이번 poll 결과는 이전 연결의 것이므로 무시
+			bool sameZone = (zonePoll.fd == link.zoneFd);
+			if (alive and sameZone and link.zoneConnecting and (zonePoll.revents & (POLLOUT | POLLHUP | POLLERR))) {
+				alive = FinishConnect(link);
+			}
+
+			else if (alive and sameZone and (zonePoll.revents & (POLLIN | POLLHUP | POLLERR))) {
+				bool open = ReadAll(link.zoneFd, link.zoneIn);
+				int zoneFd = link.zoneFd;
+				alive = RelayFromZone(link) and (open or (zoneFd != link.zoneFd));
+			}
+
+			// 이전 Zone : 닫혔거나 보내기가 실패하면 받은 replay까지만 넘기고 Drain 종료
+			if (alive and (link.oldZoneFd >= 0) and (oldZonePoll.fd == link.oldZoneFd) and (oldZonePoll.revents & (POLLIN | POLLHUP | POLLERR))) {
+				bool open = ReadAll(link.oldZoneFd, link.oldZoneIn);
+				alive = RelayFromOldZone(link);
+				if (alive and (not open) and (link.oldZoneFd >= 0)) {
+					FinishDrain(link);
+				}
+			}
+
+			if (alive and (link.oldZoneFd >= 0)) {
+				if (not Flush(link.oldZoneFd, link.oldZoneOut)) {
+					FinishDrain(link);
+				}
+
+				else if (now >= link.drainDeadline) {
+					std::fprintf(stderr, "[Gateway] drain before zone %d timed out\n", link.zoneId);
+					FinishDrain(link);
+				}
+			}
+
+			if (alive) {
+				alive = (link.zoneConnecting or FlushZone(link)) and Flush(link.clientFd, link.clientOut);
+			}
+
+			// 보내고 남은 데이터가 한도를 넘은 채로 OVER_LIMIT_TIMEOUT이 지나면 닫음
+			if (alive and (ClientOutFull(link) or ZoneOutFull(link))) {
+				if (not link.overLimit) {
+					link.overLimit = true;
+					link.overLimitSince = now;
+				}
+
+				else if (now - link.overLimitSince >= OVER_LIMIT_TIMEOUT) {
+					std::fprintf(stderr, "[Gateway] zone %d link over buffer limit (client %zu, zone %zu bytes), closing\n",
+						link.zoneId, link.clientOut.size(), link.zoneOut.size() + link.held.size());
+					alive = false;
+				}
+			}
+
+			else {
+				link.overLimit = false;
+			}
+
+			if (not alive) {
+				closed.push_back(link.clientFd);
+			}
+		}
+
+		for (int clientFd : closed) {
+			CloseLink(*links[clientFd]);
+			links.erase(clientFd);
+		}
+	}
+
+	close(listenFd);
+	return 0;
+}
@@ -0,0 +1,541 @@
+// Gateway 시험용 Linux Zone Server (GameServer.exe 없이 Zone Handoff 경로를 돌려보기 위함)
+// GameServer와 같은 Zone 연결 규칙 : ZONE_BASE_PORT + zoneId에서 Listen, 첫 Packet GZ_HELLO의 Secret 확인
+// CS_LOGIN / CS_MOVE / CS_TELEPORT / CS_CHAT만 최소한으로 처리하고 x가 다른 Zone으로 넘어가면 ZG_HANDOFF
+// 그 뒤에 받은 Client Packet은 ZG_HANDOFF_REPLAY로 돌려보내고 GZ_HANDOFF_DRAIN에 ZG_HANDOFF_DONE으로 응답
+// Map / NPC / DB / View는 없음. 좌표 판정은 GetZoneOf 그대로
+//
+// usage : zone-stub <zoneId> <zoneCount>
+// GSPG_ZONE_SECRET(필수), GSPG_ZONE_BIND(기본 127.0.0.1)는 GameServer와 같음
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "../ServerCore/protocol.h"
+#include "../ServerCore/ZoneProtocol.h"
+
+namespace
+{
+	struct Connection {
+		int fd{ -1 };
+		bool trusted{ false };		// GZ_HELLO 확인 완료
+		bool inGame{ false };
+		bool handedOff{ false };	// ZG_HANDOFF를 보낸 뒤에는 Packet을 처리하지 않고 Gateway로 돌려보냄
+		HandoffState state{};
+
+		std::vector<char> in;
+		std::vector<char> out;
+	};
+
+	struct Counters {
+		long long logins{ 0 };
+		long long handoffIn{ 0 };
+		long long handoffOut{ 0 };
+		long long replayed{ 0 };	// Handoff 뒤에 받아서 돌려보낸 Client Packet
+		long long duplicates{ 0 };
+		long long rejected{ 0 };	// Secret 불일치, Hello 전 Packet
+	};
+
+	int g_zoneId{ 0 };
+	int g_zoneCount{ 1 };
+	char g_zoneSecret[ZONE_SECRET_SIZE]{};
+
+	std::unordered_set<int> g_inGameUsers;
+	Counters g_counters;
+	std::mt19937 g_random{ std::random_device{}() };
+
+	bool SetNonBlocking(int fd)
+	{
+		int flags = fcntl(fd, F_GETFL, 0);
+		return (flags >= 0) and (fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0);
+	}
+
+	template<typename Packet>
+	void Append(Connection& connection, const Packet& packet)
+	{
+		const char* raw = reinterpret_cast<const char*>(&packet);
+		connection.out.insert(connection.out.end(), raw, raw + sizeof(Packet));
+	}
+
+	void SendLoginInfo(Connection& connection)
+	{
+		SC_LOGIN_INFO_PACKET login{};
+		login.size = sizeof(login);
+		login.type = SC_LOGIN_INFO;
+		login.id = connection.state.userId;
+		login.hp = connection.state.hp;
+		login.max_hp = connection.state.maxHp;
+		login.exp = static_cast<int>(connection.state.exp);
+		login.level = connection.state.level;
+		login.x = connection.state.x;
+		login.y = connection.state.y;
+		Append(connection, login);
+	}
+
+	void SendMove(Connection& connection, unsigned int moveTime)
+	{
+		SC_MOVE_OBJECT_PACKET move{};
+		move.size = sizeof(move);
+		move.type = SC_MOVE_OBJECT;
+		move.id = connection.state.userId;
+		move.x = connection.state.x;
+		move.y = connection.state.y;
+		move.move_time = moveTime;
+		Append(connection, move);
+	}
+
+	// Service::CheckZoneHandoff와 같은 판정. 넘긴 뒤에는 이 Zone에서 Player 제거
+	void CheckZoneHandoff(Connection& connection)
+	{
+		int targetZone = GetZoneOf(connection.state.x, g_zoneCount);
+		if (targetZone == g_zoneId) {
+			return;
+		}
+
+		ZG_HANDOFF_PACKET handoff{};
+		handoff.size = sizeof(handoff);
+		handoff.type = static_cast<char>(ZG_HANDOFF);
+		handoff.targetZone = static_cast<char>(targetZone);
+		handoff.state = connection.state;
+		Append(connection, handoff);
+
+		g_inGameUsers.erase(connection.state.userId);
+		connection.inGame = false;
+		connection.handedOff = true;
+		++g_counters.handoffOut;
+	}
+
+	// Service::OnHandedOffPacket과 같은 처리
+	bool OnHandedOffPacket(Connection& connection, const char* packet, unsigned char size)
+	{
+		unsigned char type = static_cast<unsigned char>(packet[1]);
+		if (type == GZ_HANDOFF_DRAIN) {
+			if (size != sizeof(GZ_HANDOFF_DRAIN_PACKET)) {
+				return false;
+			}
+
+			ZG_HANDOFF_DONE_PACKET done{};
+			done.size = sizeof(done);
+			done.type = static_cast<char>(ZG_HANDOFF_DONE);
+			Append(connection, done);
+			return true;
+		}
+
+		if ((type >= ZONE_PACKET_BEGIN) or (size > MAX_REPLAY_PACKET_SIZE)) {
+			return false;
+		}
+
+		ZG_HANDOFF_REPLAY_HEADER header{};
+		header.size = static_cast<unsigned char>(sizeof(header) + size);
+		header.type = static_cast<char>(ZG_HANDOFF_REPLAY);
+		Append(connection, header);
+		connection.out.insert(connection.out.end(), packet, packet + size);
+
+		++g_counters.replayed;
+		return true;
+	}
+
+	bool EnterWorld(Connection& connection)
+	{
+		if (not g_inGameUsers.insert(connection.state.userId).second) {
+			SC_LOGIN_FAIL_PACKET fail{};
+			fail.size = sizeof(fail);
+			fail.type = SC_LOGIN_FAIL;
+			Append(connection, fail);
+
+			++g_counters.duplicates;
+			return false;
+		}
+
+		connection.inGame = true;
+		SendLoginInfo(connection);
+		CheckZoneHandoff(connection);
+		return true;
+	}
+
+	bool OnHello(Connection& connection, const char* packet, unsigned char size)
+	{
+		if (size != sizeof(GZ_HELLO_PACKET)) {
+			return false;
+		}
+
+		GZ_HELLO_PACKET hello;
+		std::memcpy(&hello, packet, sizeof(hello));
+		if (not ZoneSecretEquals(hello.secret, g_zoneSecret)) {
+			return false;
+		}
+
+		connection.trusted = true;
+		return true;
+	}
+
+	bool OnLogin(Connection& connection, const char* packet, unsigned char size)
+	{
+		if ((size != sizeof(CS_LOGIN_PACKET)) or connection.inGame) {
+			return false;
+		}
+
+		CS_LOGIN_PACKET login;
+		std::memcpy(&login, packet, sizeof(login));
+
+		// DB 대신 id로 정한 시작 위치. Zone 0이 아닌 위치면 Login 직후 Handoff
+		HandoffState& state = connection.state;
+		state = HandoffState{};
+		state.userId = login.id;
+		std::memcpy(state.name, login.name, NAME_SIZE);
+		state.name[NAME_SIZE - 1] = '\0';
+		state.level = 1;
+		state.hp = state.maxHp = 100;
+		state.x = static_cast<short>((static_cast<unsigned int>(login.id) * 7919u) % W_WIDTH);
+		state.y = static_cast<short>((static_cast<unsigned int>(login.id) * 104729u) % W_HEIGHT);
+		state.partyId = -1;
+
+		++g_counters.logins;
+		return EnterWorld(connection);
+	}
+
+	bool OnHandoffIn(Connection& connection, const char* packet, unsigned char size)
+	{
+		if ((size != sizeof(GZ_HANDOFF_IN_PACKET)) or connection.inGame) {
+			return false;
+		}
+
+		GZ_HANDOFF_IN_PACKET handoffIn;
+		std::memcpy(&handoffIn, packet, sizeof(handoffIn));
+
+		connection.state = handoffIn.state;
+		connection.state.name[NAME_SIZE - 1] = '\0';
+
+		++g_counters.handoffIn;
+		return EnterWorld(connection);
+	}
+
+	void OnMove(Connection& connection, const char* packet, unsigned char size)
+	{
+		if (size != sizeof(CS_MOVE_PACKET)) {
+			return;
+		}
+
+		CS_MOVE_PACKET move;
+		std::memcpy(&move, packet, sizeof(move));
+
+		short& x = connection.state.x;
+		short& y = connection.state.y;
+		switch (move.direction) {
+		case UP:	if (y > 0)				y--; break;
+		case DOWN:	if (y < W_HEIGHT - 1)	y++; break;
+		case LEFT:	if (x > 0)				x--; break;
+		case RIGHT: if (x < W_WIDTH - 1)	x++; break;
+		}
+
+		SendMove(connection, move.move_time);
+		CheckZoneHandoff(connection);
+	}
+
+	void OnTeleport(Connection& connection)
+	{
+		std::uniform_int_distribution<int> coord(0, W_WIDTH - 1);
+		connection.state.x = static_cast<short>(coord(g_random));
+		connection.state.y = static_cast<short>(coord(g_random));
+
+		SendMove(connection, 0);
+		CheckZoneHandoff(connection);
+	}
+
+	void OnChat(Connection& connection, const char* packet, unsigned char size)
+	{
+		if (size != sizeof(CS_CHAT_PACKET)) {
+			return;
+		}
+
+		CS_CHAT_PACKET request;
+		std::memcpy(&request, packet, sizeof(request));
+
+		SC_CHAT_PACKET chat{};
+		chat.size = sizeof(chat);
+		chat.type = SC_CHAT;
+		chat.id = connection.state.userId;
+		chat.targetId = -1;
+		std::memcpy(chat.message, request.message, CHAT_SIZE);
+		chat.message[CHAT_SIZE - 1] = '\0';
+		Append(connection, chat);
+	}
+
+	// false면 연결 종료
+	bool ProcessPacket(Connection& connection, const char* packet, unsigned char size)
+	{
+		char type = packet[1];
+
+		// GameServer와 같은 규칙 : 신뢰 전에는 GZ_HELLO만, 신뢰 후에는 GZ_HELLO를 다시 받지 않음
+		if (connection.trusted == (type == static_cast<char>(GZ_HELLO))) {
+			++g_counters.rejected;
+			return false;
+		}
+
+		if (type == static_cast<char>(GZ_HELLO)) {
+			if (not OnHello(connection, packet, size)) {
+				++g_counters.rejected;
+				return false;
+			}
+			return true;
+		}
+
+		// Handoff 뒤에 받은 Packet은 Gateway를 거쳐 새 Zone이 처리
+		if (connection.handedOff) {
+			return OnHandedOffPacket(connection, packet, size);
+		}
+
+		if (type == static_cast<char>(GZ_HANDOFF_IN)) {
+			return OnHandoffIn(connection, packet, size);
+		}
+
+		if (type == CS_LOGIN) {
+			return OnLogin(connection, packet, size);
+		}
+
+		if (not connection.inGame) {
+			return true;
+		}
+
+		switch (type) {
+		case CS_MOVE:		OnMove(connection, packet, size); break;
+		case CS_TELEPORT:	OnTeleport(connection); break;
+		case CS_CHAT:		OnChat(connection, packet, size); break;
+		default:			break;		// CS_ATTACK 등은 Handoff 시험과 상관없으므로 무시
+		}
+
+		return true;
+	}
+
+	bool ReadAndProcess(Connection& connection)
+	{
+		char buf[4096];
+		while (true) {
+			ssize_t received = recv(connection.fd, buf, sizeof(buf), 0);
+			if (received > 0) {
+				connection.in.insert(connection.in.end(), buf, buf + received);
+				continue;
+			}
+
+			if (received == 0) {
+				return false;
+			}
+
+			if ((errno == EAGAIN) or (errno == EWOULDBLOCK)) {
+				break;
+			}
+
+			return false;
+		}
+
+		size_t offset{ 0 };
+		while (offset < connection.in.size()) {
+			unsigned char size = static_cast<unsigned char>(connection.in[offset]);
+			if (size < 2) {
+				return false;
+			}
+
+			if (offset + size > connection.in.size()) {
+				break;
+			}
+
+			if (not ProcessPacket(connection, connection.in.data() + offset, size)) {
+				return false;
+			}
+
+			offset += size;
+		}
+
+		connection.in.erase(connection.in.begin(), connection.in.begin() + offset);
+		return true;
+	}
+
+	bool Flush(Connection& connection)
+	{
+		while (not connection.out.empty()) {
+			ssize_t sent = send(connection.fd, connection.out.data(), connection.out.size(), MSG_NOSIGNAL);
+			if (sent < 0) {
+				return (errno == EAGAIN) or (errno == EWOULDBLOCK);
+			}
+
+			connection.out.erase(connection.out.begin(), connection.out.begin() + sent);
+		}
+
+		return true;
+	}
+
+	void CloseConnection(Connection& connection)
+	{
+		// Gateway가 Handoff 후 닫은 연결은 이미 제거됨 (ReleaseSession과 같은 정리)
+		if (connection.inGame) {
+			g_inGameUsers.erase(connection.state.userId);
+		}
+
+		close(connection.fd);
+		connection.fd = -1;
+	}
+
+	int Listen(const char* bindAddress, unsigned short port)
+	{
+		int fd = socket(AF_INET, SOCK_STREAM, 0);
+		if (fd < 0) {
+			return -1;
+		}
+
+		int reuse{ 1 };
+		setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+		sockaddr_in addr{};
+		addr.sin_family = AF_INET;
+		addr.sin_port = htons(port);
+		if (inet_pton(AF_INET, bindAddress, &addr.sin_addr) != 1) {
+			std::fprintf(stderr, "[Zone %d] invalid bind address %s\n", g_zoneId, bindAddress);
+			close(fd);
+			return -1;
+		}
+
+		if ((bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) or (listen(fd, SOMAXCONN) != 0)) {
+			std::fprintf(stderr, "[Zone %d] listen on %s:%u failed: %s\n", g_zoneId, bindAddress, port, std::strerror(errno));
+			close(fd);
+			return -1;
+		}
+
+		SetNonBlocking(fd);
+		return fd;
+	}
+
+	void PrintCounters()
+	{
+		std::printf("{\"zone\":%d,\"inGame\":%zu,\"logins\":%lld,\"handoffIn\":%lld,\"handoffOut\":%lld,\"replayed\":%lld,\"duplicates\":%lld,\"rejected\":%lld}\n",
+			g_zoneId, g_inGameUsers.size(), g_counters.logins, g_counters.handoffIn, g_counters.handoffOut,
+			g_counters.replayed, g_counters.duplicates, g_counters.rejected);
+		std::fflush(stdout);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3) {
+		std::fprintf(stderr, "usage : %s <zoneId> <zoneCount>\n", argv[0]);
+		return 1;
+	}
+
+	g_zoneId = std::atoi(argv[1]);
+	g_zoneCount = std::atoi(argv[2]);
+	if ((g_zoneCount < 1) or (g_zoneCount > MAX_ZONE_COUNT) or (g_zoneId < 0) or (g_zoneId >= g_zoneCount)) {
+		std::fprintf(stderr, "zoneCount must be 1..%d and zoneId 0..zoneCount-1\n", MAX_ZONE_COUNT);
+		return 1;
+	}
+
+	const char* secret = std::getenv(ZONE_SECRET_ENV);
+	if ((nullptr == secret) or ('\0' == secret[0])) {
+		std::fprintf(stderr, "%s must be set to the gateway's secret\n", ZONE_SECRET_ENV);
+		return 1;
+	}
+	FillZoneSecret(g_zoneSecret, secret);
+
+	const char* bindAddress = std::getenv(ZONE_BIND_ENV);
+	if ((nullptr == bindAddress) or ('\0' == bindAddress[0])) {
+		bindAddress = ZONE_DEFAULT_BIND;
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+
+	int listenFd = Listen(bindAddress, static_cast<unsigned short>(ZONE_BASE_PORT + g_zoneId));
+	if (listenFd < 0) {
+		return 1;
+	}
+
+	std::fprintf(stderr, "[Zone %d] listening on %s:%d (%d zones)\n", g_zoneId, bindAddress, ZONE_BASE_PORT + g_zoneId, g_zoneCount);
+
+	// key : fd
+	std::unordered_map<int, std::unique_ptr<Connection>> connections;
+	std::vector<pollfd> fds;
+
+	// 주기마다 stdout에 JSON 한 줄 (run_zones.sh가 Zone별 Log로 남김)
+	constexpr auto REPORT_INTERVAL = std::chrono::seconds(1);
+	auto nextReport = std::chrono::steady_clock::now() + REPORT_INTERVAL;
+
+	while (true) {
+		// 1. poll 목록 구성
+		fds.clear();
+		fds.push_back(pollfd{ listenFd, POLLIN, 0 });
+
+		for (auto& [fd, connection] : connections) {
+			fds.push_back(pollfd{ fd, static_cast<short>(POLLIN | (connection->out.empty() ? 0 : POLLOUT)), 0 });
+		}
+
+		if (poll(fds.data(), fds.size(), 200) < 0) {
+			if (errno == EINTR) continue;
+
+			std::fprintf(stderr, "[Zone %d] poll failed: %s\n", g_zoneId, std::strerror(errno));
+			break;
+		}
+
+		// 2. 새 연결 (Gateway)
+		if (fds[0].revents & POLLIN) {
+			while (true) {
+				int fd = accept(listenFd, nullptr, nullptr);
+				if (fd < 0) break;
+
+				int noDelay{ 1 };
+				setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+				SetNonBlocking(fd);
+
+				auto connection = std::make_unique<Connection>();
+				connection->fd = fd;
+				connections.emplace(fd, std::move(connection));
+			}
+		}
+
+		// 3. 기존 연결 처리
+		std::vector<int> closed;
+		for (size_t i = 1; i < fds.size(); ++i) {
+			auto it = connections.find(fds[i].fd);
+			if (it == connections.end()) continue;
+
+			Connection& connection = *it->second;
+			bool alive{ true };
+
+			if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+				alive = ReadAndProcess(connection);
+			}
+
+			// 닫기 전에 LOGIN_FAIL 같은 마지막 응답은 보내 봄
+			if (not Flush(connection) or not alive) {
+				closed.push_back(connection.fd);
+			}
+		}
+
+		for (int fd : closed) {
+			CloseConnection(*connections[fd]);
+			connections.erase(fd);
+		}
+
+		auto now = std::chrono::steady_clock::now();
+		if (now >= nextReport) {
+			PrintCounters();
+			nextReport = now + REPORT_INTERVAL;
+		}
+	}
+
+	close(listenFd);
+	return 0;
+}
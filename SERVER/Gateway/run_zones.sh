@@ -0,0 +1,81 @@
+#!/usr/bin/env bash
+# Gateway + zone-stub N개를 띄우고 LoadGen을 Gateway에 붙여서 Zone Handoff 경로를 시험
+#
+# usage : ./run_zones.sh <zoneCount> [loadgen options...]
+#   ./run_zones.sh 4 --bots 500 --duration 30 --ramp linear:5 --rate 2
+# loadgen option이 없으면 Gateway / Zone만 띄우고 Ctrl+C까지 대기 (다른 Client로 접속)
+#
+# GSPG_ZONE_SECRET이 없으면 이번 실행용 임의 값 사용, GATEWAY_PORT(기본 4000)로 Gateway Port 변경
+# Zone별 Counter(JSON 한 줄 / 초)는 $LOG_DIR(기본 현재 Directory)/zone_<id>.log, Gateway Log는 gateway.log
+
+set -euo pipefail
+
+if [ $# -lt 1 ]; then
+	sed -n '2,9p' "$0"
+	exit 1
+fi
+
+ZONE_COUNT=$1
+shift
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+LOADGEN_DIR="$HERE/../../STRESS_TEST/LoadGen"
+LOG_DIR=${LOG_DIR:-.}
+GATEWAY_PORT=${GATEWAY_PORT:-4000}
+
+export GSPG_ZONE_SECRET=${GSPG_ZONE_SECRET:-$(head -c 16 /dev/urandom | od -An -tx1 | tr -d ' \n')}
+
+make -s -C "$HERE"
+if [ $# -gt 0 ]; then
+	make -s -C "$LOADGEN_DIR"
+fi
+
+PIDS=()
+cleanup() {
+	for pid in "${PIDS[@]}"; do
+		kill "$pid" 2>/dev/null || true
+	done
+	wait 2>/dev/null || true
+}
+trap cleanup EXIT INT TERM
+
+# Port가 열릴 때까지 대기 (최대 5초)
+wait_port() {
+	for _ in $(seq 50); do
+		if (exec 3<>"/dev/tcp/127.0.0.1/$1") 2>/dev/null; then
+			return 0
+		fi
+		sleep 0.1
+	done
+	echo "port $1 did not open" >&2
+	return 1
+}
+
+for ((zone = 0; zone < ZONE_COUNT; ++zone)); do
+	"$HERE/zone-stub" "$zone" "$ZONE_COUNT" > "$LOG_DIR/zone_$zone.log" &
+	PIDS+=($!)
+done
+
+# ZONE_BASE_PORT = PORT_NUM + 1 (ZoneProtocol.h)
+for ((zone = 0; zone < ZONE_COUNT; ++zone)); do
+	wait_port $((4001 + zone))
+done
+
+"$HERE/gateway" "$ZONE_COUNT" "$GATEWAY_PORT" > "$LOG_DIR/gateway.log" &
+PIDS+=($!)
+wait_port "$GATEWAY_PORT"
+
+echo "gateway on $GATEWAY_PORT, $ZONE_COUNT zones" >&2
+
+if [ $# -eq 0 ]; then
+	wait
+	exit 0
+fi
+
+"$LOADGEN_DIR/loadgen" --port "$GATEWAY_PORT" "$@"
+
+# 마지막 Counter 출력을 기다린 뒤 Zone별 합계
+sleep 1.2
+for ((zone = 0; zone < ZONE_COUNT; ++zone)); do
+	tail -n 1 "$LOG_DIR/zone_$zone.log"
+done
@@ -0,0 +1,242 @@
+// Logger Binary Sink(LOG_SINK_BINARY) 파일을 Server 텍스트 Log 형식으로 변환
+// Binary 파일 구조는 ServerCore/LogFormat.h 참고
+//
+// usage : logdecoder <binaryLog> [--thread]
+//         --thread : 각 줄 앞에 기록한 Thread id 표시
+
+#include <ctime>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../ServerCore/LogFormat.h"
+
+namespace
+{
+	constexpr int MAX_DECODE_ARGS = 255;
+
+	struct Site {
+		int			level{ 0 };
+		int			module{ 0 };
+		int			line{ 0 };
+		std::string	file;
+		std::string	fmt;
+	};
+
+	class Reader
+	{
+	public:
+		Reader(const char* path) : _ifs(path, std::ios::binary) {}
+
+	public:
+		bool IsOpen() const { return _ifs.is_open(); }
+		bool IsEnd() { return _ifs.peek() == std::char_traits<char>::eof(); }
+
+		template<typename T>
+		bool Read(T& value)
+		{
+			return static_cast<bool>(_ifs.read(reinterpret_cast<char*>(&value), sizeof(T)));
+		}
+
+		bool ReadText(std::string& text)
+		{
+			unsigned short size{ 0 };
+			if (not Read(size)) {
+				return false;
+			}
+
+			text.resize(size);
+			return (0 == size) or static_cast<bool>(_ifs.read(text.data(), size));
+		}
+
+	private:
+		std::ifstream _ifs;
+	};
+
+	void FormatTime(long long timeNs, char* buf, size_t size)
+	{
+		time_t second = static_cast<time_t>(timeNs / 1'000'000'000);
+		if (timeNs < 0 and (timeNs % 1'000'000'000) != 0) {
+			--second;
+		}
+
+		std::tm bt;
+		localtime_r(&second, &bt);
+		std::strftime(buf, size, "%Y-%m-%d %H:%M:%S", &bt);
+	}
+
+	bool DecodeSite(Reader& reader, std::vector<Site>& sites)
+	{
+		unsigned int siteId{ 0 };
+		char level{ 0 };
+		char module{ 0 };
+		int line{ 0 };
+		Site site;
+
+		if (not (reader.Read(siteId) and reader.Read(level) and reader.Read(module) and reader.Read(line)
+			and reader.ReadText(site.file) and reader.ReadText(site.fmt))) {
+			return false;
+		}
+
+		site.level = level;
+		site.module = module;
+		site.line = line;
+
+		if (siteId >= sites.size()) {
+			sites.resize(siteId + 1);
+		}
+		sites[siteId] = std::move(site);
+		return true;
+	}
+
+	bool DecodeEvent(Reader& reader, const std::vector<Site>& sites, bool showThread, std::string& out)
+	{
+		unsigned int siteId{ 0 };
+		long long timeNs{ 0 };
+		unsigned int threadId{ 0 };
+		unsigned char argCount{ 0 };
+
+		if (not (reader.Read(siteId) and reader.Read(timeNs) and reader.Read(threadId) and reader.Read(argCount))) {
+			return false;
+		}
+
+		// 1. 인자 복원. 문자열은 text 버퍼에 이어 붙이고 offset만 LogArg에 보관
+		LogArg args[MAX_DECODE_ARGS];
+		std::string text;
+		std::string value;
+		for (int i = 0; i < argCount; ++i) {
+			LogArg& arg = args[i];
+			if (not reader.Read(arg.type)) {
+				return false;
+			}
+
+			if (LOG_ARG_TEXT == arg.type) {
+				if (not reader.ReadText(value)) {
+					return false;
+				}
+				arg.textOffset = static_cast<unsigned short>(text.size());
+				text.append(value);
+				text.push_back('\0');
+			}
+			else if (not reader.Read(arg.u)) {
+				return false;
+			}
+		}
+
+		// 2. Server 텍스트 Log와 같은 형식으로 출력
+		if (siteId >= sites.size() or sites[siteId].fmt.empty()) {
+			std::fprintf(stderr, "unknown call-site id %u\n", siteId);
+			return true;
+		}
+
+		char timeText[32];
+		FormatTime(timeNs, timeText, sizeof(timeText));
+
+		if (showThread) {
+			out += '[';
+			out += std::to_string(threadId);
+			out += ']';
+		}
+
+		const Site& site = sites[siteId];
+		LogFormatter::AppendLine(out, timeText, site.level, site.file.c_str(), site.line,
+			site.fmt.c_str(), args, argCount, text.c_str());
+		return true;
+	}
+
+	bool DecodeDropped(Reader& reader, bool showThread, std::string& out)
+	{
+		long long timeNs{ 0 };
+		unsigned int threadId{ 0 };
+		unsigned long long count{ 0 };
+
+		if (not (reader.Read(timeNs) and reader.Read(threadId) and reader.Read(count))) {
+			return false;
+		}
+
+		if (showThread) {
+			out += '[';
+			out += std::to_string(threadId);
+			out += ']';
+		}
+
+		LogFormatter::AppendDropped(out, count);
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2) {
+		std::fprintf(stderr, "usage : %s <binaryLog> [--thread]\n", argv[0]);
+		return 1;
+	}
+
+	bool showThread = (argc > 2) and (0 == std::strcmp(argv[2], "--thread"));
+
+	Reader reader{ argv[1] };
+	if (not reader.IsOpen()) {
+		std::fprintf(stderr, "cannot open %s\n", argv[1]);
+		return 1;
+	}
+
+	std::vector<Site> sites;
+	std::string out;
+	long long records{ 0 };
+
+	while (not reader.IsEnd()) {
+		char tag{ 0 };
+		if (not reader.Read(tag)) {
+			break;
+		}
+
+		bool ok{ false };
+		switch (tag) {
+		case LOG_BIN_HEADER: {
+			// Server를 다시 시작하면 같은 파일에 새 Header가 붙고 Site id가 다시 0부터 시작
+			char magic[sizeof(LOG_BIN_MAGIC)];
+			unsigned int version{ 0 };
+			ok = reader.Read(magic) and reader.Read(version);
+			if (ok and ((0 != std::memcmp(magic, LOG_BIN_MAGIC, sizeof(magic))) or (version != LOG_BIN_VERSION))) {
+				std::fprintf(stderr, "unsupported log header (version %u)\n", version);
+				return 1;
+			}
+			sites.clear();
+			break;
+		}
+
+		case LOG_BIN_SITE:
+			ok = DecodeSite(reader, sites);
+			break;
+
+		case LOG_BIN_EVENT:
+			ok = DecodeEvent(reader, sites, showThread, out);
+			++records;
+			break;
+
+		case LOG_BIN_DROPPED:
+			ok = DecodeDropped(reader, showThread, out);
+			break;
+
+		default:
+			std::fprintf(stderr, "unknown record tag %d after %lld records\n", tag, records);
+			break;
+		}
+
+		if (not ok) {
+			// Server가 Block 기록 도중 종료되면 마지막 Record가 잘려 있을 수 있음
+			std::fprintf(stderr, "truncated or corrupt log after %lld records\n", records);
+			break;
+		}
+
+		if (out.size() >= (1 << 16)) {
+			std::fwrite(out.data(), 1, out.size(), stdout);
+			out.clear();
+		}
+	}
+
+	std::fwrite(out.data(), 1, out.size(), stdout);
+	return 0;
+}
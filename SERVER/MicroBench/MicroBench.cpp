@@ -0,0 +1,661 @@
+// ServerCore Hot Path Microbenchmark
+// ServerCore의 RecvBuffer / Sector / ViewQuery / AStar / Metrics 소스와 PacketFactory 필드 Builder를 SERVERCORE_PORTABLE로 그대로 빌드해서 측정
+// 입력은 모두 고정 Seed로 생성하므로 같은 Build면 같은 작업량
+//
+// usage : microbench [--map <mapdata.txt>] [--filter <substr>] [--repeat n] [--min-ms n] [--seed n]
+//                    [--out <file>] [--baseline <file>] [--threshold <percent>]
+//
+// 결과는 JSON, results 배열의 원소 하나가 한 줄이므로 두 Build 결과를 그대로 diff 가능
+// --baseline을 주면 이전 결과와 nsPerOp를 비교해서 threshold% 이상 느려진 항목이 있으면 exit 1
+
+#include "../ServerCore/pch.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string_view>
+
+#if __has_include(<tbb/concurrent_priority_queue.h>)
+#include <tbb/concurrent_priority_queue.h>
+#define MICROBENCH_HAS_TBB 1
+#endif
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+	using NavigationMap = std::array<std::array<bool, MAP_SIZE>, MAP_SIZE>;
+
+	struct Options {
+		std::string mapPath{ "../GameServer/mapdata.txt" };
+		std::string filter;
+		std::string outPath;
+		std::string baselinePath;
+		int repeat{ 5 };
+		int minMs{ 50 };
+		unsigned int seed{ 1 };
+		double threshold{ 10.0 };
+	};
+
+	struct BenchResult {
+		std::string name;
+		std::string params;
+		long long iterations{ 0 };
+		double nsPerOp{ 0.0 };		// repeat 중 중앙값
+		double minNs{ 0.0 };
+		double maxNs{ 0.0 };
+	};
+
+	// 결과를 버리지 않도록 누적. 최적화로 측정 대상이 사라지는 것 방지
+	volatile size_t g_sink{ 0 };
+
+	void Consume(size_t value)
+	{
+		g_sink = g_sink + value;
+	}
+
+	class BenchRunner
+	{
+	public:
+		explicit BenchRunner(const Options& options) : _options(options) {}
+
+		bool IsSelected(const std::string& name) const
+		{
+			return _options.filter.empty() or (name.find(_options.filter) != std::string::npos);
+		}
+
+		// body(iterations)는 작업을 iterations번 수행. 한 번 실행이 minMs 이상 걸리도록 iterations를 늘린 뒤 repeat번 측정
+		template<typename Func>
+		void Run(const std::string& name, const std::string& params, Func&& body)
+		{
+			if (not IsSelected(name)) {
+				return;
+			}
+
+			// 1. Warm-up 겸 iterations 결정
+			long long iterations{ 1 };
+			while (true) {
+				double elapsedNs = Measure(body, iterations);
+				if ((elapsedNs >= _options.minMs * 1e6) or (iterations >= (1LL << 40))) {
+					break;
+				}
+
+				double scale = (elapsedNs > 0.0) ? (_options.minMs * 1e6 * 1.2 / elapsedNs) : 10.0;
+				iterations = static_cast<long long>(iterations * std::clamp(scale, 2.0, 100.0));
+			}
+
+			// 2. 측정
+			std::vector<double> samples;
+			for (int i = 0; i < _options.repeat; ++i) {
+				samples.push_back(Measure(body, iterations) / static_cast<double>(iterations));
+			}
+			std::sort(samples.begin(), samples.end());
+
+			BenchResult result{ name, params, iterations, samples[samples.size() / 2], samples.front(), samples.back() };
+			std::fprintf(stderr, "%-32s %-24s %12.1f ns/op\n", name.c_str(), params.c_str(), result.nsPerOp);
+			_results.push_back(std::move(result));
+		}
+
+		const std::vector<BenchResult>& GetResults() const { return _results; }
+
+	private:
+		template<typename Func>
+		static double Measure(Func& body, long long iterations)
+		{
+			auto start = Clock::now();
+			body(iterations);
+			return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+		}
+
+	private:
+		const Options& _options;
+		std::vector<BenchResult> _results;
+	};
+
+	// ------------------------------------------------------------------
+	// RecvBuffer
+	// ------------------------------------------------------------------
+	void BenchRecvBuffer(BenchRunner& runner)
+	{
+		// Packet 하나 Write 후 Read. 4096 Ring을 계속 돌아서 경계 Wrap 포함
+		runner.Run("recvbuffer.write_read", "bytes=" + std::to_string(sizeof(CS_MOVE_PACKET)), [](long long iterations)
+			{
+				RecvBuffer buffer;
+				CS_MOVE_PACKET packet{ sizeof(CS_MOVE_PACKET), CS_MOVE, 0, 0 };
+				char out[sizeof(CS_MOVE_PACKET)];
+
+				for (long long i = 0; i < iterations; ++i) {
+					buffer.Write(reinterpret_cast<const char*>(&packet), sizeof(packet));
+					buffer.Read(out, sizeof(out));
+				}
+				Consume(static_cast<size_t>(out[1]));
+			});
+
+		// Recv 한 번에 여러 Packet이 들어온 경우 : 가득 채운 뒤 Packet 단위로 비움
+		runner.Run("recvbuffer.fill_drain", "bytes=" + std::to_string(sizeof(CS_CHAT_PACKET)), [](long long iterations)
+			{
+				RecvBuffer buffer;
+				CS_CHAT_PACKET packet{ sizeof(CS_CHAT_PACKET), CS_CHAT, "hello" };
+				char out[sizeof(CS_CHAT_PACKET)];
+
+				long long done{ 0 };
+				while (done < iterations) {
+					int written{ 0 };
+					while ((done + written < iterations) and buffer.Write(reinterpret_cast<const char*>(&packet), sizeof(packet))) {
+						++written;
+					}
+					for (int i = 0; i < written; ++i) {
+						buffer.Read(out, sizeof(out));
+					}
+					done += written;
+				}
+				Consume(static_cast<size_t>(out[1]));
+			});
+	}
+
+	// ------------------------------------------------------------------
+	// PacketFactory : GameObject Builder가 호출하는 필드 Builder 그대로 (Packet 채우기 + Serialize)
+	// ------------------------------------------------------------------
+	void BenchPacketFactory(BenchRunner& runner)
+	{
+		runner.Run("packet.build", "type=SC_MOVE_OBJECT", [](long long iterations)
+			{
+				for (long long i = 0; i < iterations; ++i) {
+					Consume(PacketFactory::BuildMovePacket(static_cast<int>(i), static_cast<short>(i & 1023), 7, static_cast<unsigned int>(i)).size());
+				}
+			});
+
+		runner.Run("packet.build", "type=SC_ADD_OBJECT", [](long long iterations)
+			{
+				constexpr char OBJECT_MONSTER = 1;		// ObjectType::MONSTER (GameObject.h는 Portable Build에 없음)
+				const std::string name{ "Monster" };
+				for (long long i = 0; i < iterations; ++i) {
+					Consume(PacketFactory::BuildAddPacket(static_cast<int>(i), static_cast<short>(i & 1023), 7, OBJECT_MONSTER, 3, 0, name).size());
+				}
+			});
+
+		runner.Run("packet.build", "type=SC_CHAT", [](long long iterations)
+			{
+				const std::string message{ "benchmark chat message" };
+				for (long long i = 0; i < iterations; ++i) {
+					Consume(PacketFactory::BuildChatPacket(static_cast<int>(i), message.c_str()).size());
+				}
+			});
+
+		runner.Run("packet.deserialize", "type=CS_MOVE", [](long long iterations)
+			{
+				CS_MOVE_PACKET source{ sizeof(CS_MOVE_PACKET), CS_MOVE, 2, 12345 };
+				std::vector<char> buf = PacketFactory::Serialize(source);
+
+				for (long long i = 0; i < iterations; ++i) {
+					buf[2] = static_cast<char>(i & 3);
+					Consume(PacketFactory::Deserialize<CS_MOVE_PACKET>(buf).direction);
+				}
+			});
+	}
+
+	// ------------------------------------------------------------------
+	// Sector / ViewList
+	// ------------------------------------------------------------------
+	// ViewList 측정용 World : 10 x 10 Sector 영역에 Sector당 density개 Object
+	struct ViewWorld {
+		static constexpr int AREA_SECTORS = 10;
+		static constexpr int AREA = AREA_SECTORS * SECTOR_SIZE;
+
+		std::unique_ptr<SectorGrid> sectors{ std::make_unique<SectorGrid>() };
+		std::vector<std::pair<short, short>> positions;
+
+		ViewWorld(int density, std::mt19937& rng)
+		{
+			std::uniform_int_distribution<int> coord(0, AREA - 1);
+
+			int objectCount = density * AREA_SECTORS * AREA_SECTORS;
+			positions.resize(objectCount);
+			for (int id = 0; id < objectCount; ++id) {
+				positions[id] = { static_cast<short>(coord(rng)), static_cast<short>(coord(rng)) };
+				auto [sx, sy] = Sector::GetSector(positions[id].first, positions[id].second);
+				(*sectors)[sx][sy].AddObject(id);
+			}
+		}
+
+		// ViewManager::CollectRegionViewList와 같은 ViewQuery 호출. Region Mirror 대신 SectorGrid, FindObject 대신 Position 배열 조회
+		std::unordered_set<int> CollectViewList(int selfId, int x, int y) const
+		{
+			return ViewQuery::FilterInView(ViewQuery::CollectSectorObjects(*sectors, x, y), selfId, x, y,
+				[this](int id, short& tx, short& ty)
+				{
+					tx = positions[id].first;
+					ty = positions[id].second;
+					return true;
+				});
+		}
+	};
+
+	void BenchSector(BenchRunner& runner, unsigned int seed)
+	{
+		for (int density : { 10, 100, 1000 }) {
+			runner.Run("sector.add_remove", "objects=" + std::to_string(density), [density](long long iterations)
+				{
+					Sector sector;
+					for (int id = 0; id < density; ++id) {
+						sector.AddObject(id);
+					}
+
+					for (long long i = 0; i < iterations; ++i) {
+						int id = density + static_cast<int>(i & 1023);
+						sector.AddObject(id);
+						sector.RemoveObject(id);
+					}
+					Consume(sector.Contains(0));
+				});
+
+			runner.Run("sector.collect", "objects=" + std::to_string(density), [density](long long iterations)
+				{
+					Sector sector;
+					for (int id = 0; id < density; ++id) {
+						sector.AddObject(id);
+					}
+
+					for (long long i = 0; i < iterations; ++i) {
+						std::unordered_set<int> out;
+						sector.CollectObject(out);
+						Consume(out.size());
+					}
+				});
+		}
+
+		for (int density : { 2, 10, 50 }) {
+			if (not runner.IsSelected("view.collect") and not runner.IsSelected("view.sync")) {
+				break;
+			}
+
+			std::mt19937 rng{ seed };
+			ViewWorld world{ density, rng };
+
+			// 시야 Sector가 모두 채워진 영역 안쪽의 관찰자 위치
+			std::uniform_int_distribution<int> inner(SECTOR_SIZE, ViewWorld::AREA - SECTOR_SIZE - 1);
+			std::uniform_int_distribution<int> direction(0, 3);
+			constexpr int SAMPLE_COUNT = 256;
+
+			struct Observer { int x, y, nx, ny; };
+			std::vector<Observer> observers(SAMPLE_COUNT);
+			for (Observer& o : observers) {
+				o.x = inner(rng);
+				o.y = inner(rng);
+
+				// 한 칸 이동 (CS_MOVE)
+				static constexpr int dx[4]{ 0, 0, -1, 1 };
+				static constexpr int dy[4]{ -1, 1, 0, 0 };
+				int dir = direction(rng);
+				o.nx = o.x + dx[dir];
+				o.ny = o.y + dy[dir];
+			}
+
+			std::string params = "perSector=" + std::to_string(density);
+
+			runner.Run("view.collect", params, [&](long long iterations)
+				{
+					for (long long i = 0; i < iterations; ++i) {
+						const Observer& o = observers[i % SAMPLE_COUNT];
+						Consume(world.CollectViewList(-1, o.x, o.y).size());
+					}
+				});
+
+			std::vector<std::pair<std::unordered_set<int>, std::unordered_set<int>>> viewLists;
+			for (const Observer& o : observers) {
+				viewLists.emplace_back(world.CollectViewList(-1, o.x, o.y), world.CollectViewList(-1, o.nx, o.ny));
+			}
+
+			runner.Run("view.sync", params, [&](long long iterations)
+				{
+					for (long long i = 0; i < iterations; ++i) {
+						const auto& [oldViewList, newViewList] = viewLists[i % SAMPLE_COUNT];
+						ViewListDiff viewListDiff = ViewQuery::Diff(oldViewList, newViewList);
+						Consume(viewListDiff.addViewList.size() + viewListDiff.moveViewList.size() + viewListDiff.removeViewList.size());
+					}
+				});
+		}
+	}
+
+	// ------------------------------------------------------------------
+	// AStar (실제 mapdata.txt)
+	// ------------------------------------------------------------------
+	// Service::LoadMap과 같은 형식 : '1'이 이동 가능
+	bool LoadMap(const std::string& path, NavigationMap& map)
+	{
+		std::ifstream in{ path };
+		if (not in) {
+			return false;
+		}
+
+		std::string line;
+		int y{ 0 };
+		while ((y < MAP_SIZE) and std::getline(in, line)) {
+			if (line.length() < MAP_SIZE) {
+				return false;
+			}
+
+			for (int x = 0; x < MAP_SIZE; ++x) {
+				map[y][x] = (line[x] == '1');
+			}
+			++y;
+		}
+		return y == MAP_SIZE;
+	}
+
+	void BenchAStar(BenchRunner& runner, const Options& options)
+	{
+		if (not runner.IsSelected("astar")) {
+			return;
+		}
+
+		auto map = std::make_unique<NavigationMap>();
+		if (not LoadMap(options.mapPath, *map)) {
+			std::fprintf(stderr, "map load failed: %s (astar skipped)\n", options.mapPath.c_str());
+			return;
+		}
+
+		// 거리별로 경로가 존재하는 (start, goal) 쌍을 고정 Seed로 뽑음
+		for (int distance : { 8, 32, 128 }) {
+			std::mt19937 rng{ options.seed };
+			std::uniform_int_distribution<int> coord(distance, MAP_SIZE - distance - 1);
+			std::uniform_int_distribution<int> offset(-distance, distance);
+
+			constexpr int PAIR_COUNT = 32;
+			std::vector<std::pair<APos, APos>> pairs;
+			size_t pathLength{ 0 };
+
+			for (int attempt = 0; (attempt < 100000) and (pairs.size() < PAIR_COUNT); ++attempt) {
+				APos start{ static_cast<short>(coord(rng)), static_cast<short>(coord(rng)) };
+				APos goal{ static_cast<short>(start.x + offset(rng)), static_cast<short>(start.y + offset(rng)) };
+				if ((not (*map)[start.y][start.x]) or (not (*map)[goal.y][goal.x]) or (start == goal)) {
+					continue;
+				}
+
+				auto path = AStar(*map, start, goal);
+				if (path.empty()) {
+					continue;
+				}
+
+				pathLength += path.size();
+				pairs.emplace_back(start, goal);
+			}
+
+			if (pairs.empty()) {
+				continue;
+			}
+
+			std::string params = "distance=" + std::to_string(distance) + ",avgPath=" + std::to_string(pathLength / pairs.size());
+			runner.Run("astar.path", params, [&](long long iterations)
+				{
+					for (long long i = 0; i < iterations; ++i) {
+						const auto& [start, goal] = pairs[i % pairs.size()];
+						Consume(AStar(*map, start, goal).size());
+					}
+				});
+		}
+	}
+
+	// ------------------------------------------------------------------
+	// Timer Queue : Server는 concurrency::concurrent_priority_queue<Event> (PPL)
+	// Linux에서는 API가 같은 tbb::concurrent_priority_queue, 없으면 mutex + std::priority_queue
+	// ------------------------------------------------------------------
+#ifdef MICROBENCH_HAS_TBB
+	using TimerQueue = tbb::concurrent_priority_queue<Event>;
+	constexpr const char* TIMER_QUEUE_NAME = "tbb";
+#else
+	class TimerQueue
+	{
+	public:
+		void push(const Event& event)
+		{
+			std::lock_guard lock{ _lock };
+			_queue.push(event);
+		}
+
+		bool try_pop(Event& event)
+		{
+			std::lock_guard lock{ _lock };
+			if (_queue.empty()) {
+				return false;
+			}
+			event = _queue.top();
+			_queue.pop();
+			return true;
+		}
+
+	private:
+		std::mutex _lock;
+		std::priority_queue<Event> _queue;
+	};
+	constexpr const char* TIMER_QUEUE_NAME = "std";
+#endif
+
+	void BenchTimerQueue(BenchRunner& runner, unsigned int seed)
+	{
+		// pending개의 Event가 쌓인 상태에서 push 한 번 + pop 한 번 (Timer Thread의 정상 상태)
+		for (int pending : { 1000, 100000 }) {
+			std::string params = std::string("impl=") + TIMER_QUEUE_NAME + ",pending=" + std::to_string(pending);
+			runner.Run("timer.push_pop", params, [pending, seed](long long iterations)
+				{
+					std::mt19937 rng{ seed };
+					std::uniform_int_distribution<int> delayMs(0, 5000);
+					auto base = std::chrono::high_resolution_clock::now();
+
+					TimerQueue queue;
+					for (int i = 0; i < pending; ++i) {
+						queue.push(Event{ i, base + std::chrono::milliseconds(delayMs(rng)), EV_NPC_TICK, 0 });
+					}
+
+					Event event;
+					for (long long i = 0; i < iterations; ++i) {
+						queue.push(Event{ static_cast<int>(i), base + std::chrono::milliseconds(delayMs(rng)), EV_HEAL, 0 });
+						queue.try_pop(event);
+					}
+					Consume(static_cast<size_t>(event.objId));
+				});
+		}
+	}
+
+	// ------------------------------------------------------------------
+	// AtomicQueue
+	// ------------------------------------------------------------------
+	void BenchAtomicQueue(BenchRunner& runner)
+	{
+		runner.Run("atomicqueue.push_pop", "threads=1", [](long long iterations)
+			{
+				AtomicQueue<int> queue;
+				std::shared_ptr<int> value;
+				for (long long i = 0; i < iterations; ++i) {
+					queue.Push(static_cast<int>(i));
+					queue.tryPop(value);
+				}
+				Consume(static_cast<size_t>(*value));
+			});
+
+		// 여러 Producer, Consumer 하나 (AtomicQueue의 사용 방식). iterations는 전체 push 수
+		for (int producers : { 2, 4 }) {
+			runner.Run("atomicqueue.mpsc", "producers=" + std::to_string(producers), [producers](long long iterations)
+				{
+					AtomicQueue<int> queue;
+					long long perProducer = std::max(1LL, iterations / producers);
+
+					std::vector<std::thread> threads;
+					for (int p = 0; p < producers; ++p) {
+						threads.emplace_back([&queue, perProducer]()
+							{
+								for (long long i = 0; i < perProducer; ++i) {
+									queue.Push(static_cast<int>(i));
+								}
+							});
+					}
+
+					long long popped{ 0 };
+					std::shared_ptr<int> value;
+					while (popped < perProducer * producers) {
+						if (queue.tryPop(value)) {
+							++popped;
+						}
+					}
+
+					for (std::thread& thread : threads) {
+						thread.join();
+					}
+					Consume(static_cast<size_t>(popped));
+				});
+		}
+	}
+
+	// ------------------------------------------------------------------
+	// JSON
+	// ------------------------------------------------------------------
+	std::string GetCompilerName()
+	{
+#if defined(__clang__)
+		return "clang " __clang_version__;
+#elif defined(__GNUC__)
+		return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+		return "msvc " + std::to_string(_MSC_VER);
+#else
+		return "unknown";
+#endif
+	}
+
+	std::string ToJson(const std::vector<BenchResult>& results, const Options& options)
+	{
+		char buf[512];
+		std::string out = "{\n";
+		out += "\"compiler\":\"" + GetCompilerName() + "\",\n";
+		out += "\"seed\":" + std::to_string(options.seed) + ",\n";
+		out += "\"repeat\":" + std::to_string(options.repeat) + ",\n";
+		out += "\"results\":[\n";
+
+		for (size_t i = 0; i < results.size(); ++i) {
+			const BenchResult& r = results[i];
+			std::snprintf(buf, sizeof(buf),
+				"{\"name\":\"%s\",\"params\":\"%s\",\"iterations\":%lld,\"nsPerOp\":%.2f,\"minNs\":%.2f,\"maxNs\":%.2f}%s\n",
+				r.name.c_str(), r.params.c_str(), r.iterations, r.nsPerOp, r.minNs, r.maxNs, (i + 1 < results.size()) ? "," : "");
+			out += buf;
+		}
+
+		out += "]\n}\n";
+		return out;
+	}
+
+	// ToJson이 쓴 형식만 읽음 : 한 줄에 결과 하나
+	std::map<std::string, double> LoadBaseline(const std::string& path)
+	{
+		std::map<std::string, double> baseline;
+		std::ifstream in{ path };
+
+		auto field = [](const std::string& line, const std::string& key) -> std::string
+			{
+				std::string pattern = "\"" + key + "\":";
+				size_t pos = line.find(pattern);
+				if (pos == std::string::npos) {
+					return {};
+				}
+
+				pos += pattern.size();
+				if (line[pos] == '"') {
+					size_t end = line.find('"', pos + 1);
+					return line.substr(pos + 1, end - pos - 1);
+				}
+				size_t end = line.find_first_of(",}", pos);
+				return line.substr(pos, end - pos);
+			};
+
+		std::string line;
+		while (std::getline(in, line)) {
+			std::string name = field(line, "name");
+			std::string nsPerOp = field(line, "nsPerOp");
+			if (name.empty() or nsPerOp.empty()) {
+				continue;
+			}
+			baseline[name + " " + field(line, "params")] = std::atof(nsPerOp.c_str());
+		}
+		return baseline;
+	}
+
+	// threshold% 이상 느려진 항목 수
+	int CompareBaseline(const std::vector<BenchResult>& results, const Options& options)
+	{
+		std::map<std::string, double> baseline = LoadBaseline(options.baselinePath);
+		if (baseline.empty()) {
+			std::fprintf(stderr, "baseline empty or unreadable: %s\n", options.baselinePath.c_str());
+			return 0;
+		}
+
+		int regressions{ 0 };
+		std::fprintf(stderr, "\n%-32s %-24s %12s %12s %8s\n", "name", "params", "base ns", "now ns", "delta");
+		for (const BenchResult& r : results) {
+			auto it = baseline.find(r.name + " " + r.params);
+			if ((it == baseline.end()) or (it->second <= 0.0)) {
+				continue;
+			}
+
+			double delta = (r.nsPerOp - it->second) * 100.0 / it->second;
+			bool regressed = delta >= options.threshold;
+			regressions += regressed ? 1 : 0;
+
+			std::fprintf(stderr, "%-32s %-24s %12.1f %12.1f %+7.1f%%%s\n",
+				r.name.c_str(), r.params.c_str(), it->second, r.nsPerOp, delta, regressed ? "  REGRESSION" : "");
+		}
+		return regressions;
+	}
+
+	bool ParseOptions(int argc, char* argv[], Options& options)
+	{
+		for (int i = 1; i < argc; ++i) {
+			std::string_view arg{ argv[i] };
+			bool hasValue = (i + 1 < argc);
+
+			if ((arg == "--map") and hasValue) options.mapPath = argv[++i];
+			else if ((arg == "--filter") and hasValue) options.filter = argv[++i];
+			else if ((arg == "--out") and hasValue) options.outPath = argv[++i];
+			else if ((arg == "--baseline") and hasValue) options.baselinePath = argv[++i];
+			else if ((arg == "--repeat") and hasValue) options.repeat = std::max(1, std::atoi(argv[++i]));
+			else if ((arg == "--min-ms") and hasValue) options.minMs = std::max(1, std::atoi(argv[++i]));
+			else if ((arg == "--seed") and hasValue) options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+			else if ((arg == "--threshold") and hasValue) options.threshold = std::atof(argv[++i]);
+			else {
+				std::fprintf(stderr,
+					"usage: microbench [--map <mapdata.txt>] [--filter <substr>] [--repeat n] [--min-ms n] [--seed n]\n"
+					"                  [--out <file>] [--baseline <file>] [--threshold <percent>]\n");
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (not ParseOptions(argc, argv, options)) {
+		return 2;
+	}
+
+	BenchRunner runner{ options };
+	BenchRecvBuffer(runner);
+	BenchPacketFactory(runner);
+	BenchSector(runner, options.seed);
+	BenchAStar(runner, options);
+	BenchTimerQueue(runner, options.seed);
+	BenchAtomicQueue(runner);
+
+	std::string json = ToJson(runner.GetResults(), options);
+	if (options.outPath.empty()) {
+		std::fputs(json.c_str(), stdout);
+	}
+	else {
+		std::ofstream{ options.outPath } << json;
+	}
+
+	if (not options.baselinePath.empty()) {
+		return (CompareBaseline(runner.GetResults(), options) > 0) ? 1 : 0;
+	}
+	return 0;
+}
@@ -1,13 +1,16 @@
 #include "pch.h"
 #include "AStar.h"
 
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_NPC
+
 int Heuristic(const APos& a, const APos& b)
 {
-	// ư Ÿ
+	// 맨해튼 거리
 	return std::abs(a.x - b.x) + std::abs(a.y - b.y);
 }
 
-// node parent 󰡸鼭 ü θ path ְ return
+// node의 parent를 따라가면서 전체 경로를 path에 넣고 return
 std::deque<APos> ReconstructPath(NodePtr node)
 {
 	std::deque<APos> path;
@@ -21,16 +24,18 @@ std::deque<APos> ReconstructPath(NodePtr node)
 
 std::deque<APos> AStar(std::array<std::array<bool, MAP_SIZE>, MAP_SIZE>& map, APos start, APos goal)
 {
-	// priority_queue 켱 ť (켱  Һ pop)
+	PROFILE_ZONE("AStar");
+
+	// priority_queue는 우선순위 큐 (우선순위가 높은 원소부터 pop)
 	std::priority_queue<NodePtr, std::vector<NodePtr>, Compare> openList;
 
-	// ̹ Ž Ϸ 带 true ǥϿ ߺ 湮,   
+	// 이미 탐색 완료된 노드를 true로 표시하여 중복 방문, 무한 루프 방지
 	std::unordered_set<APos> closed;
 
-	// gCost س container
+	// gCost를 저장해놓는 container
 	std::unordered_map<APos, int> gScore;
 	
-	//   
+	// 시작 노드 설정
 	auto startNode = std::make_shared<Node>();
 	startNode->pos = start;
 	startNode->gCost = 0;
@@ -45,23 +50,24 @@ std::deque<APos> AStar(std::array<std::array<bool, MAP_SIZE>, MAP_SIZE>& map, AP
 		NodePtr current = openList.top();
 		openList.pop();
 
-		// ̹ ó  ǳʶٱ
+		// 이미 처리된 노드는 건너뛰기
 		if (closed.contains(current->pos)) {
 			continue;
 		}
 
-		// goal 
+		// goal에 도착했으면
 		if (current->pos == goal) {
 			// path return
+			Metrics::Record(METRIC_ASTAR_EXPANSIONS, static_cast<long long>(closed.size()));
 			return ReconstructPath(current);
 		}
 
-		//  带 true 
+		// 현재 노드를 true로 설정
 		closed.insert(current->pos);
 
-		// ¿  ˻
+		// 상하좌우 모두 검사
 		for (const APos& dir : directions) {
-			APos next = { current->pos.x + dir.x, current->pos.y + dir.y };
+			APos next = { static_cast<short>(current->pos.x + dir.x), static_cast<short>(current->pos.y + dir.y) };
 			if ((next.x < 0) or (next.x >= MAP_SIZE) or (next.y < 0) or (next.y >= MAP_SIZE)) {
 				continue;
 			}
@@ -70,13 +76,13 @@ std::deque<APos> AStar(std::array<std::array<bool, MAP_SIZE>, MAP_SIZE>& map, AP
 				continue;
 			}
 
-			// ̹   ΰ ϵǾ  ǳʶٱ
+			// 이미 더 나은 경로가 기록되어 있으면 건너뛰기
 			int tentativeG = current->gCost + 1;
 			if ((gScore.contains(next)) and (tentativeG >= gScore[next])) {
 				continue;
 			}
 
-			// ο  ߰   Ʈ
+			// 새로운 경로 발견 시 노드 업데이트
 			auto neighbor = std::make_shared<Node>();
 			neighbor->pos = next;
 			neighbor->gCost = current->gCost + 1;
@@ -88,7 +94,8 @@ std::deque<APos> AStar(std::array<std::array<bool, MAP_SIZE>, MAP_SIZE>& map, AP
 		}
 	}
 
-	// ΰ    ȯ
+	// 경로가 없으면 빈 벡터 반환
+	Metrics::Record(METRIC_ASTAR_EXPANSIONS, static_cast<long long>(closed.size()));
 	LOG_WRN("AStar failed to find path from (%d, %d) to (%d, %d)", start.x, start.y, goal.x, goal.y);
 	return {};
 }
\ No newline at end of file
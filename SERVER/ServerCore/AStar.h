@@ -20,10 +20,10 @@ struct Node {
 	APos pos;
 	std::shared_ptr<Node> parent;
 
-	// ݱ  ̵ Ÿ
+	// 지금까지 실제로 이동한 거리
 	int gCost{ 0 };
 
-	// ǥ  Ÿ(޸ƽ)
+	// 목표까지의 예측 거리(휴리스틱)
 	int hCost{ 0 };
 
 	// fCost = gCost + hCost
@@ -39,7 +39,7 @@ struct Compare {
 	}
 };
 
-// node parent 󰡸鼭 ü θ path ְ return
+// node의 parent를 따라가면서 전체 경로를 path에 넣고 return
 std::deque<APos> ReconstructPath(NodePtr node);
 
 class Sector;
@@ -18,18 +18,20 @@ void CombatManager::HandlePlayerAttack(const std::shared_ptr<GameSession>& playe
 
 bool CombatManager::CanAttack(int attackerId, float cooldownSec)
 {
-	using namespace std::chrono;
-
 	auto service = _service.lock();
 	if (nullptr == service) {
 		return false;
 	}
 
 	auto attacker = service->FindObject(attackerId);
-	auto now = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+	if (nullptr == attacker) {
+		return false;
+	}
+
+	auto now = GameClock::NowMs();
 	auto lastAttackTime = attacker->_lastAttackTime;
 
-	//    ʾ
+	// 한 번도 공격하지 않았으면
 	if (lastAttackTime == 0) {
 		return true;
 	}
@@ -40,15 +42,17 @@ bool CombatManager::CanAttack(int attackerId, float cooldownSec)
 
 void CombatManager::RegisterAttackTime(int attackerId)
 {
-	using namespace std::chrono;
-
 	auto service = _service.lock();
 	if (nullptr == service) {
 		return;
 	}
 
 	auto attacker = service->FindObject(attackerId);
-	attacker->_lastAttackTime = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+	if (nullptr == attacker) {
+		return;
+	}
+
+	attacker->_lastAttackTime = GameClock::NowMs();
 }
 
 void CombatManager::HandleDamage_PlayerMoved(const std::shared_ptr<GameSession>& player)
@@ -66,7 +70,7 @@ void CombatManager::HandleDamage_PlayerMoved(const std::shared_ptr<GameSession>&
 	for (auto& monsterId : monsters) {
 		auto monster = service->FindObject(monsterId);
 
-		if (not monster->IsAlive()) {
+		if ((nullptr == monster) or (not monster->IsAlive())) {
 			continue;
 		}
 
@@ -77,7 +81,11 @@ void CombatManager::HandleDamage_PlayerMoved(const std::shared_ptr<GameSession>&
 
 		int damage = monster->GetDamage();
 
-		DamageToPlayer(player, damage, monster->GetId());
+		// Region Thread에서 실행되므로 Player 상태 변경은 Session Strand로 넘김
+		player->Post([this, player, damage, monsterId = monster->GetId()]()
+			{
+				DamageToPlayer(player, damage, monsterId);
+			});
 		RegisterAttackTime(monster->GetId());
 	}
 }
@@ -107,21 +115,18 @@ void CombatManager::HandleDamage_PlayerAttacked(const std::shared_ptr<GameSessio
 		{ 1,  0 }
 	} };
 
-	auto visible = service->CollectViewList(player);
+	// Session Strand 안이므로 viewList를 그대로 사용 (시야 밖 Monster는 공격 대상이 아님)
+	const auto& visible = player->GetViewList();
 	for (const auto& [dx, dy] : directions) {
 		short nx = player->GetX() + dx;
 		short ny = player->GetY() + dy;
 
 		for (int id : visible) {
 			auto object = service->FindObject(id);
-			if (object->GetType() == ObjectType::MONSTER) {
-				if (nullptr == object) continue;
-				if ((nx == object->GetX()) and (ny == object->GetY()) and (object->IsAlive())) {
-					auto snapShot = player->GetViewList();
-					if (snapShot->contains(object->GetId())) {
-						targets.push_back(static_pointer_cast<Monster>(object));
-					}
-				}
+			if ((nullptr == object) or (object->GetType() != ObjectType::MONSTER)) continue;
+
+			if ((nx == object->GetX()) and (ny == object->GetY()) and (object->IsAlive())) {
+				targets.push_back(static_pointer_cast<Monster>(object));
 			}
 		}
 	}
@@ -153,7 +158,7 @@ void CombatManager::HandleDamage_MonsterMoved(const std::shared_ptr<Monster>& mo
 	for (auto& playerId : players) {
 		auto player = service->FindObject(playerId);
 
-		if (not player->IsAlive()) {
+		if ((nullptr == player) or (not player->IsAlive())) {
 			continue;
 		}
 
@@ -164,7 +169,12 @@ void CombatManager::HandleDamage_MonsterMoved(const std::shared_ptr<Monster>& mo
 
 		int damage = monster->GetDamage();
 
-		DamageToPlayer(static_pointer_cast<GameSession>(player), damage, monster->GetId());
+		// Player 상태는 해당 Session Strand에서만 변경
+		auto target = static_pointer_cast<GameSession>(player);
+		target->Post([this, target, damage, monsterId = monster->GetId()]()
+			{
+				DamageToPlayer(target, damage, monsterId);
+			});
 		RegisterAttackTime(monster->GetId());
 	}
 }
@@ -206,17 +216,17 @@ void CombatManager::HandleMonsterDeath(const std::shared_ptr<Monster>& monster,
 	}
 
 	if (nullptr != killer) {
-		// View, Quest ó
+		// View, Quest 처리
 		service->OnNpcDeath(monster, killer);
 
-		// Temp : 30% Ȯ HpPotion Get
-		if (rand() % 100 < 30) {
+		// Temp : 30% 확률로 HpPotion Get
+		if (GameRandom::Next(0, 99) < 30) {
 			service->UserGetItem(killer, HpPotion, 1);
 			killer->GetInventory()->AddItem(HpPotion, 1);
 			killer->Send(PacketFactory::BuildAddItemPacket(HpPotion, 1));
 		}
 
-		// Exp 
+		// Exp 배분
 		int exp = monster->GetExp();
 
 		if (auto party = killer->GetParty()) {
@@ -21,6 +21,8 @@
 #include <atomic>
 #include <mutex>
 #include <shared_mutex>
+#include <condition_variable>
+#include <deque>
 #include <algorithm>
 #include <type_traits>
 #include <chrono>
@@ -28,27 +30,45 @@
 #include <functional>
 #include <codecvt>
 #include <future>
+#include <string_view>
 
 #include "RecvBuffer.h"
 #include "AtomicQueue.h"
+#include "Metrics.h"
+#include "GameClock.h"
+#include "GameRandom.h"
+#include "PacketRecorder.h"
+#include "Profiler.h"
+#include "Watchdog.h"
 
 #include "ExpOver.h"
 #include "IocpCore.h"
+#include "JobScheduler.h"
+#include "Strand.h"
+#include "TimerEvent.h"
 
 #include "Service.h"
 #include "Session.h"
 #include "Listener.h"
 #include "Sector.h"
+#include "ViewQuery.h"
+#include "Region.h"
+#include "RegionManager.h"
 #include "ViewManager.h"
 #include "GameObject.h"
 #include "Monster.h"
+#include "MonsterArena.h"
 #include "Npc.h"
 #include "MonsterBehavior.h"
+#include "SpawnTable.h"
+#include "ScriptManager.h"
+#include "NpcSystem.h"
 #include "ObjectManager.h"
 #include "CombatManager.h"
 
 #include "AStar.h"
 #include "ChatManager.h"
+#include "protocol.h"
 #include "PacketFactory.h"
 
 #include "Party.h"
@@ -59,10 +79,17 @@
 #include "QuestManager.h"	
 #include "QuestType.h"
 
+#include "LogFormat.h"
+#include "LogRing.h"
 #include "Logger.h"
+#include "IStorage.h"
+#include "DBConnectionPool.h"
 #include "DBManager.h"
+#include "SqliteStorage.h"
+#include "DBExecutor.h"
+#include "PlayerCache.h"
 #include "Macro.h"
-#include "protocol.h"
+#include "ZoneProtocol.h"
 
 #include "include/lua.hpp"
 
@@ -70,6 +97,10 @@
 #pragma comment(lib, "MSWSock.LIB")
 #pragma comment(lib, "lua54.lib")
 
+#ifdef USE_SQLITE_STORAGE
+#pragma comment(lib, "sqlite3.lib")
+#endif
+
 constexpr short SERVER_PORT = 4000;
 
 using ServicePtr = std::shared_ptr<class Service>;
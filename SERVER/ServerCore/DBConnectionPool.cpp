@@ -0,0 +1,200 @@
+#include "pch.h"
+#include "DBConnectionPool.h"
+
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_DB
+
+DBConnectionPool::~DBConnectionPool()
+{
+	Shutdown();
+}
+
+bool DBConnectionPool::Init(SQLHENV hEnv, const std::wstring& database, int poolSize, int statementCount)
+{
+	std::lock_guard lock{ _mutex };
+
+	if (_running) {
+		LOG_WRN("[DBConnectionPool] already initialized");
+		return false;
+	}
+
+	_hEnv = hEnv;
+	_database = database;
+
+	poolSize = std::max(1, poolSize);
+
+	_connections.reserve(poolSize);
+	_idle.reserve(poolSize);
+	for (int i = 0; i < poolSize; ++i) {
+		auto connection = std::make_unique<DBConnection>();
+		connection->statements.assign(statementCount, SQL_NULL_HSTMT);
+
+		_idle.push_back(connection.get());
+		_connections.push_back(std::move(connection));
+	}
+
+	_running = true;
+
+	LOG_INF("[DBConnectionPool] pool size %d", poolSize);
+	return true;
+}
+
+void DBConnectionPool::Shutdown()
+{
+	{
+		std::lock_guard lock{ _mutex };
+		if (not _running) {
+			return;
+		}
+
+		_running = false;
+	}
+	_cv.notify_all();
+
+	// DBExecutor가 먼저 멈추므로 이 시점에는 모두 반납된 상태
+	std::lock_guard lock{ _mutex };
+	for (auto& connection : _connections) {
+		Disconnect(*connection);
+	}
+
+	_idle.clear();
+	_connections.clear();
+}
+
+DBConnectionPool::Guard DBConnectionPool::Acquire(int timeoutMs)
+{
+	auto begin = std::chrono::steady_clock::now();
+
+	// 1. 빈 연결이 생길 때까지 대기
+	DBConnection* connection{ nullptr };
+	{
+		std::unique_lock lock{ _mutex };
+
+		++_waiting;
+		bool ready = _cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this]() { return (not _idle.empty()) or (not _running); });
+		--_waiting;
+
+		if ((not ready) or (not _running)) {
+			_timeoutCount.fetch_add(1);
+			LOG_WRN("[DBConnectionPool] Acquire timeout (%d ms)", timeoutMs);
+			return Guard{};
+		}
+
+		connection = _idle.back();
+		_idle.pop_back();
+	}
+
+	// 2. 대기 시간 기록
+	long long waitUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+
+	_acquireCount.fetch_add(1);
+	_totalWaitUs.fetch_add(waitUs);
+
+	long long maxWaitUs = _maxWaitUs.load();
+	while ((waitUs > maxWaitUs) and (not _maxWaitUs.compare_exchange_weak(maxWaitUs, waitUs))) {}
+
+	// 3. Health Check : 처음 쓰는 연결은 연결, 실패했거나 오래 쉰 연결은 확인 후 재연결
+	bool idleTooLong = (std::chrono::steady_clock::now() - connection->lastUsed) > std::chrono::milliseconds(HEALTH_CHECK_IDLE_MS);
+
+	if (connection->hDbc == SQL_NULL_HDBC) {
+		if (not Connect(*connection)) {
+			Release(connection);
+			return Guard{};
+		}
+	}
+
+	else if ((connection->suspect or idleTooLong) and (not IsAlive(*connection))) {
+		LOG_WRN("[DBConnectionPool] dead connection, reconnecting");
+
+		Disconnect(*connection);
+		_reconnectCount.fetch_add(1);
+
+		if (not Connect(*connection)) {
+			Release(connection);
+			return Guard{};
+		}
+	}
+
+	connection->suspect = false;
+	return Guard{ this, connection };
+}
+
+DBConnectionPool::Stats DBConnectionPool::GetStats() const
+{
+	std::lock_guard lock{ _mutex };
+
+	long long acquireCount = _acquireCount.load();
+
+	return Stats{
+		static_cast<int>(_connections.size()),
+		static_cast<int>(_connections.size() - _idle.size()),
+		_waiting,
+		acquireCount,
+		_timeoutCount.load(),
+		_reconnectCount.load(),
+		(acquireCount > 0) ? _totalWaitUs.load() / acquireCount : 0,
+		_maxWaitUs.load()
+	};
+}
+
+void DBConnectionPool::Release(DBConnection* connection)
+{
+	connection->lastUsed = std::chrono::steady_clock::now();
+
+	{
+		std::lock_guard lock{ _mutex };
+		_idle.push_back(connection);
+	}
+
+	_cv.notify_one();
+}
+
+bool DBConnectionPool::Connect(DBConnection& connection)
+{
+	SQLRETURN retcode = SQLAllocHandle(SQL_HANDLE_DBC, _hEnv, &connection.hDbc);
+	if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
+		LOG_ERR("[DBConnectionPool] SQLAllocHandle DBC failed");
+		connection.hDbc = SQL_NULL_HDBC;
+		return false;
+	}
+
+	retcode = SQLConnect(connection.hDbc, (SQLWCHAR*)_database.c_str(), SQL_NTS, (SQLWCHAR*)NULL, 0, NULL, 0);
+	if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
+		LOG_ERR("[DBConnectionPool] SQLConnect failed");
+		SQLFreeHandle(SQL_HANDLE_DBC, connection.hDbc);
+		connection.hDbc = SQL_NULL_HDBC;
+		return false;
+	}
+
+	return true;
+}
+
+void DBConnectionPool::Disconnect(DBConnection& connection)
+{
+	// 1. Prepare해 둔 Statement 해제
+	for (SQLHSTMT& hStmt : connection.statements) {
+		if (hStmt != SQL_NULL_HSTMT) {
+			SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+			hStmt = SQL_NULL_HSTMT;
+		}
+	}
+
+	// 2. 연결 해제
+	if (connection.hDbc != SQL_NULL_HDBC) {
+		SQLDisconnect(connection.hDbc);
+		SQLFreeHandle(SQL_HANDLE_DBC, connection.hDbc);
+		connection.hDbc = SQL_NULL_HDBC;
+	}
+}
+
+bool DBConnectionPool::IsAlive(DBConnection& connection)
+{
+	SQLUINTEGER dead{ SQL_CD_TRUE };
+
+	SQLRETURN retcode = SQLGetConnectAttr(connection.hDbc, SQL_ATTR_CONNECTION_DEAD, &dead, 0, nullptr);
+	if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
+		return false;
+	}
+
+	return dead == SQL_CD_FALSE;
+}
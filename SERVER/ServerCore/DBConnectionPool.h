@@ -0,0 +1,94 @@
+#pragma once
+
+#include <sqlext.h>
+
+// ODBC 연결 하나와 그 연결에서 Prepare한 Statement들
+struct DBConnection {
+	SQLHDBC hDbc{ SQL_NULL_HDBC };
+	std::vector<SQLHSTMT> statements;
+
+	std::chrono::steady_clock::time_point lastUsed;
+
+	// 실행이 실패한 연결은 다음 Acquire 때 살아 있는지 확인
+	bool suspect{ false };
+};
+
+// 개수가 고정된 ODBC 연결 Pool
+// 사용하는 Thread 수와 상관없이 DB 연결 수는 poolSize를 넘지 않고, 빈 연결이 없으면 Timeout까지 대기
+class DBConnectionPool
+{
+public:
+	struct Stats {
+		int poolSize;
+		int inUse;
+		int waiting;
+		long long acquireCount;
+		long long timeoutCount;
+		long long reconnectCount;
+		long long avgWaitUs;
+		long long maxWaitUs;
+	};
+
+	// 범위를 벗어나면 자동 반납
+	class Guard
+	{
+	public:
+		Guard() = default;
+		Guard(DBConnectionPool* pool, DBConnection* connection) : _pool(pool), _connection(connection) {}
+		Guard(Guard&& other) noexcept : _pool(other._pool), _connection(other._connection) { other._connection = nullptr; }
+		Guard(const Guard&) = delete;
+		Guard& operator=(const Guard&) = delete;
+		~Guard() { if (nullptr != _connection) _pool->Release(_connection); }
+
+		explicit operator bool() const { return nullptr != _connection; }
+		DBConnection& operator*() const { return *_connection; }
+		DBConnection* operator->() const { return _connection; }
+
+	private:
+		DBConnectionPool* _pool{ nullptr };
+		DBConnection* _connection{ nullptr };
+	};
+
+public:
+	static constexpr int DEFAULT_POOL_SIZE{ 4 };
+	static constexpr int DEFAULT_ACQUIRE_TIMEOUT_MS{ 3000 };
+	static constexpr int HEALTH_CHECK_IDLE_MS{ 30000 };
+
+public:
+	DBConnectionPool() = default;
+	~DBConnectionPool();
+
+public:
+	// 연결은 처음 Acquire될 때 생성
+	bool Init(SQLHENV hEnv, const std::wstring& database, int poolSize, int statementCount);
+	void Shutdown();
+
+	Guard Acquire(int timeoutMs = DEFAULT_ACQUIRE_TIMEOUT_MS);
+
+	Stats GetStats() const;
+
+private:
+	void Release(DBConnection* connection);
+
+	bool Connect(DBConnection& connection);
+	void Disconnect(DBConnection& connection);
+	bool IsAlive(DBConnection& connection);
+
+private:
+	SQLHENV _hEnv{ SQL_NULL_HENV };
+	std::wstring _database;
+
+	std::vector<std::unique_ptr<DBConnection>> _connections;
+	std::vector<DBConnection*> _idle;
+
+	mutable std::mutex _mutex;
+	std::condition_variable _cv;
+	bool _running{ false };
+	int _waiting{ 0 };
+
+	std::atomic<long long> _acquireCount{ 0 };
+	std::atomic<long long> _timeoutCount{ 0 };
+	std::atomic<long long> _reconnectCount{ 0 };
+	std::atomic<long long> _totalWaitUs{ 0 };
+	std::atomic<long long> _maxWaitUs{ 0 };
+};
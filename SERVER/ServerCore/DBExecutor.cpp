@@ -0,0 +1,205 @@
+#include "pch.h"
+#include "DBExecutor.h"
+
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_DB
+
+DBExecutor::DBExecutor(const std::shared_ptr<IStorage>& storage) : _storage(storage)
+{
+}
+
+DBExecutor::~DBExecutor()
+{
+	Stop();
+}
+
+void DBExecutor::Start(int threadCount)
+{
+	if (_running.exchange(true)) {
+		LOG_WRN("DBExecutor already started");
+		return;
+	}
+
+	threadCount = std::max(1, threadCount);
+
+	_queues.reserve(threadCount);
+	for (int i = 0; i < threadCount; ++i) {
+		_queues.push_back(std::make_unique<DBQueue>());
+	}
+
+	_threads.reserve(threadCount);
+	for (int i = 0; i < threadCount; ++i) {
+		_threads.emplace_back(&DBExecutor::WorkerThread, this, i);
+	}
+
+	LOG_INF("DBExecutor started with %d threads", threadCount);
+}
+
+void DBExecutor::StartManual()
+{
+	if (_running.exchange(true)) {
+		LOG_WRN("DBExecutor already started");
+		return;
+	}
+
+	_queues.push_back(std::make_unique<DBQueue>());
+
+	LOG_INF("DBExecutor started in manual mode");
+}
+
+size_t DBExecutor::RunPending()
+{
+	if (not _threads.empty()) {
+		LOG_ERR("DBExecutor RunPending called with worker threads");
+		return 0;
+	}
+
+	size_t executed{ 0 };
+	std::deque<DBJob> jobs;
+	for (auto& queue : _queues) {
+		{
+			std::lock_guard lock{ queue->mutex };
+			jobs.swap(queue->jobs);
+		}
+
+		executed += jobs.size();
+		RunJobs(jobs);
+	}
+
+	return executed;
+}
+
+void DBExecutor::Stop()
+{
+	if (not _running.exchange(false)) {
+		return;
+	}
+
+	// Manual 모드는 Thread가 없으므로 남은 요청을 호출 Thread에서 처리
+	if (_threads.empty()) {
+		RunPending();
+	}
+
+	for (auto& queue : _queues) {
+		std::lock_guard lock{ queue->mutex };
+		queue->cv.notify_all();
+	}
+
+	// Logout 저장 등 남은 요청은 모두 처리한 뒤 Thread 종료
+	for (std::thread& thread : _threads) {
+		if (thread.joinable()) {
+			thread.join();
+		}
+	}
+	_threads.clear();
+	_queues.clear();
+
+	LOG_INF("DBExecutor stopped");
+}
+
+void DBExecutor::Post(int key, Job job)
+{
+	if (not _running.load()) {
+		LOG_WRN("DBExecutor is not running, DB job dropped");
+		return;
+	}
+
+	Enqueue(key, std::move(job));
+}
+
+bool DBExecutor::TryPost(int key, Job job)
+{
+	if (not _running.load()) {
+		LOG_WRN("DBExecutor is not running, DB job dropped");
+		return false;
+	}
+
+	// DB가 밀려 있으면 더 쌓지 않고 호출한 쪽에서 거절 처리
+	if (_pendingCount.load() >= MAX_PENDING_JOBS) {
+		_rejectedCount.fetch_add(1);
+		return false;
+	}
+
+	Enqueue(key, std::move(job));
+	return true;
+}
+
+DBExecutor::Stats DBExecutor::GetStats() const
+{
+	long long executed = _executedCount.load();
+
+	return Stats{
+		_pendingCount.load(),
+		_maxPending.load(),
+		executed,
+		_rejectedCount.load(),
+		(executed > 0) ? _totalLatencyUs.load() / executed : 0,
+		_maxLatencyUs.load()
+	};
+}
+
+void DBExecutor::Enqueue(int key, Job&& job)
+{
+	DBQueue& queue = *_queues[static_cast<unsigned int>(key) % _queues.size()];
+	{
+		std::lock_guard lock{ queue.mutex };
+		queue.jobs.push_back(DBJob{ std::move(job), Clock::now() });
+	}
+
+	long long pending = _pendingCount.fetch_add(1) + 1;
+
+	long long maxPending = _maxPending.load();
+	while ((pending > maxPending) and (not _maxPending.compare_exchange_weak(maxPending, pending))) {}
+
+	queue.cv.notify_one();
+}
+
+void DBExecutor::WorkerThread(int index)
+{
+	Profiler::SetThreadName("DB " + std::to_string(index));
+
+	DBQueue& queue = *_queues[index];
+
+	std::deque<DBJob> jobs;
+	while (true) {
+		{
+			std::unique_lock lock{ queue.mutex };
+			queue.cv.wait(lock, [&]() { return (not queue.jobs.empty()) or (not _running.load()); });
+
+			if (queue.jobs.empty() and (not _running.load())) {
+				break;
+			}
+
+			jobs.swap(queue.jobs);
+		}
+
+		RunJobs(jobs);
+	}
+
+	// Thread별 ODBC 연결 해제
+	_storage->CloseThreadConnection();
+}
+
+void DBExecutor::RunJobs(std::deque<DBJob>& jobs)
+{
+	for (DBJob& dbJob : jobs) {
+		PROFILE_ZONE("DBExecutor::Job");
+
+		auto execStart = Clock::now();
+		dbJob.job();
+		_pendingCount.fetch_sub(1);
+
+		// Queue 대기 + 실행 시간
+		auto execEnd = Clock::now();
+		long long latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(execEnd - dbJob.enqueueTime).count();
+		Metrics::Record(METRIC_DB_LATENCY_US, latencyUs);
+		Metrics::Record(METRIC_DB_EXEC_US, std::chrono::duration_cast<std::chrono::microseconds>(execEnd - execStart).count());
+
+		_executedCount.fetch_add(1);
+		_totalLatencyUs.fetch_add(latencyUs);
+
+		long long maxLatencyUs = _maxLatencyUs.load();
+		while ((latencyUs > maxLatencyUs) and (not _maxLatencyUs.compare_exchange_weak(maxLatencyUs, latencyUs))) {}
+	}
+	jobs.clear();
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+// DB 요청을 IOCP/Job Worker 대신 처리하는 전용 Thread Pool
+// key(UserID)로 Thread를 고정해서 같은 User의 요청은 들어온 순서대로 실행
+class DBExecutor
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct DBJob {
+		Job job;
+		Clock::time_point enqueueTime;
+	};
+
+	struct DBQueue {
+		std::deque<DBJob> jobs;
+		std::mutex mutex;
+		std::condition_variable cv;
+	};
+
+public:
+	struct Stats {
+		long long pending;
+		long long maxPending;
+		long long executed;
+		long long rejected;
+		long long avgLatencyUs;		// Post ~ 실행 완료
+		long long maxLatencyUs;
+	};
+
+public:
+	// DB 연결 수(DBConnectionPool)와 같게 두면 Thread가 연결을 기다리지 않음
+	static constexpr int DEFAULT_THREAD_COUNT{ DBConnectionPool::DEFAULT_POOL_SIZE };
+
+	// TryPost가 거절하기 시작하는 대기 Job 수
+	static constexpr long long MAX_PENDING_JOBS{ 10000 };
+
+public:
+	DBExecutor(const std::shared_ptr<IStorage>& storage);
+	~DBExecutor();
+
+public:
+	void Start(int threadCount = DEFAULT_THREAD_COUNT);
+	void Stop();
+
+	// DB Thread 없이 시작. 요청은 RunPending을 부른 Thread에서 실행 (Simulation)
+	void StartManual();
+	size_t RunPending();
+
+	// 저장처럼 버리면 안 되는 요청, 대기 Job 수와 상관없이 넣음
+	void Post(int key, Job job);
+
+	// Login처럼 거절해도 되는 요청, 밀려 있으면 false
+	bool TryPost(int key, Job job);
+
+public:
+	long long GetPendingCount() const { return _pendingCount.load(); }
+	Stats GetStats() const;
+
+private:
+	void Enqueue(int key, Job&& job);
+	void WorkerThread(int index);
+	void RunJobs(std::deque<DBJob>& jobs);
+
+private:
+	std::shared_ptr<IStorage> _storage;
+
+	std::vector<std::unique_ptr<DBQueue>> _queues;
+	std::vector<std::thread> _threads;
+
+	std::atomic<bool> _running{ false };
+
+	std::atomic<long long> _pendingCount{ 0 };
+	std::atomic<long long> _maxPending{ 0 };
+	std::atomic<long long> _executedCount{ 0 };
+	std::atomic<long long> _rejectedCount{ 0 };
+	std::atomic<long long> _totalLatencyUs{ 0 };
+	std::atomic<long long> _maxLatencyUs{ 0 };
+};
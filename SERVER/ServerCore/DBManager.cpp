@@ -1,17 +1,38 @@
 #include "pch.h"
 #include "DBManager.h"
 
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_DB
+
 SQLHENV DBManager::_hEnv = SQL_NULL_HENV;
-thread_local SQLHDBC DBManager::_hDbc = SQL_NULL_HDBC;
+
+// StatementId 순서와 일치해야 함
+const wchar_t* const DBManager::STATEMENT_QUERIES[STMT_COUNT]{
+    L"{CALL select_user_id(?)}",
+    L"{CALL select_user_info(?)}",
+    L"{CALL update_user_info(?, ?, ?, ?, ?, ?, ?, ?)}",
+    L"{CALL select_user_item(?)}",
+    L"{CALL user_get_item(?, ?, ?)}",
+    L"{CALL user_use_item(?, ?, ?)}",
+    L"{CALL select_user_quests(?)}",
+    L"{CALL update_user_quests(?, ?, ?)}",
+    L"{CALL delete_user_quests(?)}",
+    // Row Count Message가 Result Set 사이에 끼지 않도록 NOCOUNT
+    L"SET NOCOUNT ON; EXEC select_user_id ?; EXEC select_user_info ?; EXEC select_user_item ?; EXEC select_user_quests ?",
+};
+
+DBManager::DBManager(int poolSize) : _poolSize(poolSize)
+{
+}
 
 DBManager::~DBManager()
 {
     Shutdown();
 }
 
-bool DBManager::Init(const std::wstring& database)
+bool DBManager::Init(const std::string& connection)
 {
-    // 1. ODBC ȯ Handle Alloc
+    // 1. ODBC 환경 Handle Alloc
     SQLRETURN retcode = SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &_hEnv);
     if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
         LOG_INF("[DBManager] SQLAllocHandle ENV Failed");
@@ -24,11 +45,12 @@ bool DBManager::Init(const std::wstring& database)
         return false;
     }
 
-    _database = database;
+    _database.assign(connection.begin(), connection.end());
 
-    // 4. DB   Thread
-    /*_running.store(true);
-    _dbThread = std::thread(&DBManager::ThreadLoop, this);*/
+    // 2. 연결 Pool 준비 (실제 연결은 처음 Acquire할 때)
+    if (not _pool.Init(_hEnv, _database, _poolSize, STMT_COUNT)) {
+        return false;
+    }
 
     LOG_INF("[DBManager] MSSQL Connect Success");
     return true;
@@ -36,14 +58,12 @@ bool DBManager::Init(const std::wstring& database)
 
 void DBManager::Shutdown()
 {
-    // 2. ODBC Handle 
-    if (_hDbc != SQL_NULL_HDBC) {
-        SQLDisconnect(_hDbc);
-        SQLFreeHandle(SQL_HANDLE_DBC, _hDbc);
-    }
+    // 2. ODBC Handle 해제
+    _pool.Shutdown();
 
-    if (_hEnv != SQL_NULL_HDBC) {
+    if (_hEnv != SQL_NULL_HENV) {
         SQLFreeHandle(SQL_HANDLE_ENV, _hEnv);
+        _hEnv = SQL_NULL_HENV;
     }
 
     LOG_INF("[DBManager] Shutdown Success");
@@ -51,358 +71,500 @@ void DBManager::Shutdown()
 
 bool DBManager::CheckUserID(const std::wstring& userID)
 {
-    EnsureThreadConnection(_database);
+    auto connection = _pool.Acquire();
+    if (not connection) {
+        return false;
+    }
 
-    SQLHSTMT hStmt{ SQL_NULL_HSTMT };
-    SQLRETURN retcode;
+    SQLHSTMT hStmt = GetStatement(*connection, STMT_SELECT_USER_ID);
+    if (hStmt == SQL_NULL_HSTMT) {
+        return false;
+    }
 
     SQLINTEGER userId{ -1 };
     SQLLEN cbUserId{ 0 };
+    SQLLEN cbUserID{ SQL_NTS };
 
-    // 1. Statement Handle Alloc
-    retcode = SQLAllocHandle(SQL_HANDLE_STMT, _hDbc, &hStmt);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_INF("[DBManager] SQLAllocHandle STMT Failed");
+    // 1. Parameter Binding 후 실행
+    BindParameter(hStmt, 1, userID, cbUserID);
+    if (not Execute(*connection, hStmt)) {
+        ReleaseStatement(hStmt);
         return false;
     }
 
-    // 2. Query 
-    std::wstring query = L"EXEC select_user_id " + userID;
-    retcode = SQLExecDirect(hStmt, (SQLWCHAR*)query.c_str(), SQL_NTS);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_ERR("[DBManager] SQLExecDirect failed");
-        HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
-        SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
-        return false;
-    }
+    // 2. Column Binding
+    SQLBindCol(hStmt, 1, SQL_C_LONG, &userId, 0, &cbUserId);
 
-    // 3. Column Binding
-    retcode = SQLBindCol(hStmt, 1, SQL_C_LONG, &userId, 100, &cbUserId);
-
-    retcode = SQLFetch(hStmt);
+    SQLRETURN retcode = SQLFetch(hStmt);
     if ((retcode == SQL_SUCCESS) or (retcode == SQL_SUCCESS_WITH_INFO)) {
         LOG_INF("ID[%d] Success", userId);
-        SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+        ReleaseStatement(hStmt);
         return true;
     }
 
     else {
         HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
-        SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+        ReleaseStatement(hStmt);
         return false;
     }
 }
 
 bool DBManager::GetUserInfo(const std::wstring& userID, UserData& outData)
 {
-    EnsureThreadConnection(_database);
-
-    SQLHSTMT hStmt{ SQL_NULL_HSTMT };
-    SQLRETURN retcode;
-
-    UserData userData{ -1, };
-    SQLLEN cbUserData[8]{};
+    auto connection = _pool.Acquire();
+    if (not connection) {
+        return false;
+    }
 
-    // 1. Statement Handle Alloc
-    retcode = SQLAllocHandle(SQL_HANDLE_STMT, _hDbc, &hStmt);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_INF("[DBManager] SQLAllocHandle STMT Failed");
+    SQLHSTMT hStmt = GetStatement(*connection, STMT_SELECT_USER_INFO);
+    if (hStmt == SQL_NULL_HSTMT) {
         return false;
     }
 
-    //SQLSetStmtAttr(hStmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_STATIC, 0);
+    UserData userData{ -1, };
+    SQLLEN cbUserData[8]{};
+    SQLLEN cbUserID{ SQL_NTS };
 
-    // 2. Query 
-    std::wstring query = L"EXEC select_user_info " + userID;
-    retcode = SQLExecDirect(hStmt, (SQLWCHAR*)query.c_str(), SQL_NTS);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_ERR("[DBManager] SQLexecDirect failed");
-        HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
-        SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    // 1. Parameter Binding 후 실행
+    BindParameter(hStmt, 1, userID, cbUserID);
+    if (not Execute(*connection, hStmt)) {
+        ReleaseStatement(hStmt);
         return false;
     }
 
-    // 3. Column Binding
-    retcode = SQLBindCol(hStmt, 1, SQL_C_LONG, &userData.id, 100, &cbUserData[0]);
-    retcode = SQLBindCol(hStmt, 2, SQL_C_LONG, &userData.level, 100, &cbUserData[1]);
-    retcode = SQLBindCol(hStmt, 3, SQL_C_LONG, &userData.exp, 100, &cbUserData[2]);
-    retcode = SQLBindCol(hStmt, 4, SQL_C_SHORT, &userData.hp, 100, &cbUserData[3]);
-    retcode = SQLBindCol(hStmt, 5, SQL_C_SHORT, &userData.maxHp, 100, &cbUserData[4]);
-    retcode = SQLBindCol(hStmt, 6, SQL_C_SHORT, &userData.x, 100, &cbUserData[5]);
-    retcode = SQLBindCol(hStmt, 7, SQL_C_SHORT, &userData.y, 100, &cbUserData[6]);
-    retcode = SQLBindCol(hStmt, 8, SQL_C_LONG, &userData.partyId, 100, &cbUserData[7]);
+    // 2. Column Binding
+    SQLBindCol(hStmt, 1, SQL_C_LONG, &userData.id, 0, &cbUserData[0]);
+    SQLBindCol(hStmt, 2, SQL_C_LONG, &userData.level, 0, &cbUserData[1]);
+    SQLBindCol(hStmt, 3, SQL_C_SBIGINT, &userData.exp, 0, &cbUserData[2]);
+    SQLBindCol(hStmt, 4, SQL_C_SHORT, &userData.hp, 0, &cbUserData[3]);
+    SQLBindCol(hStmt, 5, SQL_C_SHORT, &userData.maxHp, 0, &cbUserData[4]);
+    SQLBindCol(hStmt, 6, SQL_C_SHORT, &userData.x, 0, &cbUserData[5]);
+    SQLBindCol(hStmt, 7, SQL_C_SHORT, &userData.y, 0, &cbUserData[6]);
+    SQLBindCol(hStmt, 8, SQL_C_LONG, &userData.partyId, 0, &cbUserData[7]);
 
-    retcode = SQLFetch(hStmt);
+    SQLRETURN retcode = SQLFetch(hStmt);
     if ((retcode == SQL_SUCCESS) or (retcode == SQL_SUCCESS_WITH_INFO)) {
         outData = userData;
     }
 
     LOG_INF("[DBManager] GetUserInfo Success");
-    SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    ReleaseStatement(hStmt);
     return true;
 }
 
 bool DBManager::UpdateUserInfo(const UserData& userData)
 {
-    EnsureThreadConnection(_database);
-
-    SQLHSTMT hStmt{ SQL_NULL_HSTMT };
-    SQLRETURN retcode;
+    auto connection = _pool.Acquire();
+    if (not connection) {
+        return false;
+    }
 
-    // 1. Statement Handle Alloc
-    retcode = SQLAllocHandle(SQL_HANDLE_STMT, _hDbc, &hStmt);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_INF("[DBManager] SQLAllocHandle STMT Failed");
+    SQLHSTMT hStmt = GetStatement(*connection, STMT_UPDATE_USER_INFO);
+    if (hStmt == SQL_NULL_HSTMT) {
         return false;
     }
 
-    //SQLSetStmtAttr(hStmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_STATIC, 0);
+    UserData param = userData;
 
-    // 2. Query 
-    std::wstring query =
-        L"EXEC update_user_info " + std::to_wstring(userData.id) +
-        L", " + std::to_wstring(userData.level) +
-        L", " + std::to_wstring(userData.exp) +
-        L", " + std::to_wstring(userData.hp) +
-        L", " + std::to_wstring(userData.maxHp) +
-        L", " + std::to_wstring(userData.x) +
-        L", " + std::to_wstring(userData.y) +
-        L", " + std::to_wstring(userData.partyId);
+    // 1. Parameter Binding 후 실행
+    BindParameter(hStmt, 1, param.id);
+    BindParameter(hStmt, 2, param.level);
+    BindParameter(hStmt, 3, param.exp);
+    BindParameter(hStmt, 4, param.hp);
+    BindParameter(hStmt, 5, param.maxHp);
+    BindParameter(hStmt, 6, param.x);
+    BindParameter(hStmt, 7, param.y);
+    BindParameter(hStmt, 8, param.partyId);
 
-    retcode = SQLExecDirect(hStmt, (SQLWCHAR*)query.c_str(), SQL_NTS);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_ERR("[DBManager] SQLexecDirect failed");
-        HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
-        SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    if (not Execute(*connection, hStmt)) {
+        ReleaseStatement(hStmt);
         return false;
     }
 
     LOG_INF("[DBManager] User[%d] UpdateUserInfo Success", userData.id);
-    SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    ReleaseStatement(hStmt);
     return true;
 }
 
 std::vector<std::pair<int, int>> DBManager::GetUserItems(const std::wstring& userID)
 {
-    EnsureThreadConnection(_database);
-
     std::vector<std::pair<int, int>> result;
 
-    SQLHSTMT hStmt{ SQL_NULL_HSTMT };
-    SQLRETURN retcode;
+    auto connection = _pool.Acquire();
+    if (not connection) {
+        return result;
+    }
 
-    // 1. Statement Handle Alloc
-    retcode = SQLAllocHandle(SQL_HANDLE_STMT, _hDbc, &hStmt);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_INF("[DBManager] SQLAllocHandle STMT Failed");
+    SQLHSTMT hStmt = GetStatement(*connection, STMT_SELECT_USER_ITEM);
+    if (hStmt == SQL_NULL_HSTMT) {
         return result;
     }
 
-    //SQLSetStmtAttr(hStmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_STATIC, 0);
+    SQLLEN cbUserID{ SQL_NTS };
 
-    // 2. Query 
-    std::wstring query = L"EXEC select_user_item " + userID;
-    retcode = SQLExecDirect(hStmt, (SQLWCHAR*)query.c_str(), SQL_NTS);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_ERR("[DBManager] SQLexecDirect failed");
-        HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
-        SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    // 1. Parameter Binding 후 실행
+    BindParameter(hStmt, 1, userID, cbUserID);
+    if (not Execute(*connection, hStmt)) {
+        ReleaseStatement(hStmt);
         return result;
     }
 
-    else {
-        SQLINTEGER itemID{ 0 };
-        SQLINTEGER count{ 0 };
+    // 2. Column Binding
+    SQLINTEGER itemID{ 0 };
+    SQLINTEGER count{ 0 };
 
-        SQLLEN cbItemID{ 0 }, cbCount{ 0 };
+    SQLLEN cbItemID{ 0 }, cbCount{ 0 };
 
-        retcode = SQLBindCol(hStmt, 1, SQL_C_LONG, &itemID, 100, &cbItemID);
-        retcode = SQLBindCol(hStmt, 2, SQL_C_LONG, &count, 100, &cbCount);
+    SQLBindCol(hStmt, 1, SQL_C_LONG, &itemID, 0, &cbItemID);
+    SQLBindCol(hStmt, 2, SQL_C_LONG, &count, 0, &cbCount);
 
-        while ((retcode = SQLFetch(hStmt) != SQL_NO_DATA)) {
-            if ((retcode == SQL_SUCCESS) or (retcode == SQL_SUCCESS_WITH_INFO)) {
-                result.emplace_back(static_cast<int>(itemID), static_cast<int>(count));
-            }
+    SQLRETURN retcode;
+    while ((retcode = SQLFetch(hStmt)) != SQL_NO_DATA) {
+        if ((retcode == SQL_SUCCESS) or (retcode == SQL_SUCCESS_WITH_INFO)) {
+            result.emplace_back(static_cast<int>(itemID), static_cast<int>(count));
+        }
 
-            else {
-                LOG_ERR("[DBManager] GetUserItems failed");
-                break;
-            }
+        else {
+            LOG_ERR("[DBManager] GetUserItems failed");
+            HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
+            break;
         }
     }
 
-    SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    ReleaseStatement(hStmt);
     return result;
 }
 
 bool DBManager::UserGetItem(int userId, int itemId, int count)
 {
-    EnsureThreadConnection(_database);
-
-    SQLHSTMT hStmt{ SQL_NULL_HSTMT };
-    SQLRETURN retcode;
-
-    // 1. Statement Handle Alloc
-    retcode = SQLAllocHandle(SQL_HANDLE_STMT, _hDbc, &hStmt);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_INF("[DBManager] SQLAllocHandle STMT Failed");
+    auto connection = _pool.Acquire();
+    if (not connection) {
         return false;
     }
 
-    //SQLSetStmtAttr(hStmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_STATIC, 0);
-
-    // 2. Query 
-    std::wstring query = 
-        L"EXEC user_get_item " + std::to_wstring(userId) +
-        L", " + std::to_wstring(itemId) +
-        L", " + std::to_wstring(count);
-
-    retcode = SQLExecDirect(hStmt, (SQLWCHAR*)query.c_str(), SQL_NTS);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_ERR("[DBManager] SQLexecDirect failed");
-        HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
-        SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    SQLHSTMT hStmt = GetStatement(*connection, STMT_USER_GET_ITEM);
+    if (hStmt == SQL_NULL_HSTMT) {
         return false;
     }
 
-    SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
-    return true;
+    // 1. Parameter Binding 후 실행
+    BindParameter(hStmt, 1, userId);
+    BindParameter(hStmt, 2, itemId);
+    BindParameter(hStmt, 3, count);
+
+    bool success = Execute(*connection, hStmt);
+    ReleaseStatement(hStmt);
+    return success;
 }
 
 bool DBManager::UserUseItem(int userId, int itemId, int count)
 {
-    EnsureThreadConnection(_database);
-
-    SQLHSTMT hStmt{ SQL_NULL_HSTMT };
-    SQLRETURN retcode;
-
-    // 1. Statement Handle Alloc
-    retcode = SQLAllocHandle(SQL_HANDLE_STMT, _hDbc, &hStmt);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_INF("[DBManager] SQLAllocHandle STMT Failed");
+    auto connection = _pool.Acquire();
+    if (not connection) {
         return false;
     }
 
-    // 2. Query 
-    std::wstring query =
-        L"EXEC user_use_item " + std::to_wstring(userId) +
-        L", " + std::to_wstring(itemId) +
-        L", " + std::to_wstring(count);
-
-    retcode = SQLExecDirect(hStmt, (SQLWCHAR*)query.c_str(), SQL_NTS);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_ERR("[DBManager] SQLexecDirect failed");
-        HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
-        SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    SQLHSTMT hStmt = GetStatement(*connection, STMT_USER_USE_ITEM);
+    if (hStmt == SQL_NULL_HSTMT) {
         return false;
     }
 
-    SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
-    return true;
+    // 1. Parameter Binding 후 실행
+    BindParameter(hStmt, 1, userId);
+    BindParameter(hStmt, 2, itemId);
+    BindParameter(hStmt, 3, count);
+
+    bool success = Execute(*connection, hStmt);
+    ReleaseStatement(hStmt);
+    return success;
 }
 
 std::vector<QuestData> DBManager::GetUserQuests(const std::wstring& userID)
 {
-    EnsureThreadConnection(_database);
-
     std::vector<QuestData> result;
 
-    SQLHSTMT hStmt{ SQL_NULL_HSTMT };
-    SQLRETURN retcode;
+    auto connection = _pool.Acquire();
+    if (not connection) {
+        return result;
+    }
 
-    // 1. Statement Handle Alloc
-    retcode = SQLAllocHandle(SQL_HANDLE_STMT, _hDbc, &hStmt);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_INF("[DBManager] SQLAllocHandle STMT Failed");
+    SQLHSTMT hStmt = GetStatement(*connection, STMT_SELECT_USER_QUESTS);
+    if (hStmt == SQL_NULL_HSTMT) {
         return result;
     }
 
-    //SQLSetStmtAttr(hStmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_STATIC, 0);
+    SQLLEN cbUserID{ SQL_NTS };
 
-    // 2. Query 
-    std::wstring query = L"EXEC select_user_quests " + userID;
-    retcode = SQLExecDirect(hStmt, (SQLWCHAR*)query.c_str(), SQL_NTS);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_ERR("[DBManager] SQLexecDirect failed");
-        HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
-        SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    // 1. Parameter Binding 후 실행
+    BindParameter(hStmt, 1, userID, cbUserID);
+    if (not Execute(*connection, hStmt)) {
+        ReleaseStatement(hStmt);
         return result;
     }
 
-    else {
-        SQLINTEGER questID{ 0 };
-        SQLINTEGER progressKill{ 0 };
+    // 2. Column Binding
+    SQLINTEGER questID{ 0 };
+    SQLINTEGER progressKill{ 0 };
 
-        SQLLEN cbQuestID{ 0 }, cbProgressKill{ 0 }, cbIsCompleted{ 0 };
+    SQLLEN cbQuestID{ 0 }, cbProgressKill{ 0 };
 
-        retcode = SQLBindCol(hStmt, 1, SQL_C_LONG, &questID, 100, &cbQuestID);
-        retcode = SQLBindCol(hStmt, 2, SQL_C_LONG, &progressKill, 100, &cbProgressKill);
+    SQLBindCol(hStmt, 1, SQL_C_LONG, &questID, 0, &cbQuestID);
+    SQLBindCol(hStmt, 2, SQL_C_LONG, &progressKill, 0, &cbProgressKill);
 
-        while ((retcode = SQLFetch(hStmt) != SQL_NO_DATA)) {
-            if ((retcode == SQL_SUCCESS) or (retcode == SQL_SUCCESS_WITH_INFO)) {
-                result.emplace_back(questID, progressKill);
-            }
+    SQLRETURN retcode;
+    while ((retcode = SQLFetch(hStmt)) != SQL_NO_DATA) {
+        if ((retcode == SQL_SUCCESS) or (retcode == SQL_SUCCESS_WITH_INFO)) {
+            result.emplace_back(questID, progressKill);
+        }
 
-            else {
-                LOG_ERR("[DBManager] GetUserItems failed");
-                break;
-            }
+        else {
+            LOG_ERR("[DBManager] GetUserQuests failed");
+            HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
+            break;
         }
     }
 
-    SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    ReleaseStatement(hStmt);
     return result;
 }
 
 bool DBManager::UpdateUserQuests(int userId, const std::vector<QuestData>& quests)
 {
-    EnsureThreadConnection(_database);
+    // 1. Quest가 없으면 전부 삭제
+    if (quests.empty()) {
+        auto connection = _pool.Acquire();
+        if (not connection) {
+            return false;
+        }
+
+        SQLHSTMT hStmt = GetStatement(*connection, STMT_DELETE_USER_QUESTS);
+        if (hStmt == SQL_NULL_HSTMT) {
+            return false;
+        }
+
+        BindParameter(hStmt, 1, userId);
+
+        bool success = Execute(*connection, hStmt);
+        ReleaseStatement(hStmt);
+        return success;
+    }
+
+    auto connection = _pool.Acquire();
+    if (not connection) {
+        return false;
+    }
+
+    SQLHSTMT hStmt = GetStatement(*connection, STMT_UPDATE_USER_QUESTS);
+    if (hStmt == SQL_NULL_HSTMT) {
+        return false;
+    }
+
+    // 2. Parameter는 한 번만 Binding하고 값만 바꿔가며 재실행
+    int questId{ 0 };
+    int progress{ 0 };
+
+    BindParameter(hStmt, 1, userId);
+    BindParameter(hStmt, 2, questId);
+    BindParameter(hStmt, 3, progress);
+
+    for (const QuestData& quest : quests) {
+        questId = quest.questId;
+        progress = quest.progress;
+
+        if (not Execute(*connection, hStmt)) {
+            ReleaseStatement(hStmt);
+            return false;
+        }
+
+        SQLFreeStmt(hStmt, SQL_CLOSE);
+    }
+
+    LOG_INF("[DBManager] User[%d] UpdateUserQuests Success", userId);
+    ReleaseStatement(hStmt);
+    return true;
+}
+
+bool DBManager::LoadUser(const std::wstring& userID, UserLoadResult& outResult)
+{
+    auto connection = _pool.Acquire();
+    if (not connection) {
+        return false;
+    }
+
+    SQLHSTMT hStmt = GetStatement(*connection, STMT_LOAD_USER);
+    if (hStmt == SQL_NULL_HSTMT) {
+        return false;
+    }
+
+    // 1. 4개 Procedure 모두 같은 userID를 받음
+    SQLLEN cbUserID[4]{ SQL_NTS, SQL_NTS, SQL_NTS, SQL_NTS };
+    for (SQLUSMALLINT i = 0; i < 4; ++i) {
+        BindParameter(hStmt, i + 1, userID, cbUserID[i]);
+    }
+
+    if (not Execute(*connection, hStmt)) {
+        ReleaseStatement(hStmt);
+        return false;
+    }
 
-    SQLHSTMT hStmt{ SQL_NULL_HSTMT };
     SQLRETURN retcode;
 
-    // 1. Statement Handle Alloc
-    retcode = SQLAllocHandle(SQL_HANDLE_STMT, _hDbc, &hStmt);
+    // 2. Result Set 1 : select_user_id, 행이 없으면 없는 ID
+    SQLINTEGER userId{ -1 };
+    SQLLEN cbUserId{ 0 };
+
+    SQLBindCol(hStmt, 1, SQL_C_LONG, &userId, 0, &cbUserId);
+
+    retcode = SQLFetch(hStmt);
     if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_INF("[DBManager] SQLAllocHandle STMT Failed");
+        ReleaseStatement(hStmt);
         return false;
     }
 
-    //SQLSetStmtAttr(hStmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_STATIC, 0);
+    // 3. Result Set 2 : select_user_info
+    if (not NextResult(*connection, hStmt)) {
+        ReleaseStatement(hStmt);
+        return false;
+    }
 
-    // 2. Query 
-    int count = quests.size();
-    std::vector<std::wstring> querys;
+    UserData& userData = outResult.userData;
+    SQLLEN cbUserData[8]{};
+
+    SQLBindCol(hStmt, 1, SQL_C_LONG, &userData.id, 0, &cbUserData[0]);
+    SQLBindCol(hStmt, 2, SQL_C_LONG, &userData.level, 0, &cbUserData[1]);
+    SQLBindCol(hStmt, 3, SQL_C_SBIGINT, &userData.exp, 0, &cbUserData[2]);
+    SQLBindCol(hStmt, 4, SQL_C_SHORT, &userData.hp, 0, &cbUserData[3]);
+    SQLBindCol(hStmt, 5, SQL_C_SHORT, &userData.maxHp, 0, &cbUserData[4]);
+    SQLBindCol(hStmt, 6, SQL_C_SHORT, &userData.x, 0, &cbUserData[5]);
+    SQLBindCol(hStmt, 7, SQL_C_SHORT, &userData.y, 0, &cbUserData[6]);
+    SQLBindCol(hStmt, 8, SQL_C_LONG, &userData.partyId, 0, &cbUserData[7]);
 
-    if (0 == count) {
-        querys.emplace_back(L"EXEC delete_user_quests " + std::to_wstring(userId));
+    SQLFetch(hStmt);
+
+    // 4. Result Set 3 : select_user_item
+    if (not NextResult(*connection, hStmt)) {
+        ReleaseStatement(hStmt);
+        return false;
     }
 
-    else {
-        querys.reserve(count);
+    SQLINTEGER itemID{ 0 }, count{ 0 };
+    SQLLEN cbItemID{ 0 }, cbCount{ 0 };
 
-        for (int i = 0; i < count; ++i) {
-            querys.emplace_back(L"EXEC update_user_quests " + std::to_wstring(userId) +
-                L", " + std::to_wstring(quests[i].questId) +
-                L", " + std::to_wstring(quests[i].progress));
-        }
+    SQLBindCol(hStmt, 1, SQL_C_LONG, &itemID, 0, &cbItemID);
+    SQLBindCol(hStmt, 2, SQL_C_LONG, &count, 0, &cbCount);
+
+    while (((retcode = SQLFetch(hStmt)) == SQL_SUCCESS) or (retcode == SQL_SUCCESS_WITH_INFO)) {
+        outResult.items.emplace_back(static_cast<int>(itemID), static_cast<int>(count));
     }
 
-    for (const std::wstring& query : querys) {
-        retcode = SQLExecDirect(hStmt, (SQLWCHAR*)query.c_str(), SQL_NTS);
-        if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-            LOG_ERR("[DBManager] SQLexecDirect failed");
-            HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
-            SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
-            return false;
-        }
+    // 5. Result Set 4 : select_user_quests
+    if (not NextResult(*connection, hStmt)) {
+        ReleaseStatement(hStmt);
+        return false;
+    }
+
+    SQLINTEGER questID{ 0 }, progress{ 0 };
+    SQLLEN cbQuestID{ 0 }, cbProgress{ 0 };
+
+    SQLBindCol(hStmt, 1, SQL_C_LONG, &questID, 0, &cbQuestID);
+    SQLBindCol(hStmt, 2, SQL_C_LONG, &progress, 0, &cbProgress);
+
+    while (((retcode = SQLFetch(hStmt)) == SQL_SUCCESS) or (retcode == SQL_SUCCESS_WITH_INFO)) {
+        outResult.quests.emplace_back(questID, progress);
     }
 
-    LOG_INF("[DBManager] User[%d] UpdateUserInfo Success", userId);
-    SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    ReleaseStatement(hStmt);
+
+    outResult.success = true;
     return true;
 }
 
+SQLHSTMT DBManager::GetStatement(DBConnection& connection, StatementId id)
+{
+    // 1. 이 연결에서 이미 Prepare한 Statement면 그대로 재사용
+    SQLHSTMT& hStmt = connection.statements[id];
+    if (hStmt != SQL_NULL_HSTMT) {
+        return hStmt;
+    }
+
+    // 2. 처음 쓰는 Statement는 Alloc + Prepare
+    SQLRETURN retcode = SQLAllocHandle(SQL_HANDLE_STMT, connection.hDbc, &hStmt);
+    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
+        LOG_ERR("[DBManager] SQLAllocHandle STMT Failed");
+        hStmt = SQL_NULL_HSTMT;
+        return SQL_NULL_HSTMT;
+    }
+
+    retcode = SQLPrepare(hStmt, (SQLWCHAR*)STATEMENT_QUERIES[id], SQL_NTS);
+    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
+        LOG_ERR("[DBManager] SQLPrepare failed (%d)", id);
+        HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
+        SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+        hStmt = SQL_NULL_HSTMT;
+        return SQL_NULL_HSTMT;
+    }
+
+    return hStmt;
+}
+
+void DBManager::ReleaseStatement(SQLHSTMT hStmt)
+{
+    // Cursor와 Binding만 풀고 Prepare된 상태는 유지
+    SQLFreeStmt(hStmt, SQL_CLOSE);
+    SQLFreeStmt(hStmt, SQL_UNBIND);
+    SQLFreeStmt(hStmt, SQL_RESET_PARAMS);
+}
+
+bool DBManager::Execute(DBConnection& connection, SQLHSTMT hStmt)
+{
+    SQLRETURN retcode = SQLExecute(hStmt);
+    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO) and (retcode != SQL_NO_DATA)) {
+        LOG_ERR("[DBManager] SQLExecute failed");
+        HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
+        connection.suspect = true;
+        return false;
+    }
+
+    return true;
+}
+
+bool DBManager::NextResult(DBConnection& connection, SQLHSTMT hStmt)
+{
+    // 이전 Result Set의 Column Binding을 풀고 다음 Result Set으로 이동
+    SQLFreeStmt(hStmt, SQL_UNBIND);
+
+    SQLRETURN retcode = SQLMoreResults(hStmt);
+    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
+        LOG_ERR("[DBManager] SQLMoreResults failed");
+        HandleDiagnosticRecord(hStmt, SQL_HANDLE_STMT, retcode);
+        connection.suspect = true;
+        return false;
+    }
+
+    return true;
+}
+
+void DBManager::BindParameter(SQLHSTMT hStmt, SQLUSMALLINT index, int& value)
+{
+    SQLBindParameter(hStmt, index, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, nullptr);
+}
+
+void DBManager::BindParameter(SQLHSTMT hStmt, SQLUSMALLINT index, long long& value)
+{
+    SQLBindParameter(hStmt, index, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_BIGINT, 0, 0, &value, 0, nullptr);
+}
+
+void DBManager::BindParameter(SQLHSTMT hStmt, SQLUSMALLINT index, short& value)
+{
+    SQLBindParameter(hStmt, index, SQL_PARAM_INPUT, SQL_C_SHORT, SQL_SMALLINT, 0, 0, &value, 0, nullptr);
+}
+
+void DBManager::BindParameter(SQLHSTMT hStmt, SQLUSMALLINT index, const std::wstring& value, SQLLEN& cbValue)
+{
+    SQLBindParameter(hStmt, index, SQL_PARAM_INPUT, SQL_C_WCHAR, SQL_WVARCHAR,
+        std::max<SQLULEN>(1, value.size()), 0, (SQLPOINTER)value.c_str(), 0, &cbValue);
+}
+
 void DBManager::HandleDiagnosticRecord(SQLHANDLE hHandle, SQLSMALLINT hType, RETCODE RetCode)
 {
     SQLSMALLINT iRec = 0;
@@ -421,32 +583,3 @@ void DBManager::HandleDiagnosticRecord(SQLHANDLE hHandle, SQLSMALLINT hType, RET
         }
     }
 }
-
-void DBManager::EnsureThreadConnection(const std::wstring& database)
-{
-    if (_hDbc != SQL_NULL_HDBC) {
-        return;
-    }
-
-    SQLRETURN retcode;
-    
-    retcode = SQLAllocHandle(SQL_HANDLE_DBC, _hEnv, &_hDbc);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_ERR("SQLAllocHandle failed");
-        return;
-    }
-
-    retcode = SQLConnect(_hDbc, (SQLWCHAR*)database.c_str(), SQL_NTS, (SQLWCHAR*)NULL, 0, NULL, 0);
-    if ((retcode != SQL_SUCCESS) and (retcode != SQL_SUCCESS_WITH_INFO)) {
-        LOG_ERR("[DBManager] SQLConnect Failed");
-        return;
-    }
-}
-
-//void DBManager::ThreadLoop()
-//{
-//    while (_running.load()) {
-//       
-//    }
-//}
-
@@ -2,53 +2,75 @@
 
 #include <sqlext.h>
 
-struct UserData {
-	int id;
-	int level;
-	long long exp;
-	short hp;
-	short maxHp;
-	short x;
-	short y;
-	int partyId;
-};
+#include "IStorage.h"
 
-struct QuestData {
-	int questId;
-	int progress;
+// 연결마다 한 번만 Prepare해서 재사용하는 Stored Procedure
+enum StatementId : char {
+	STMT_SELECT_USER_ID,
+	STMT_SELECT_USER_INFO,
+	STMT_UPDATE_USER_INFO,
+	STMT_SELECT_USER_ITEM,
+	STMT_USER_GET_ITEM,
+	STMT_USER_USE_ITEM,
+	STMT_SELECT_USER_QUESTS,
+	STMT_UPDATE_USER_QUESTS,
+	STMT_DELETE_USER_QUESTS,
+	STMT_LOAD_USER,
+	STMT_COUNT
 };
 
-class DBManager
+// ODBC(MSSQL Stored Procedure) 저장소
+class DBManager : public IStorage
 {
 public:
-	DBManager() = default;
-	~DBManager();
+	DBManager(int poolSize = DBConnectionPool::DEFAULT_POOL_SIZE);
+	virtual ~DBManager();
+
+	// connection : ODBC DSN
+	virtual bool Init(const std::string& connection) override;
+	virtual void Shutdown() override;
 
-	bool Init(const std::wstring& database);
-	void Shutdown();
+	virtual bool CheckUserID(const std::wstring& userID) override;
 
-	bool CheckUserID(const std::wstring& userID);
+	virtual bool GetUserInfo(const std::wstring& userID, UserData& outData) override;
+	virtual bool UpdateUserInfo(const UserData& userData) override;
 
-	bool GetUserInfo(const std::wstring& userID, UserData& outData);
-	bool UpdateUserInfo(const UserData& userData);
+	virtual std::vector<std::pair<int, int>> GetUserItems(const std::wstring& userID) override;
+	virtual bool UserGetItem(int userId, int itemId, int count) override;
+	virtual bool UserUseItem(int userId, int itemId, int count) override;
 
-	std::vector<std::pair<int, int>> GetUserItems(const std::wstring& userID);
-	bool UserGetItem(int userId, int itemId, int count);
-	bool UserUseItem(int userId, int itemId, int count);
+	virtual std::vector<QuestData> GetUserQuests(const std::wstring& userID) override;
+	virtual bool UpdateUserQuests(int userId, const std::vector<QuestData>& quests) override;
 
-	std::vector<QuestData> GetUserQuests(const std::wstring& userID);
-	bool UpdateUserQuests(int userId, const std::vector<QuestData>& quests);
+	// Login 조회 4개를 한 Batch로 보내고 Result Set 4개를 차례로 읽음
+	virtual bool LoadUser(const std::wstring& userID, UserLoadResult& outResult) override;
+
+	DBConnectionPool::Stats GetPoolStats() const { return _pool.GetStats(); }
 
 private:
 	void HandleDiagnosticRecord(SQLHANDLE hHandle, SQLSMALLINT hType, RETCODE RetCode);
-	void EnsureThreadConnection(const std::wstring& database);
 
-	//void ThreadLoop();
-	
+	SQLHSTMT GetStatement(DBConnection& connection, StatementId id);
+	void ReleaseStatement(SQLHSTMT hStmt);
+
+	// 실패하면 연결을 suspect로 표시해서 다음 Acquire 때 Health Check
+	bool Execute(DBConnection& connection, SQLHSTMT hStmt);
+	bool NextResult(DBConnection& connection, SQLHSTMT hStmt);
+
+	// Binding된 변수는 SQLExecute가 끝날 때까지 살아 있어야 함
+	void BindParameter(SQLHSTMT hStmt, SQLUSMALLINT index, int& value);
+	void BindParameter(SQLHSTMT hStmt, SQLUSMALLINT index, long long& value);
+	void BindParameter(SQLHSTMT hStmt, SQLUSMALLINT index, short& value);
+	void BindParameter(SQLHSTMT hStmt, SQLUSMALLINT index, const std::wstring& value, SQLLEN& cbValue);
+
 private:
 	static SQLHENV _hEnv;
-	static thread_local SQLHDBC _hDbc;
+
+	static const wchar_t* const STATEMENT_QUERIES[STMT_COUNT];
 
 	std::wstring _database;
+
+	DBConnectionPool _pool;
+	int _poolSize;
 };
 
@@ -7,7 +7,6 @@ enum OperationType : char
 	Send,
 	Heal,
 	Respawn,
-	NpcMove,
 	NpcHeal,
 	NpcAttack
 };
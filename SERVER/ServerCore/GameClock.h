@@ -0,0 +1,43 @@
+#pragma once
+
+// Game Logic(Timer Event, Cooldown, NPC Tick)이 보는 시각
+// 평소에는 high_resolution_clock 그대로, Simulation에서는 Advance로만 움직이는 Virtual Clock
+class GameClock
+{
+public:
+	using Clock = std::chrono::high_resolution_clock;
+
+public:
+	static Clock::time_point Now()
+	{
+		if (_virtual.load(std::memory_order_relaxed)) {
+			return Clock::time_point{ Clock::duration{ _virtualTicks.load(std::memory_order_relaxed) } };
+		}
+		return Clock::now();
+	}
+
+	// Cooldown 비교용 ms
+	static long long NowMs()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(Now().time_since_epoch()).count();
+	}
+
+public:
+	// Virtual Clock으로 전환. 이후 Now()는 start에서 Advance한 만큼만 증가
+	static void EnableVirtual(Clock::time_point start)
+	{
+		_virtualTicks.store(start.time_since_epoch().count(), std::memory_order_relaxed);
+		_virtual.store(true);
+	}
+
+	static void Advance(Clock::duration delta)
+	{
+		_virtualTicks.fetch_add(delta.count(), std::memory_order_relaxed);
+	}
+
+	static bool IsVirtual() { return _virtual.load(); }
+
+private:
+	static inline std::atomic<bool>						_virtual{ false };
+	static inline std::atomic<Clock::duration::rep>		_virtualTicks{ 0 };
+};
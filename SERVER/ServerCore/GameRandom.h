@@ -0,0 +1,38 @@
+#pragma once
+
+// Game Logic 난수 (Monster 이동 방향, Drop 확률, Teleport 위치 등)
+// SetSeed를 부르면 (Simulation) 이후 각 Thread의 Engine을 그 Seed로 다시 시작해서 같은 입력이면 같은 결과
+class GameRandom
+{
+public:
+	static void SetSeed(unsigned int seed)
+	{
+		_seed.store(seed);
+		_seeded.store(true);
+		_generation.fetch_add(1);
+	}
+
+	static std::mt19937& GetEngine()
+	{
+		thread_local std::mt19937 engine;
+		thread_local int generation{ -1 };
+
+		int current = _generation.load(std::memory_order_relaxed);
+		if (generation != current) {
+			engine.seed(_seeded.load() ? _seed.load() : std::random_device{}());
+			generation = current;
+		}
+		return engine;
+	}
+
+	// [minValue, maxValue]
+	static int Next(int minValue, int maxValue)
+	{
+		return std::uniform_int_distribution<int>{ minValue, maxValue }(GetEngine());
+	}
+
+private:
+	static inline std::atomic<unsigned int>	_seed{ 0 };
+	static inline std::atomic<bool>			_seeded{ false };
+	static inline std::atomic<int>			_generation{ 0 };
+};
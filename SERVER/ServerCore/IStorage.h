@@ -0,0 +1,81 @@
+#pragma once
+
+// Server 의존성 없이 단독으로 include할 수 있어야 함 (StorageBench 등 Linux Build에서 사용)
+#include <string>
+#include <utility>
+#include <vector>
+
+struct UserData {
+	int id;
+	int level;
+	long long exp;
+	short hp;
+	short maxHp;
+	short x;
+	short y;
+	int partyId;
+
+	bool operator==(const UserData& other) const = default;
+};
+
+struct QuestData {
+	int questId;
+	int progress;
+
+	bool operator==(const QuestData& other) const = default;
+};
+
+// Login 시 DB Thread에서 한 번에 읽어서 Game Thread로 넘기는 User 정보
+struct UserLoadResult {
+	bool success{ false };
+	UserData userData{ -1, 0, 0, 0, 0, 0, 0, -1 };
+	std::vector<std::pair<int, int>> items;
+	std::vector<QuestData> quests;
+};
+
+// User 저장소 공통 Interface
+// 모든 함수는 DBExecutor Thread에서 호출되며, 구현은 Thread별 연결을 따로 가짐
+class IStorage
+{
+public:
+	virtual ~IStorage() = default;
+
+public:
+	virtual bool Init(const std::string& connection) = 0;
+	virtual void Shutdown() = 0;
+
+	virtual bool CheckUserID(const std::wstring& userID) = 0;
+
+	virtual bool GetUserInfo(const std::wstring& userID, UserData& outData) = 0;
+	virtual bool UpdateUserInfo(const UserData& userData) = 0;
+
+	virtual std::vector<std::pair<int, int>> GetUserItems(const std::wstring& userID) = 0;
+	virtual bool UserGetItem(int userId, int itemId, int count) = 0;
+	virtual bool UserUseItem(int userId, int itemId, int count) = 0;
+
+	virtual std::vector<QuestData> GetUserQuests(const std::wstring& userID) = 0;
+	virtual bool UpdateUserQuests(int userId, const std::vector<QuestData>& quests) = 0;
+
+	virtual bool LoadUser(const std::wstring& userID, UserLoadResult& outResult)
+	{
+		// 1. 존재하는 ID인지 확인
+		if (not CheckUserID(userID)) {
+			return false;
+		}
+
+		// 2. 기본 정보
+		if (not GetUserInfo(userID, outResult.userData)) {
+			return false;
+		}
+
+		// 3. Item, Quest 목록
+		outResult.items = GetUserItems(userID);
+		outResult.quests = GetUserQuests(userID);
+
+		outResult.success = true;
+		return true;
+	}
+
+	// 호출한 Thread의 연결 해제 (DBExecutor Thread 종료 시)
+	virtual void CloseThreadConnection() {}
+};
@@ -7,7 +7,6 @@ void Inventory::AddItem(char itemId, int count)
 		return;
 	}
 
-	std::unique_lock lock{ _mutex };
 	_items[itemId] += count;
 }
 
@@ -17,8 +16,6 @@ bool Inventory::RemoveItem(char itemId, int count)
 		return false;
 	}
 
-	std::unique_lock lock{ _mutex };
-
 	if (not _items.contains(itemId)) {
 		return false;
 	}
@@ -38,8 +35,6 @@ bool Inventory::RemoveItem(char itemId, int count)
 
 int Inventory::GetItemCount(char itemId) const
 {
-	std::shared_lock lock{ _mutex };
-
 	if (_items.contains(itemId)) {
 		return _items.at(itemId);
 	}
@@ -49,6 +44,17 @@ int Inventory::GetItemCount(char itemId) const
 
 bool Inventory::HasItem(char itemId) const
 {
-	std::shared_lock lock{ _mutex };
 	return _items.contains(itemId);
 }
+
+std::vector<std::pair<char, int>> Inventory::GetItems() const
+{
+	std::vector<std::pair<char, int>> items;
+	items.reserve(_items.size());
+
+	for (const auto& [itemId, count] : _items) {
+		items.emplace_back(static_cast<char>(itemId), count);
+	}
+
+	return items;
+}
@@ -12,10 +12,12 @@ public:
 public:
 	int GetItemCount(char itemId) const;
 	bool HasItem(char itemId) const;
+
+	std::vector<std::pair<char, int>> GetItems() const;
 	
 private:
+	// 소유 Session의 Strand에서만 접근하므로 Lock 없음
 	std::unordered_map<int, int> _items;
-	mutable std::shared_mutex _mutex;
 
 	std::weak_ptr<GameSession> _owner;
 };
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "IocpCore.h"
 
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_NET
+
 int IocpCore::objectId{ 0 };
 
 IocpCore::IocpCore(const std::shared_ptr<Service>& service)
@@ -48,6 +51,10 @@ bool IocpCore::Dispatch(unsigned int timeoutMs)
 		}
 	}
 
+	// GQCS 대기 시간은 빼고 Completion 처리 구간만 기록
+	Watchdog::Heartbeat();
+	PROFILE_ZONE("IocpCore::Dispatch");
+
 	for (ULONG i = 0; i < numEntries; ++i) {
 		ExpOver* expOver = static_cast<ExpOver*>(entries[i].lpOverlapped);
 		ULONG_PTR key = entries[i].lpCompletionKey;
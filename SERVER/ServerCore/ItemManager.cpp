@@ -1,14 +1,13 @@
 #include "pch.h"
 #include "ItemManager.h"
 
-bool ItemManager::GetUserItem(const std::shared_ptr<GameSession>& session, const std::shared_ptr<Service>& service)
+bool ItemManager::LoadUserItems(const std::shared_ptr<GameSession>& session, const std::vector<std::pair<int, int>>& userItems)
 {
 	if (session->GetState() != ST_INGAME) {
 		return false;
 	}
 
 	auto& inventory = session->GetInventory();
-	auto userItems = service->GetUserItems(session);
 
 	for (auto& [itemId, count] : userItems) {
 		inventory->AddItem(itemId, count);
@@ -25,12 +24,12 @@ bool ItemManager::UseItem(const std::shared_ptr<GameSession>& session, int itemI
 		return false;
 	}
 
-	// 2. κ丮  ִ Ȯ
+	// 2. 인벤토리에 아이템 있는지 확인
 	if (not session->GetInventory()->HasItem(itemId)) {
 		return false;
 	}
 
-	// 3. ۺ б ó
+	// 3. 아이템별 분기 처리
 	switch (itemId) {
 	case HpPotion:
 		return HandleHpPotion(session, service);
@@ -43,7 +42,7 @@ bool ItemManager::UseItem(const std::shared_ptr<GameSession>& session, int itemI
 
 bool ItemManager::HandleHpPotion(const std::shared_ptr<GameSession>& session, const std::shared_ptr<Service>& service)
 {
-	// 1. Hp ȸ
+	// 1. Hp 회복
 	short hp = session->GetHp();
 	session->IncreaseHp(5);
 
@@ -53,10 +52,10 @@ bool ItemManager::HandleHpPotion(const std::shared_ptr<GameSession>& session, co
 
 	service->UserUseItem(session, HpPotion, 1);
 
-	// 2. κ丮 
+	// 2. 인벤토리에서 제거
 	session->GetInventory()->RemoveItem(HpPotion, 1);
 
-	// 3.  Packet Send
+	// 3. 성공 Packet Send
 	session->Send(PacketFactory::BuildUseItemOkPacket(HpPotion));
 	session->Send(PacketFactory::BuildStatChangePacket(*session));
 
@@ -5,7 +5,7 @@ class GameSession;
 class ItemManager
 {
 public:
-	bool GetUserItem(const std::shared_ptr<GameSession>& session, const std::shared_ptr<Service>& service);
+	bool LoadUserItems(const std::shared_ptr<GameSession>& session, const std::vector<std::pair<int, int>>& userItems);
 	bool UseItem(const std::shared_ptr<GameSession>& session, int itemId, const std::shared_ptr<Service>& service);
 
 private:
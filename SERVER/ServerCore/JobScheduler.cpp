@@ -0,0 +1,198 @@
+#include "pch.h"
+#include "JobScheduler.h"
+
+thread_local int JobScheduler::t_workerIndex{ -1 };
+
+JobScheduler::~JobScheduler()
+{
+	Stop();
+}
+
+void JobScheduler::Start(unsigned int workerCount)
+{
+	if (_running.load() or (not _queues.empty())) {
+		LOG_WRN("JobScheduler already started");
+		return;
+	}
+
+	workerCount = std::max<unsigned int>(1, workerCount);
+
+	// Queue를 다 만든 뒤에 _running을 올려야 Push가 빈 _queues를 보지 않음
+	_queues.reserve(workerCount);
+	for (unsigned int i = 0; i < workerCount; ++i) {
+		_queues.push_back(std::make_unique<WorkerQueue>());
+	}
+	_running.store(true);
+
+	_workers.reserve(workerCount);
+	for (unsigned int i = 0; i < workerCount; ++i) {
+		_workers.emplace_back(&JobScheduler::WorkerThread, this, static_cast<int>(i));
+	}
+
+	LOG_INF("JobScheduler started with %u workers", workerCount);
+}
+
+void JobScheduler::StartManual()
+{
+	if (_running.load() or (not _queues.empty())) {
+		LOG_WRN("JobScheduler already started");
+		return;
+	}
+
+	_queues.push_back(std::make_unique<WorkerQueue>());
+	_running.store(true);
+
+	LOG_INF("JobScheduler started in manual mode");
+}
+
+size_t JobScheduler::RunPending()
+{
+	if (not _workers.empty()) {
+		LOG_ERR("JobScheduler RunPending called with worker threads");
+		return 0;
+	}
+
+	// 실행 중에 새로 Push된 Job도 Queue가 빌 때까지 이어서 실행
+	size_t executed{ 0 };
+	while (_running.load()) {
+		Job job;
+		{
+			WorkerQueue& queue = *_queues[0];
+			std::lock_guard lock{ queue.mutex };
+			if (queue.jobs.empty()) {
+				break;
+			}
+
+			job = std::move(queue.jobs.front());
+			queue.jobs.pop_front();
+		}
+
+		_pendingCount.fetch_sub(1);
+		job();
+		++executed;
+	}
+
+	return executed;
+}
+
+void JobScheduler::Stop()
+{
+	if (not _running.exchange(false)) {
+		return;
+	}
+
+	// Predicate 확인과 Wait 사이의 Worker도 놓치지 않도록 _sleepMutex를 거쳐서 알림
+	{
+		std::lock_guard lock{ _sleepMutex };
+	}
+	_sleepCv.notify_all();
+
+	for (std::thread& worker : _workers) {
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+	_workers.clear();
+
+	// 남은 Job은 Service 종료 중이므로 실행하지 않고 버림
+	// Queue 자체는 소멸자까지 유지. Stop과 겹친 Push(IOCP, Timer, DB 완료)가 해제된 Queue를 보지 않음
+	for (auto& queue : _queues) {
+		std::lock_guard lock{ queue->mutex };
+		_pendingCount.fetch_sub(static_cast<int>(queue->jobs.size()));
+		queue->jobs.clear();
+	}
+}
+
+void JobScheduler::Push(Job job)
+{
+	if (not _running.load()) {
+		LOG_WRN("JobScheduler is not running, job dropped");
+		return;
+	}
+
+	// 1. Worker Thread에서 만든 Job은 자기 Queue에, 외부(I/O, Timer)에서 온 Job은 Round Robin
+	int index = t_workerIndex;
+	if (index < 0) {
+		index = static_cast<int>(_nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size());
+	}
+
+	{
+		WorkerQueue& queue = *_queues[index];
+		std::lock_guard lock{ queue.mutex };
+		queue.jobs.push_back(std::move(job));
+	}
+
+	// 2. 잠든 Worker가 있을 때만 깨우기
+	// Worker는 _sleepingCount를 올린 뒤 _pendingCount를 확인하므로 둘 중 하나는 반드시 상대 값을 봄
+	_pendingCount.fetch_add(1);
+	if (_sleepingCount.load() > 0) {
+		{
+			std::lock_guard lock{ _sleepMutex };
+		}
+		_sleepCv.notify_one();
+	}
+}
+
+bool JobScheduler::TryPop(int index, Job& job)
+{
+	WorkerQueue& queue = *_queues[index];
+	std::lock_guard lock{ queue.mutex };
+
+	if (queue.jobs.empty()) {
+		return false;
+	}
+
+	// 자기 Queue는 뒤에서 꺼내서 방금 넣은 Job의 Cache를 그대로 사용
+	job = std::move(queue.jobs.back());
+	queue.jobs.pop_back();
+	return true;
+}
+
+bool JobScheduler::TrySteal(int thief, Job& job)
+{
+	const int queueCount = static_cast<int>(_queues.size());
+
+	for (int i = 1; i < queueCount; ++i) {
+		WorkerQueue& victim = *_queues[(thief + i) % queueCount];
+
+		std::unique_lock lock{ victim.mutex, std::try_to_lock };
+		if ((not lock.owns_lock()) or victim.jobs.empty()) {
+			continue;
+		}
+
+		// 훔칠 때는 앞에서 꺼내서 가장 오래 기다린 Job부터 처리
+		job = std::move(victim.jobs.front());
+		victim.jobs.pop_front();
+		return true;
+	}
+
+	return false;
+}
+
+void JobScheduler::WorkerThread(int index)
+{
+	t_workerIndex = index;
+	Profiler::SetThreadName("Job Worker " + std::to_string(index));
+	Watchdog::RegisterWorker("Job Worker " + std::to_string(index));
+
+	while (_running.load()) {
+		Job job;
+		if (TryPop(index, job) or TrySteal(index, job)) {
+			_pendingCount.fetch_sub(1);
+			Watchdog::Heartbeat();
+			job();
+			continue;
+		}
+
+		Watchdog::Idle();
+
+		// Push가 _pendingCount를 올린 뒤 _sleepingCount를 보고 알림
+		std::unique_lock lock{ _sleepMutex };
+		_sleepingCount.fetch_add(1);
+		_sleepCv.wait(lock, [this]() { return (_pendingCount.load() > 0) or (not _running.load()); });
+		_sleepingCount.fetch_sub(1);
+	}
+
+	Watchdog::UnregisterWorker();
+	t_workerIndex = -1;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+using Job = std::function<void()>;
+
+// Worker마다 자기 Deque를 가지고, 비어 있으면 다른 Worker의 Job을 훔쳐오는 Scheduler
+class JobScheduler
+{
+	struct WorkerQueue {
+		std::deque<Job> jobs;
+		std::mutex mutex;
+	};
+
+public:
+	JobScheduler() = default;
+	~JobScheduler();
+
+public:
+	void Start(unsigned int workerCount);
+	void Stop();
+
+	void Push(Job job);
+
+public:
+	// Worker Thread 없이 시작. Push된 Job은 RunPending을 부른 Thread에서 들어온 순서대로 실행 (Simulation)
+	void StartManual();
+	size_t RunPending();
+
+public:
+	size_t GetWorkerCount() const { return _workers.size(); }
+	long long GetPendingCount() const { return _pendingCount.load(); }
+
+private:
+	bool TryPop(int index, Job& job);
+	bool TrySteal(int thief, Job& job);
+
+	void WorkerThread(int index);
+
+private:
+	std::vector<std::unique_ptr<WorkerQueue>> _queues;		// Start에서 만들고 소멸자까지 유지
+	std::vector<std::thread> _workers;
+
+	std::atomic<bool> _running{ false };
+	std::atomic<int> _pendingCount{ 0 };
+	std::atomic<unsigned int> _nextQueue{ 0 };
+	std::atomic<int> _sleepingCount{ 0 };		// _sleepCv에서 기다리는 Worker 수
+
+	std::mutex _sleepMutex;
+	std::condition_variable _sleepCv;
+
+	static thread_local int t_workerIndex;
+};
@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "Listener.h"
 
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_NET
+
 Listener::Listener(const std::shared_ptr<Service>& service)
 {
 	_service = service;
@@ -43,9 +46,16 @@ bool Listener::StartAccept()
 
 	SOCKADDR_IN addr;
 	addr.sin_family = AF_INET;
-	addr.sin_port = htons(SERVER_PORT);
+	addr.sin_port = htons(service->GetListenPort());
 	addr.sin_addr.s_addr = htonl(INADDR_ANY);
 
+	// Zone 분할이면 Gateway만 붙을 수 있도록 지정한 주소(기본 Loopback)에만 Listen
+	const std::string& listenAddress = service->GetListenAddress();
+	if ((not listenAddress.empty()) and (1 != inet_pton(AF_INET, listenAddress.c_str(), &addr.sin_addr))) {
+		LOG_ERR("invalid listen address: %s", listenAddress);
+		return false;
+	}
+
 	if (SOCKET_ERROR == bind(_socket, reinterpret_cast<sockaddr*>(&addr), sizeof(SOCKADDR_IN))) {
 		LOG_ERR("bind failed: %d", WSAGetLastError());
 		return false;
@@ -136,19 +146,19 @@ void Listener::AcceptCallback(AcceptOver* acceptOver)
 		return;
 	}
 
-	//  Session Acceptߴ Ȯ
+	// 어떤 Session이 Accept했는지 확인
 	std::shared_ptr<GameSession> session = acceptOver->_session;
 
 	setsockopt(session->GetSocket(), SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, (char*)&_socket, sizeof(_socket));
 
-	// session socket IocpCore 
+	// session의 socket을 IocpCore에 등록
 	service->GetIocpCore()->Register(session);
 
-	// session Service, Inventory 
+	// session의 Service, Inventory 등록
 	session->SetService(service);
 	session->SetInventory(std::make_shared<Inventory>(session));
 
-	// session Recv 
+	// session Recv 시작
 	session->doRecv();
 
 	LOG_INF("New Session[%d] accepted and initialized", session->GetId());
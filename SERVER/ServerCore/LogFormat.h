@@ -0,0 +1,219 @@
+#pragma once
+
+// Server(Logger)와 LogDecoder가 함께 쓰는 Log 인자 표현, 텍스트 포맷, Binary Log 파일 구조
+// Windows / pch에 의존하지 않아야 함
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+enum LogLevel : char
+{
+	Debug,
+	Info,
+	Warn,
+	Error
+};
+
+enum LogArgType : char
+{
+	LOG_ARG_SIGNED,
+	LOG_ARG_UNSIGNED,
+	LOG_ARG_DOUBLE,
+	LOG_ARG_POINTER,
+	LOG_ARG_TEXT
+};
+
+// 포맷하지 않은 인자 하나. 문자열은 별도 text 버퍼에 복사하고 offset만 보관
+struct LogArg {
+	LogArgType type;
+	union {
+		long long			i;
+		unsigned long long	u;
+		double				d;
+		const void*			p;
+		unsigned short		textOffset;
+	};
+};
+
+// Binary Log 파일 : [tag:u8][body] 가 연속으로 기록됨 (little endian, padding 없음)
+//  LOG_BIN_HEADER  : magic[8], version:u32                        (Logger::Init마다 한 번, Site id 초기화)
+//  LOG_BIN_SITE    : siteId:u32, level:u8, module:u8, line:u32, fileLen:u16, file, fmtLen:u16, fmt
+//  LOG_BIN_EVENT   : siteId:u32, timeNs:i64, threadId:u32, argCount:u8, { type:u8, value:8 | textLen:u16, text }...
+//  LOG_BIN_DROPPED : timeNs:i64, threadId:u32, count:u64
+enum LogBinaryTag : char
+{
+	LOG_BIN_HEADER = 1,
+	LOG_BIN_SITE,
+	LOG_BIN_EVENT,
+	LOG_BIN_DROPPED
+};
+
+constexpr char LOG_BIN_MAGIC[8] = { 'G', 'S', 'B', 'L', 'O', 'G', '\0', '\0' };
+constexpr unsigned int LOG_BIN_VERSION = 1;
+
+class LogFormatter
+{
+public:
+	static const char* GetLevelString(int level)
+	{
+		switch (level) {
+		case LogLevel::Debug: return "DBG";
+		case LogLevel::Info: return "INF";
+		case LogLevel::Warn: return "WRN";
+		case LogLevel::Error: return "ERR";
+		default: return "";
+		}
+	}
+
+	// [time][LVL][file:line] message
+	static void AppendLine(std::string& out, const char* timeText, int level, const char* file, int line,
+		const char* fmt, const LogArg* args, int argCount, const char* text)
+	{
+		out += '[';
+		out += timeText;
+		out += "][";
+		out += GetLevelString(level);
+		out += "][";
+		out += file;
+		out += ':';
+		out += std::to_string(line);
+		out += "] ";
+
+		AppendArgs(out, fmt, args, argCount, text);
+		out += '\n';
+	}
+
+	static void AppendDropped(std::string& out, unsigned long long count)
+	{
+		out += '[';
+		out += GetLevelString(LogLevel::Warn);
+		out += "] ";
+		out += std::to_string(count);
+		out += " log records dropped (ring full)\n";
+	}
+
+	// printf 포맷을 직접 따라가면서 Spec 하나씩 snprintf
+	// length modifier는 버리고 저장된 인자 타입 기준으로 다시 붙임
+	static void AppendArgs(std::string& out, const char* fmt, const LogArg* args, int argCount, const char* text)
+	{
+		char buf[512];
+		int argIndex{ 0 };
+
+		for (const char* p = fmt; *p; ++p) {
+			if (*p != '%') {
+				out += *p;
+				continue;
+			}
+
+			if (*(p + 1) == '%') {
+				out += '%';
+				++p;
+				continue;
+			}
+
+			// 1. flag, width, precision은 그대로 사용
+			std::string spec{ "%" };
+			const char* q = p + 1;
+			while (*q and std::strchr("-+ #0123456789.", *q)) {
+				spec += *q++;
+			}
+
+			// 2. length modifier 제거
+			while (*q and std::strchr("hljztL", *q)) {
+				++q;
+			}
+
+			char conv = *q;
+			if ('\0' == conv) {
+				out.append(p);
+				break;
+			}
+
+			if (argIndex >= argCount) {
+				out.append(p, q + 1);
+				p = q;
+				continue;
+			}
+
+			// 3. 저장된 타입으로 포맷
+			const LogArg& arg = args[argIndex++];
+			int written{ 0 };
+			switch (conv) {
+			case 'd': case 'i':
+				spec += "ll";
+				spec += conv;
+				written = std::snprintf(buf, sizeof(buf), spec.c_str(), ToSigned(arg));
+				break;
+
+			case 'u': case 'x': case 'X': case 'o':
+				spec += "ll";
+				spec += conv;
+				written = std::snprintf(buf, sizeof(buf), spec.c_str(), ToUnsigned(arg));
+				break;
+
+			case 'c':
+				spec += conv;
+				written = std::snprintf(buf, sizeof(buf), spec.c_str(), static_cast<int>(ToSigned(arg)));
+				break;
+
+			case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+				spec += conv;
+				written = std::snprintf(buf, sizeof(buf), spec.c_str(), ToDouble(arg));
+				break;
+
+			case 's':
+				spec += conv;
+				written = std::snprintf(buf, sizeof(buf), spec.c_str(),
+					(LOG_ARG_TEXT == arg.type) ? text + arg.textOffset : "(?)");
+				break;
+
+			case 'p':
+				spec += conv;
+				written = std::snprintf(buf, sizeof(buf), spec.c_str(), (LOG_ARG_POINTER == arg.type) ? arg.p : nullptr);
+				break;
+
+			default:
+				out.append(p, q + 1);
+				break;
+			}
+
+			if (written > 0) {
+				out.append(buf, std::min<size_t>(written, sizeof(buf) - 1));
+			}
+			p = q;
+		}
+	}
+
+private:
+	static long long ToSigned(const LogArg& arg)
+	{
+		switch (arg.type) {
+		case LOG_ARG_SIGNED: return arg.i;
+		case LOG_ARG_UNSIGNED: return static_cast<long long>(arg.u);
+		case LOG_ARG_DOUBLE: return static_cast<long long>(arg.d);
+		default: return 0;
+		}
+	}
+
+	static unsigned long long ToUnsigned(const LogArg& arg)
+	{
+		switch (arg.type) {
+		case LOG_ARG_SIGNED: return static_cast<unsigned long long>(arg.i);
+		case LOG_ARG_UNSIGNED: return arg.u;
+		case LOG_ARG_DOUBLE: return static_cast<unsigned long long>(arg.d);
+		default: return 0;
+		}
+	}
+
+	static double ToDouble(const LogArg& arg)
+	{
+		switch (arg.type) {
+		case LOG_ARG_SIGNED: return static_cast<double>(arg.i);
+		case LOG_ARG_UNSIGNED: return static_cast<double>(arg.u);
+		case LOG_ARG_DOUBLE: return arg.d;
+		default: return 0.0;
+		}
+	}
+};
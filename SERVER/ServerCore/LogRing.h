@@ -0,0 +1,140 @@
+#pragma once
+
+#include <intrin.h>
+
+#include "LogFormat.h"
+
+constexpr int MAX_LOG_ARGS = 8;
+constexpr int LOG_TEXT_SIZE = 96;
+constexpr size_t LOG_RING_SIZE = 4096;	// 2의 거듭제곱
+
+// LOG_* Macro 호출 위치마다 하나씩 생기는 static 정보. 주소가 곧 call-site id
+struct LogSite {
+	char		level;
+	char		module;
+	const char*	file;
+	int			line;
+	const char*	fmt;
+};
+
+// 호출 Thread에서는 값만 채우고 포맷은 Logger Thread에서 수행
+struct LogRecord {
+	unsigned long long	timestamp;	// __rdtsc()
+	const LogSite*		site;
+	unsigned char		argCount;
+	unsigned short		textSize;
+	LogArg				args[MAX_LOG_ARGS];
+	char				text[LOG_TEXT_SIZE];
+
+	template<typename T>
+	void Push(const T& value)
+	{
+		LogArg& arg = args[argCount++];
+
+		using U = std::decay_t<T>;
+		if constexpr (std::is_same_v<U, const char*> or std::is_same_v<U, char*>) {
+			PushText(arg, value, (nullptr == value) ? 0 : std::strlen(value));
+		}
+		else if constexpr (std::is_same_v<U, std::string> or std::is_same_v<U, std::string_view>) {
+			PushText(arg, value.data(), value.size());
+		}
+		else if constexpr (std::is_enum_v<U>) {
+			arg.type = LOG_ARG_SIGNED;
+			arg.i = static_cast<long long>(value);
+		}
+		else if constexpr (std::is_floating_point_v<U>) {
+			arg.type = LOG_ARG_DOUBLE;
+			arg.d = static_cast<double>(value);
+		}
+		else if constexpr (std::is_integral_v<U> and std::is_signed_v<U>) {
+			arg.type = LOG_ARG_SIGNED;
+			arg.i = static_cast<long long>(value);
+		}
+		else if constexpr (std::is_integral_v<U>) {
+			arg.type = LOG_ARG_UNSIGNED;
+			arg.u = static_cast<unsigned long long>(value);
+		}
+		else {
+			static_assert(std::is_pointer_v<U>, "unsupported log argument type");
+			arg.type = LOG_ARG_POINTER;
+			arg.p = static_cast<const void*>(value);
+		}
+	}
+
+	void PushText(LogArg& arg, const char* str, size_t len)
+	{
+		// 남은 공간보다 긴 문자열은 잘라서 보관
+		size_t room = LOG_TEXT_SIZE - textSize - 1;
+		len = std::min(len, room);
+
+		arg.type = LOG_ARG_TEXT;
+		arg.textOffset = textSize;
+		if (len > 0) {
+			std::memcpy(text + textSize, str, len);
+		}
+		text[textSize + len] = '\0';
+		textSize += static_cast<unsigned short>(len + 1);
+	}
+};
+
+// Thread 하나가 쓰고 Logger Thread 하나가 읽는 고정 크기 Ring
+class LogRing
+{
+public:
+	LogRing(unsigned int threadId) : _threadId(threadId), _records(std::make_unique<LogRecord[]>(LOG_RING_SIZE)) {}
+
+public:
+	// Producer
+	LogRecord* Reserve()
+	{
+		unsigned long long head = _head.load(std::memory_order_relaxed);
+		if (head - _cachedTail >= LOG_RING_SIZE) {
+			_cachedTail = _tail.load(std::memory_order_acquire);
+			if (head - _cachedTail >= LOG_RING_SIZE) {
+				// 가득 차면 호출 Thread를 막지 않고 버림
+				_dropped.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+		}
+
+		LogRecord* record = &_records[head & (LOG_RING_SIZE - 1)];
+		record->argCount = 0;
+		record->textSize = 0;
+		return record;
+	}
+
+	void Commit() { _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+	void Close() { _closed.store(true, std::memory_order_release); }
+
+public:
+	// Consumer
+	const LogRecord* Front()
+	{
+		unsigned long long tail = _tail.load(std::memory_order_relaxed);
+		if (tail == _cachedHead) {
+			_cachedHead = _head.load(std::memory_order_acquire);
+			if (tail == _cachedHead) {
+				return nullptr;
+			}
+		}
+		return &_records[tail & (LOG_RING_SIZE - 1)];
+	}
+
+	void Pop() { _tail.store(_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+	unsigned int GetThreadId() const { return _threadId; }
+	bool IsClosed() const { return _closed.load(std::memory_order_acquire); }
+	unsigned long long TakeDropped() { return _dropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+	alignas(64) std::atomic<unsigned long long>	_head{ 0 };
+	unsigned long long							_cachedTail{ 0 };
+
+	alignas(64) std::atomic<unsigned long long>	_tail{ 0 };
+	unsigned long long							_cachedHead{ 0 };
+
+	alignas(64) std::atomic<unsigned long long>	_dropped{ 0 };
+	std::atomic<bool>							_closed{ false };
+
+	unsigned int								_threadId;
+	std::unique_ptr<LogRecord[]>				_records;
+};
@@ -2,59 +2,61 @@
 #include "Logger.h"
 #include "DBManager.h"
 
-void Logger::Init(const std::string& filename, const std::string& basePath, LogLevel level)
+namespace
 {
-	_level.store(level, std::memory_order_relaxed);
-	if (not filename.empty()) {
-		_ofs = std::make_unique<std::ofstream>(filename, std::ios::app);
+	template<typename T>
+	void AppendRaw(std::string& out, const T& value)
+	{
+		out.append(reinterpret_cast<const char*>(&value), sizeof(T));
 	}
-	_basePath = NormalizePath(basePath);
-	_exitFlag.store(false);
-	_worker = std::thread(&Logger::WorkerThread);
 
+	void AppendRawText(std::string& out, const char* text, size_t len)
+	{
+		unsigned short size = static_cast<unsigned short>(std::min<size_t>(len, USHRT_MAX));
+		AppendRaw(out, size);
+		out.append(text, size);
+	}
 }
 
-void Logger::Log(LogLevel level, const char* file, int line, const char* fmt, ...)
+Logger::RingHolder::~RingHolder()
 {
-	if (level < _level.load(std::memory_order_relaxed))
-		return;
-
-	auto now = std::chrono::system_clock::now();
-	auto in_time_t = std::chrono::system_clock::to_time_t(now);
-
-	std::tm bt;
-	localtime_s(&bt, &in_time_t);
-
-	std::ostringstream ts;
-	ts << std::put_time(&bt, "%Y-%m-%d %H:%M:%S");
-
-	const char* levelString = "";
-	switch (level) {
-	case LogLevel::Debug: levelString = "DBG"; break;
-	case LogLevel::Info: levelString = "INF"; break;
-	case LogLevel::Warn: levelString = "WRN"; break;
-	case LogLevel::Error: levelString = "ERR"; break;
+	if (ring) {
+		_threadRing = nullptr;
+		ring->Close();
 	}
+}
 
-	std::string path = NormalizePath(file);
+void Logger::Init(const std::string& filename, const std::string& basePath, LogLevel level, LogSink sink)
+{
+	_level.store(level, std::memory_order_relaxed);
 
-	if (not _basePath.empty() && path.rfind(_basePath, 0) == 0) {
-		path.erase(0, _basePath.size());
+	// Binary Log는 파일로만 출력
+	_sink = filename.empty() ? LOG_SINK_TEXT : sink;
+	if (not filename.empty()) {
+		auto mode = (LOG_SINK_BINARY == _sink) ? (std::ios::app | std::ios::binary) : std::ios::app;
+		_ofs = std::make_unique<std::ofstream>(filename, mode);
 	}
+	_basePath = NormalizePath(basePath);
+	_block.reserve(LOG_BLOCK_SIZE);
 
-	ts << "[" << ts.str() << "][" << levelString << "][" << path << ":" << line << "] ";
+	if (LOG_SINK_BINARY == _sink) {
+		AppendRaw(_block, static_cast<char>(LOG_BIN_HEADER));
+		_block.append(LOG_BIN_MAGIC, sizeof(LOG_BIN_MAGIC));
+		AppendRaw(_block, LOG_BIN_VERSION);
+	}
 
-	va_list ap;
-	va_start(ap, fmt);
+	// Timestamp 카운터 주기 측정. 이후 WorkerThread에서 계속 보정
+	_baseTsc = __rdtsc();
+	_baseSteady = Clock::now();
+	_baseTime = std::chrono::system_clock::now();
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
 
-	char msg[512];
-	std::vsnprintf(msg, sizeof(msg), fmt, ap);
-	va_end(ap);
+	auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _baseSteady).count();
+	_tscPerNs = static_cast<double>(__rdtsc() - _baseTsc) / static_cast<double>(elapsedNs);
 
-	ts << msg << "\n";
+	_exitFlag.store(false);
+	_worker = std::thread(&Logger::WorkerThread);
 
-	auto buf = new std::string{ ts.str() };
-	_queue.push(buf);
 }
 
 void Logger::Shutdown()
@@ -69,6 +71,21 @@ void Logger::Shutdown()
 	}
 }
 
+LogRing* Logger::RegisterThread()
+{
+	thread_local RingHolder holder;
+
+	holder.ring = std::make_shared<LogRing>(static_cast<unsigned int>(::GetCurrentThreadId()));
+	{
+		std::lock_guard lock{ _ringsLock };
+		_rings.push_back(holder.ring);
+	}
+	_ringsVersion.fetch_add(1, std::memory_order_release);
+
+	_threadRing = holder.ring.get();
+	return _threadRing;
+}
+
 std::string Logger::NormalizePath(const std::string& p)
 {
 	std::string s = p;
@@ -79,31 +96,219 @@ std::string Logger::NormalizePath(const std::string& p)
 
 void Logger::WorkerThread()
 {
-	auto out = _ofs ? static_cast<std::ostream*>(_ofs.get()) : &std::cout;
-	std::vector<std::string*> batch;
-	batch.reserve(256);
+	Profiler::SetThreadName("Logger");
+
+	while (true) {
+		bool exiting = _exitFlag.load();
+		bool wrote = Drain();
+
+		// 한가할 때는 모인 만큼 바로 기록
+		WriteBlock(not wrote);
+
+		// 종료 요청 이후에는 더 이상 남은 Record가 없을 때까지 비운 뒤 종료
+		if (exiting and not wrote) {
+			break;
+		}
+
+		if (not wrote) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+}
+
+void Logger::WriteBlock(bool force)
+{
+	if (_block.empty() or ((not force) and (_block.size() < LOG_BLOCK_SIZE))) {
+		return;
+	}
+
+	PROFILE_ZONE("Logger::WriteBlock");
+
+	std::ostream& out = _ofs ? *_ofs : std::cout;
+	out.write(_block.data(), _block.size());
+	out.flush();
+	_block.clear();
+}
+
+bool Logger::Drain()
+{
+	PROFILE_ZONE("Logger::Drain");
+
+	static std::vector<std::shared_ptr<LogRing>> rings;
+	static int version{ -1 };
 
-	while (not _exitFlag.load() or not _queue.empty()) {
-		std::string* msg;
-		while (_queue.try_pop(msg)) {
-			batch.push_back(msg);
-			if (batch.size() >= 256) {
-				break;
+	// 1. 새로 등록된 Thread Ring 반영
+	int currentVersion = _ringsVersion.load(std::memory_order_acquire);
+	if (currentVersion != version) {
+		std::lock_guard lock{ _ringsLock };
+		rings = _rings;
+		version = currentVersion;
+	}
+
+	// 2. Timestamp 카운터 주기 보정
+	auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _baseSteady).count();
+	if (elapsedNs > 1'000'000'000) {
+		_tscPerNs = static_cast<double>(__rdtsc() - _baseTsc) / static_cast<double>(elapsedNs);
+	}
+
+	// 3. Ring마다 쌓인 Record를 Block에 모아서 큰 단위로 기록
+	bool wrote{ false };
+	std::vector<LogRing*> removed;
+	for (auto& ring : rings) {
+		// Close 이전에 Commit된 Record까지 모두 비운 뒤 제거해야 하므로 먼저 읽어둠
+		bool closed = ring->IsClosed();
+
+		while (const LogRecord* record = ring->Front()) {
+			if (LOG_SINK_BINARY == _sink) {
+				AppendBinary(*record, ring->GetThreadId());
+			}
+			else {
+				AppendText(*record);
 			}
+
+			ring->Pop();
+			wrote = true;
+			WriteBlock(false);
 		}
 
-		for (auto s : batch) {
-			(*out) << *s;
-			delete s;
+		if (auto dropped = ring->TakeDropped(); dropped > 0) {
+			AppendDropped(dropped, ring->GetThreadId());
+			wrote = true;
 		}
 
-		if (not batch.empty()) {
-			out->flush();
-			batch.clear();
+		if (closed) {
+			removed.push_back(ring.get());
+			ring.reset();
 		}
+	}
 
-		if (_queue.empty()) {
-			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	// 4. 종료된 Thread의 Ring 정리
+	if (not removed.empty()) {
+		std::erase(rings, nullptr);
+
+		std::lock_guard lock{ _ringsLock };
+		std::erase_if(_rings, [&removed](const std::shared_ptr<LogRing>& ring) {
+			return std::find(removed.begin(), removed.end(), ring.get()) != removed.end();
+			});
+	}
+
+	return wrote;
+}
+
+void Logger::AppendText(const LogRecord& record)
+{
+	const LogSite& site = *record.site;
+	LogFormatter::AppendLine(_block, GetTimeText(record.timestamp), site.level, GetRelativePath(site.file).c_str(), site.line,
+		site.fmt, record.args, record.argCount, record.text);
+}
+
+void Logger::AppendBinary(const LogRecord& record, unsigned int threadId)
+{
+	unsigned int siteId = GetSiteId(record.site);
+	long long timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(ToTime(record.timestamp).time_since_epoch()).count();
+
+	AppendRaw(_block, static_cast<char>(LOG_BIN_EVENT));
+	AppendRaw(_block, siteId);
+	AppendRaw(_block, timeNs);
+	AppendRaw(_block, threadId);
+	AppendRaw(_block, record.argCount);
+
+	for (int i = 0; i < record.argCount; ++i) {
+		const LogArg& arg = record.args[i];
+		AppendRaw(_block, arg.type);
+
+		if (LOG_ARG_TEXT == arg.type) {
+			const char* text = record.text + arg.textOffset;
+			AppendRawText(_block, text, std::strlen(text));
 		}
+		else {
+			AppendRaw(_block, arg.u);
+		}
+	}
+}
+
+void Logger::AppendDropped(unsigned long long count, unsigned int threadId)
+{
+	if (LOG_SINK_TEXT == _sink) {
+		LogFormatter::AppendDropped(_block, count);
+		return;
+	}
+
+	long long timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+
+	AppendRaw(_block, static_cast<char>(LOG_BIN_DROPPED));
+	AppendRaw(_block, timeNs);
+	AppendRaw(_block, threadId);
+	AppendRaw(_block, count);
+}
+
+unsigned int Logger::GetSiteId(const LogSite* site)
+{
+	// 처음 나온 call-site만 정의 Record를 남기고 이후에는 id만 기록
+	static std::unordered_map<const LogSite*, unsigned int> siteIds;
+
+	auto it = siteIds.find(site);
+	if (it != siteIds.end()) {
+		return it->second;
+	}
+
+	unsigned int siteId = static_cast<unsigned int>(siteIds.size());
+	siteIds.emplace(site, siteId);
+
+	const std::string& file = GetRelativePath(site->file);
+	AppendRaw(_block, static_cast<char>(LOG_BIN_SITE));
+	AppendRaw(_block, siteId);
+	AppendRaw(_block, site->level);
+	AppendRaw(_block, site->module);
+	AppendRaw(_block, site->line);
+	AppendRawText(_block, file.data(), file.size());
+	AppendRawText(_block, site->fmt, std::strlen(site->fmt));
+
+	return siteId;
+}
+
+std::chrono::system_clock::time_point Logger::ToTime(unsigned long long timestamp)
+{
+	// Init 이전에 기록된 Record는 기준점보다 이전 시간이 될 수 있음
+	double deltaNs = static_cast<double>(static_cast<long long>(timestamp - _baseTsc)) / _tscPerNs;
+	return _baseTime + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+		std::chrono::duration<double, std::nano>(deltaNs));
+}
+
+const char* Logger::GetTimeText(unsigned long long timestamp)
+{
+	static time_t cachedSecond{ -1 };
+	static char cachedText[32];
+
+	// 같은 초 안의 Record는 이전 결과 재사용
+	time_t second = std::chrono::system_clock::to_time_t(ToTime(timestamp));
+	if (second != cachedSecond) {
+		std::tm bt;
+		localtime_s(&bt, &second);
+		std::strftime(cachedText, sizeof(cachedText), "%Y-%m-%d %H:%M:%S", &bt);
+		cachedSecond = second;
 	}
-}
\ No newline at end of file
+
+	return cachedText;
+}
+
+const std::string& Logger::GetRelativePath(const char* file)
+{
+	// __FILE__은 리터럴이므로 포인터 단위로 한 번만 변환
+	static std::unordered_map<const char*, std::string> cache;
+
+	auto it = cache.find(file);
+	if (it != cache.end()) {
+		return it->second;
+	}
+
+	std::string path{ file };
+	std::replace(path.begin(), path.end(), '\\', '/');
+
+	if (not _basePath.empty() && path.rfind(_basePath, 0) == 0) {
+		path.erase(0, _basePath.size());
+	}
+
+	return cache.emplace(file, std::move(path)).first->second;
+}
@@ -5,34 +5,120 @@
 #include <iomanip>
 #include <sstream>
 
-enum LogLevel : char
+#include "LogRing.h"
+
+// Runtime에 Subsystem 단위로 끄고 켤 수 있는 Log 분류
+enum LogModule : char
+{
+	LOG_MODULE_CORE,
+	LOG_MODULE_NET,
+	LOG_MODULE_VIEW,
+	LOG_MODULE_NPC,
+	LOG_MODULE_DB,
+	LOG_MODULE_QUEST,
+	LOG_MODULE_COUNT
+};
+
+constexpr unsigned int LOG_MODULE_ALL = (1u << LOG_MODULE_COUNT) - 1;
+
+// LOG_SINK_BINARY는 포맷 없이 Record를 그대로 기록. SERVER/LogDecoder로 텍스트 변환
+enum LogSink : char
 {
-	Debug,
-	Info,
-	Warn,
-	Error
+	LOG_SINK_TEXT,
+	LOG_SINK_BINARY
 };
 
+constexpr size_t LOG_BLOCK_SIZE = 1 << 20;
+
 class Logger
 {
+	using Clock = std::chrono::steady_clock;
+
+	// Thread 종료 시 Ring을 닫아서 WorkerThread가 남은 Record를 비운 뒤 정리하도록 함
+	struct RingHolder {
+		std::shared_ptr<LogRing> ring;
+		~RingHolder();
+	};
+
 public:
-	static void Init(const std::string& filename = "", const std::string& basePath = "", LogLevel level = LogLevel::Info);
+	static void Init(const std::string& filename = "", const std::string& basePath = "", LogLevel level = LogLevel::Info, LogSink sink = LOG_SINK_TEXT);
 	static void Shutdown();
 
-	static void Log(LogLevel level, const char* file, int line, const char* fmt, ...);
+	// 호출 Thread는 자기 Ring에 call-site, Timestamp, 인자만 기록. 포맷과 출력은 WorkerThread에서 수행
+	template<typename... Args>
+	static void Log(const LogSite& site, const Args&... args)
+	{
+		static_assert(sizeof...(Args) <= MAX_LOG_ARGS, "too many log arguments");
+
+		if (site.level < _level.load(std::memory_order_relaxed))
+			return;
+
+		LogRing* ring = _threadRing;
+		if (nullptr == ring) {
+			ring = RegisterThread();
+		}
+
+		LogRecord* record = ring->Reserve();
+		if (nullptr == record)
+			return;
+
+		record->timestamp = __rdtsc();
+		record->site = &site;
+		(record->Push(args), ...);
+
+		ring->Commit();
+	}
 	
 	static void SetLevel(LogLevel level) { _level.store(level); }
+	static void SetModuleMask(unsigned int mask) { _moduleMask.store(mask & LOG_MODULE_ALL); }
+	static void EnableModule(LogModule module, bool enable)
+	{
+		if (enable) _moduleMask.fetch_or(1u << module);
+		else _moduleMask.fetch_and(~(1u << module));
+	}
+
+	// LOG_* Macro에서 인자를 평가하기 전에 호출
+	static bool IsEnabled(LogLevel level, LogModule module)
+	{
+		return (level >= _level.load(std::memory_order_relaxed))
+			and (_moduleMask.load(std::memory_order_relaxed) & (1u << module));
+	}
 
 private:
+	static LogRing* RegisterThread();
 	static std::string NormalizePath(const std::string& p);
 	static void WorkerThread();
 
+	static bool Drain();
+	static void WriteBlock(bool force);
+
+	static void AppendText(const LogRecord& record);
+	static void AppendBinary(const LogRecord& record, unsigned int threadId);
+	static void AppendDropped(unsigned long long count, unsigned int threadId);
+	static unsigned int GetSiteId(const LogSite* site);
+
+	static std::chrono::system_clock::time_point ToTime(unsigned long long timestamp);
+	static const char* GetTimeText(unsigned long long timestamp);
+	static const std::string& GetRelativePath(const char* file);
+
 private:
 	static inline std::string									_basePath;
 	static inline std::atomic<LogLevel>							_level{ LogLevel::Info };
+	static inline std::atomic<unsigned int>						_moduleMask{ LOG_MODULE_ALL };
 	static inline std::unique_ptr<std::ofstream>				_ofs;
-	static inline concurrency::concurrent_queue<std::string*>	_queue;
+	static inline LogSink										_sink{ LOG_SINK_TEXT };
+	static inline std::string									_block;
 	static inline std::thread									_worker;
 	static inline std::atomic<bool>								_exitFlag{ false };
-};
 
+	static inline thread_local LogRing*							_threadRing{ nullptr };
+	static inline std::mutex									_ringsLock;
+	static inline std::vector<std::shared_ptr<LogRing>>			_rings;
+	static inline std::atomic<int>								_ringsVersion{ 0 };
+
+	// Timestamp 카운터를 벽시계 시간으로 바꾸기 위한 기준점
+	static inline unsigned long long							_baseTsc{ 0 };
+	static inline Clock::time_point								_baseSteady;
+	static inline std::chrono::system_clock::time_point			_baseTime;
+	static inline double										_tscPerNs{ 1.0 };
+};
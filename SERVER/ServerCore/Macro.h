@@ -1,8 +1,72 @@
 #pragma once
 
+#ifdef SERVERCORE_PORTABLE
+
+// Logger 없이 ServerCore 일부만 빌드하는 Linux 도구 (SERVER/MicroBench)는 Log 호출을 모두 제거
+#define LOG_DBG(fmt, ...) do {} while (0)
+#define LOG_INF(fmt, ...) do {} while (0)
+#define LOG_WRN(fmt, ...) do {} while (0)
+#define LOG_ERR(fmt, ...) do {} while (0)
+
+#define PROFILE_ZONE(name) do {} while (0)
+
+#else
+
 #include "Logger.h"
 
-#define LOG_DBG(fmt, ...) Logger::Log(LogLevel::Debug, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#define LOG_INF(fmt, ...) Logger::Log(LogLevel::Info , __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#define LOG_WRN(fmt, ...) Logger::Log(LogLevel::Warn , __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#define LOG_ERR(fmt, ...) Logger::Log(LogLevel::Error, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
\ No newline at end of file
+// 컴파일 타임 최소 Level. 이보다 낮은 Log는 호출 자체가 사라짐
+// Release는 DEBUG만 제거하고 INFO부터 남김. 운영 Build에서 WARN만 남기려면 /D LOG_MIN_LEVEL=2
+#define LOG_LEVEL_DEBUG	0
+#define LOG_LEVEL_INFO	1
+#define LOG_LEVEL_WARN	2
+#define LOG_LEVEL_ERROR	3
+
+#ifndef LOG_MIN_LEVEL
+#ifdef _DEBUG
+#define LOG_MIN_LEVEL LOG_LEVEL_DEBUG
+#else
+#define LOG_MIN_LEVEL LOG_LEVEL_INFO
+#endif
+#endif
+
+// File마다 Module을 바꾸려면 pch 이후에 #undef LOG_MODULE / #define LOG_MODULE LOG_MODULE_XXX
+#define LOG_MODULE LOG_MODULE_CORE
+
+// Level과 Module Mask를 인자 평가 전에 확인. 호출 위치마다 static LogSite 하나가 call-site id
+#define LOG_WRITE(level, fmt, ...) \
+	do { \
+		if (Logger::IsEnabled(level, LOG_MODULE)) { \
+			static constexpr LogSite logSite{ level, LOG_MODULE, __FILE__, __LINE__, fmt }; \
+			Logger::Log(logSite, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+#define LOG_DISABLED(fmt, ...) do {} while (0)
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DBG(fmt, ...) LOG_WRITE(LogLevel::Debug, fmt, ##__VA_ARGS__)
+#else
+#define LOG_DBG(fmt, ...) LOG_DISABLED(fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INF(fmt, ...) LOG_WRITE(LogLevel::Info , fmt, ##__VA_ARGS__)
+#else
+#define LOG_INF(fmt, ...) LOG_DISABLED(fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_WARN
+#define LOG_WRN(fmt, ...) LOG_WRITE(LogLevel::Warn , fmt, ##__VA_ARGS__)
+#else
+#define LOG_WRN(fmt, ...) LOG_DISABLED(fmt, ##__VA_ARGS__)
+#endif
+
+#define LOG_ERR(fmt, ...) LOG_WRITE(LogLevel::Error, fmt, ##__VA_ARGS__)
+
+// 현재 Scope를 Profile Zone으로 기록 (Profiler::Capture 중에만). name은 문자열 상수
+// Watchdog에 등록된 Worker에서는 Stall Report에 표시할 현재 Handler로도 기록
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__){ name }; WatchdogZone PROFILE_CONCAT(watchdogZone, __LINE__){ name }
+
+#endif
@@ -0,0 +1,302 @@
+#include "pch.h"
+#include "Metrics.h"
+
+#include <bit>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+	const char* GetHistogramName(int id)
+	{
+		switch (id) {
+		case METRIC_SEND_QUEUE_DEPTH: return "sendQueueDepth";
+		case METRIC_TIMER_LAG_US: return "timerLagUs";
+		case METRIC_ASTAR_EXPANSIONS: return "astarExpansions";
+		case METRIC_DB_LATENCY_US: return "dbLatencyUs";
+		case METRIC_DB_EXEC_US: return "dbExecUs";
+		default: return "unknown";
+		}
+	}
+
+	void AppendSummary(std::string& out, const MetricSummary& summary)
+	{
+		unsigned long long mean = (summary.count > 0) ? (summary.sum / summary.count) : 0;
+
+		out += "{\"count\":" + std::to_string(summary.count);
+		out += ",\"mean\":" + std::to_string(mean);
+		out += ",\"p50\":" + std::to_string(summary.GetPercentile(50.0));
+		out += ",\"p90\":" + std::to_string(summary.GetPercentile(90.0));
+		out += ",\"p99\":" + std::to_string(summary.GetPercentile(99.0));
+		out += ",\"p999\":" + std::to_string(summary.GetPercentile(99.9));
+		out += ",\"max\":" + std::to_string(summary.max);
+		out += '}';
+	}
+
+	// {"<packet type>":{"count":n,"bytes":n},...}
+	void AppendPacketCounts(std::string& out, const std::array<unsigned long long, METRIC_PACKET_TYPE_COUNT>& counts,
+		const std::array<unsigned long long, METRIC_PACKET_TYPE_COUNT>& bytes)
+	{
+		out += '{';
+		bool first{ true };
+		for (int type = 0; type < METRIC_PACKET_TYPE_COUNT; ++type) {
+			if (0 == counts[type]) {
+				continue;
+			}
+
+			if (not first) out += ',';
+			first = false;
+
+			out += '"' + std::to_string(type) + "\":{\"count\":" + std::to_string(counts[type]);
+			out += ",\"bytes\":" + std::to_string(bytes[type]) + '}';
+		}
+		out += '}';
+	}
+}
+
+int MetricHistogram::GetBucketIndex(unsigned long long value)
+{
+	if (value < METRIC_SUB_BUCKET_COUNT) {
+		return static_cast<int>(value);
+	}
+
+	// 최상위 bit 아래 3bit가 구간 안의 sub bucket
+	int shift = static_cast<int>(std::bit_width(value)) - 1 - METRIC_SUB_BUCKET_BITS;
+	int subBucket = static_cast<int>((value >> shift) & (METRIC_SUB_BUCKET_COUNT - 1));
+	return METRIC_SUB_BUCKET_COUNT * (shift + 1) + subBucket;
+}
+
+unsigned long long MetricHistogram::GetBucketUpperBound(int index)
+{
+	if (index < METRIC_SUB_BUCKET_COUNT) {
+		return static_cast<unsigned long long>(index);
+	}
+
+	int shift = index / METRIC_SUB_BUCKET_COUNT - 1;
+	unsigned long long subBucket = static_cast<unsigned long long>(index % METRIC_SUB_BUCKET_COUNT);
+	unsigned long long lower = (METRIC_SUB_BUCKET_COUNT + subBucket) << shift;
+	return lower + ((1ULL << shift) - 1);
+}
+
+void MetricSummary::Merge(const MetricHistogram& histogram)
+{
+	for (int i = 0; i < METRIC_BUCKET_COUNT; ++i) {
+		buckets[i] += histogram._buckets[i].load(std::memory_order_relaxed);
+	}
+
+	count += histogram._count.load(std::memory_order_relaxed);
+	sum += histogram._sum.load(std::memory_order_relaxed);
+	max = std::max(max, histogram._max.load(std::memory_order_relaxed));
+}
+
+unsigned long long MetricSummary::GetPercentile(double percentile) const
+{
+	if (0 == count) {
+		return 0;
+	}
+
+	// Bucket 합은 count와 순간적으로 어긋날 수 있으므로 Bucket 합 기준으로 계산
+	unsigned long long total{ 0 };
+	for (unsigned long long bucket : buckets) {
+		total += bucket;
+	}
+
+	unsigned long long target = static_cast<unsigned long long>(static_cast<double>(total) * percentile / 100.0 + 0.5);
+	target = std::clamp<unsigned long long>(target, 1, total);
+
+	unsigned long long seen{ 0 };
+	for (int i = 0; i < METRIC_BUCKET_COUNT; ++i) {
+		seen += buckets[i];
+		if (seen >= target) {
+			return std::min(MetricHistogram::GetBucketUpperBound(i), max);
+		}
+	}
+	return max;
+}
+
+MetricShard::~MetricShard()
+{
+	for (auto& histogram : handlerUs) {
+		delete histogram.load();
+	}
+}
+
+MetricShard* Metrics::RegisterThread()
+{
+	auto shard = std::make_unique<MetricShard>();
+	MetricShard* raw = shard.get();
+	{
+		std::lock_guard lock{ _shardsLock };
+		_shards.push_back(std::move(shard));
+	}
+
+	_threadShard = raw;
+	return raw;
+}
+
+void Metrics::RecordHandler(unsigned char type, Clock::time_point start)
+{
+	long long elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+
+	MetricShard& shard = GetShard();
+	MetricHistogram* histogram = shard.handlerUs[type].load(std::memory_order_relaxed);
+	if (nullptr == histogram) {
+		// 소유 Thread만 생성하므로 경쟁 없음. Snapshot Thread가 초기화된 Histogram을 보도록 release
+		histogram = new MetricHistogram;
+		shard.handlerUs[type].store(histogram, std::memory_order_release);
+	}
+
+	histogram->Record(static_cast<unsigned long long>(std::max(0LL, elapsedUs)));
+}
+
+void Metrics::AddGaugeProvider(MetricGaugeProvider provider)
+{
+	std::lock_guard lock{ _providersLock };
+	_providers.push_back(std::move(provider));
+}
+
+void Metrics::ClearGaugeProviders()
+{
+	std::lock_guard lock{ _providersLock };
+	_providers.clear();
+}
+
+std::string Metrics::Snapshot()
+{
+	std::array<unsigned long long, METRIC_PACKET_TYPE_COUNT> packetsIn{}, bytesIn{}, packetsOut{}, bytesOut{};
+	std::vector<MetricSummary> handlers(METRIC_PACKET_TYPE_COUNT);
+	std::vector<MetricSummary> histograms(METRIC_HISTOGRAM_COUNT);
+
+	// 1. Thread별 Shard 합산
+	{
+		std::lock_guard lock{ _shardsLock };
+		for (const auto& shard : _shards) {
+			for (int type = 0; type < METRIC_PACKET_TYPE_COUNT; ++type) {
+				packetsIn[type] += shard->packetsIn[type].load(std::memory_order_relaxed);
+				bytesIn[type] += shard->bytesIn[type].load(std::memory_order_relaxed);
+				packetsOut[type] += shard->packetsOut[type].load(std::memory_order_relaxed);
+				bytesOut[type] += shard->bytesOut[type].load(std::memory_order_relaxed);
+
+				if (const MetricHistogram* histogram = shard->handlerUs[type].load(std::memory_order_acquire)) {
+					handlers[type].Merge(*histogram);
+				}
+			}
+
+			for (int id = 0; id < METRIC_HISTOGRAM_COUNT; ++id) {
+				histograms[id].Merge(shard->histograms[id]);
+			}
+		}
+	}
+
+	// 2. Gauge 수집
+	MetricGauges gauges;
+	{
+		std::lock_guard lock{ _providersLock };
+		for (const auto& provider : _providers) {
+			provider(gauges);
+		}
+	}
+
+	// 3. JSON
+	auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+	std::string out;
+	out.reserve(8192);
+	out += "{\"timeMs\":" + std::to_string(now);
+
+	out += ",\"packetsIn\":";
+	AppendPacketCounts(out, packetsIn, bytesIn);
+	out += ",\"packetsOut\":";
+	AppendPacketCounts(out, packetsOut, bytesOut);
+
+	out += ",\"handlerUs\":{";
+	bool first{ true };
+	for (int type = 0; type < METRIC_PACKET_TYPE_COUNT; ++type) {
+		if (0 == handlers[type].count) {
+			continue;
+		}
+
+		if (not first) out += ',';
+		first = false;
+
+		out += '"' + std::to_string(type) + "\":";
+		AppendSummary(out, handlers[type]);
+	}
+	out += '}';
+
+	for (int id = 0; id < METRIC_HISTOGRAM_COUNT; ++id) {
+		out += ",\"";
+		out += GetHistogramName(id);
+		out += "\":";
+		AppendSummary(out, histograms[id]);
+	}
+
+	out += ",\"gauges\":{";
+	for (size_t i = 0; i < gauges.size(); ++i) {
+		if (i > 0) out += ',';
+		out += '"' + gauges[i].first + "\":" + std::to_string(gauges[i].second);
+	}
+	out += "}}";
+
+	return out;
+}
+
+void Metrics::StartDump(const std::string& path, int intervalMs)
+{
+	StopDump();
+
+	{
+		std::lock_guard lock{ _dumpLock };
+		_dumpStop = false;
+	}
+	_dumpThread = std::thread(&Metrics::DumpThread, path, intervalMs);
+}
+
+void Metrics::StopDump()
+{
+	{
+		std::lock_guard lock{ _dumpLock };
+		_dumpStop = true;
+	}
+	_dumpCv.notify_all();
+
+	if (_dumpThread.joinable()) {
+		_dumpThread.join();
+	}
+}
+
+void Metrics::DumpThread(std::string path, int intervalMs)
+{
+	std::unique_lock lock{ _dumpLock };
+	while (not _dumpStop) {
+		_dumpCv.wait_for(lock, std::chrono::milliseconds(intervalMs), []() { return _dumpStop; });
+
+		// 종료 시에도 마지막 값을 한 번 남김
+		lock.unlock();
+		WriteDump(path);
+		lock.lock();
+	}
+}
+
+bool Metrics::WriteDump(const std::string& path)
+{
+	// 1. 임시 파일에 기록
+	std::string tempPath = path + ".tmp";
+	{
+		std::ofstream ofs{ tempPath, std::ios::trunc };
+		if (not ofs) {
+			LOG_WRN("Metrics dump open failed: %s", tempPath);
+			return false;
+		}
+		ofs << Snapshot() << '\n';
+	}
+
+	// 2. 읽는 쪽이 중간 상태를 보지 않도록 교체
+	std::error_code ec;
+	std::filesystem::rename(tempPath, path, ec);
+	if (ec) {
+		LOG_WRN("Metrics dump rename failed: %s", ec.message());
+		return false;
+	}
+	return true;
+}
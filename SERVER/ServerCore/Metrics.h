@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// log-linear Histogram : 8 미만은 값 그대로, 그 이상은 2의 거듭제곱 구간마다 8칸 (상대 오차 12.5% 이내)
+constexpr int METRIC_SUB_BUCKET_BITS = 3;
+constexpr int METRIC_SUB_BUCKET_COUNT = 1 << METRIC_SUB_BUCKET_BITS;
+constexpr int METRIC_BUCKET_COUNT = METRIC_SUB_BUCKET_COUNT * (64 - METRIC_SUB_BUCKET_BITS + 1);
+constexpr int METRIC_PACKET_TYPE_COUNT = 256;
+
+constexpr int METRIC_DUMP_INTERVAL_MS = 5000;
+
+enum MetricHistogramId : char
+{
+	METRIC_SEND_QUEUE_DEPTH,	// Session::Send 시점의 Send Queue 길이
+	METRIC_TIMER_LAG_US,		// Timer Event 예정 시각 ~ 실제 처리 시각
+	METRIC_ASTAR_EXPANSIONS,	// AStar 한 번에 확장한 Node 수
+	METRIC_DB_LATENCY_US,		// DBExecutor Post ~ 실행 완료
+	METRIC_DB_EXEC_US,			// DB Job 실행 시간
+	METRIC_HISTOGRAM_COUNT
+};
+
+// 하나의 Thread만 기록하고 Snapshot Thread는 읽기만 함. 그래서 fetch_add 없이 relaxed load/store
+class MetricHistogram
+{
+public:
+	void Record(unsigned long long value)
+	{
+		Add(_buckets[GetBucketIndex(value)], 1);
+		Add(_count, 1);
+		Add(_sum, value);
+		if (value > _max.load(std::memory_order_relaxed)) {
+			_max.store(value, std::memory_order_relaxed);
+		}
+	}
+
+	static int GetBucketIndex(unsigned long long value);
+	static unsigned long long GetBucketUpperBound(int index);
+
+	static void Add(std::atomic<unsigned long long>& counter, unsigned long long value)
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+private:
+	friend struct MetricSummary;
+
+	std::array<std::atomic<unsigned long long>, METRIC_BUCKET_COUNT>	_buckets{};
+	std::atomic<unsigned long long>										_count{ 0 };
+	std::atomic<unsigned long long>										_sum{ 0 };
+	std::atomic<unsigned long long>										_max{ 0 };
+};
+
+// Snapshot용 합산 결과
+struct MetricSummary {
+	std::array<unsigned long long, METRIC_BUCKET_COUNT> buckets{};
+	unsigned long long count{ 0 };
+	unsigned long long sum{ 0 };
+	unsigned long long max{ 0 };
+
+	void Merge(const MetricHistogram& histogram);
+	unsigned long long GetPercentile(double percentile) const;
+};
+
+// Thread별 Counter 묶음. 한 번 등록되면 Thread가 끝나도 값 보존을 위해 해제하지 않음
+struct MetricShard {
+	std::array<std::atomic<unsigned long long>, METRIC_PACKET_TYPE_COUNT>	packetsIn{};
+	std::array<std::atomic<unsigned long long>, METRIC_PACKET_TYPE_COUNT>	bytesIn{};
+	std::array<std::atomic<unsigned long long>, METRIC_PACKET_TYPE_COUNT>	packetsOut{};
+	std::array<std::atomic<unsigned long long>, METRIC_PACKET_TYPE_COUNT>	bytesOut{};
+
+	// Handler Histogram은 실제로 처리한 Packet Type만 소유 Thread가 만들어서 publish
+	std::array<std::atomic<MetricHistogram*>, METRIC_PACKET_TYPE_COUNT>		handlerUs{};
+	std::array<MetricHistogram, METRIC_HISTOGRAM_COUNT>						histograms;
+
+	~MetricShard();
+};
+
+// 이름 - 값 목록. Snapshot 시점에 Provider가 채움 (Session State별 수, DB Queue 등)
+using MetricGauges = std::vector<std::pair<std::string, long long>>;
+using MetricGaugeProvider = std::function<void(MetricGauges&)>;
+
+class Metrics
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+public:
+	static void AddPacketIn(unsigned char type, size_t bytes)
+	{
+		MetricShard& shard = GetShard();
+		MetricHistogram::Add(shard.packetsIn[type], 1);
+		MetricHistogram::Add(shard.bytesIn[type], bytes);
+	}
+
+	static void AddPacketOut(unsigned char type, size_t bytes)
+	{
+		MetricShard& shard = GetShard();
+		MetricHistogram::Add(shard.packetsOut[type], 1);
+		MetricHistogram::Add(shard.bytesOut[type], bytes);
+	}
+
+	static void Record(MetricHistogramId id, long long value)
+	{
+		GetShard().histograms[id].Record(static_cast<unsigned long long>(std::max(0LL, value)));
+	}
+
+	static void RecordHandler(unsigned char type, Clock::time_point start);
+
+	static void AddGaugeProvider(MetricGaugeProvider provider);
+	static void ClearGaugeProviders();
+
+	// 모든 Thread의 Shard를 합쳐서 JSON 한 줄로 만듦
+	static std::string Snapshot();
+
+	// intervalMs마다 Snapshot을 path에 덮어씀 (임시 파일에 쓴 뒤 rename)
+	static void StartDump(const std::string& path, int intervalMs = METRIC_DUMP_INTERVAL_MS);
+	static void StopDump();
+
+private:
+	static MetricShard& GetShard()
+	{
+		MetricShard* shard = _threadShard;
+		if (nullptr == shard) {
+			shard = RegisterThread();
+		}
+		return *shard;
+	}
+
+	static MetricShard* RegisterThread();
+	static void DumpThread(std::string path, int intervalMs);
+	static bool WriteDump(const std::string& path);
+
+private:
+	static inline thread_local MetricShard*						_threadShard{ nullptr };
+	static inline std::mutex									_shardsLock;
+	static inline std::vector<std::unique_ptr<MetricShard>>		_shards;
+
+	static inline std::mutex									_providersLock;
+	static inline std::vector<MetricGaugeProvider>				_providers;
+
+	static inline std::thread									_dumpThread;
+	static inline std::mutex									_dumpLock;
+	static inline std::condition_variable						_dumpCv;
+	static inline bool											_dumpStop{ false };
+};
@@ -1,35 +1,30 @@
 #include "pch.h"
 #include "Monster.h"
 
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_NPC
+
 Monster::Monster(int id, short x, short y, const std::string& name, MonsterType mType, MovementType mvType)
 	:GameObject(id, x, y), _basemonsterType(mType), _movementType(mvType), _currentMonsterType(mType)
 {
 	_type = ObjectType::MONSTER;
 	_name = name;
 
-	if (_basemonsterType == MonsterType::Peace) {
-		if (_movementType == MovementType::Fixed) {
-			_behavior = std::make_unique<PeaceFixedBehavior>();
-			_typeId = 1;
-		}
-
-		else {
-			_behavior = std::make_unique<PeaceRoamingBehavior>();
-			_typeId = 2;
-		}
-	}
-
-	else {
-		if (_movementType == MovementType::Fixed) {
-			_behavior = std::make_unique<AgroFixedBehavior>();
-			_typeId = 3;
-		}
+	SetBehavior(_basemonsterType);
+	// typeId : 1 PeaceFixed, 2 PeaceRoaming, 3 AgroFixed, 4 AgroRoaming
+	_typeId = (_basemonsterType == MonsterType::Peace ? 1 : 3) + (_movementType == MovementType::Fixed ? 0 : 1);
+}
 
-		else {
-			_behavior = std::make_unique<AgroRoamingBehavior>();
-			_typeId = 4;
-		}
-	}
+void Monster::ApplySpawnEntry(const SpawnEntry& entry)
+{
+	// 죽어 있는 동안 Heal Event Thread에서만 호출하므로 다른 Thread와 겹치지 않음
+	_defaultX = entry.x;
+	_defaultY = entry.y;
+	_basemonsterType = entry.monsterType;
+	_movementType = entry.movementType;
+	_typeId = (_basemonsterType == MonsterType::Peace ? 1 : 3) + (_movementType == MovementType::Fixed ? 0 : 1);
+
+	SetLevel(entry.level);
 }
 
 void Monster::WakeUp(bool force, int playerId)
@@ -55,28 +50,25 @@ void Monster::WakeUp(bool force, int playerId)
 	}
 }
 
-void Monster::OnMove()
+bool Monster::BeginMove()
 {
 	if (not _isAlive.load()) {
 		_movePending.store(false);
-		return;
+		return false;
 	}
 
 	if (not _isActive.load()) {
 		_movePending.store(false);
-		return;
-	}
-
-	if (not _movePending.exchange(false)) {
-		return;
+		return false;
 	}
 
-	auto service = _service.lock();
-	if (nullptr == service) {
-		return;
-	}
+	return _movePending.exchange(false);
+}
 
-	_behavior->OnMove(shared_from_this(), service);
+void Monster::SetBehavior(MonsterType monsterType)
+{
+	_behaviorIndex.store(GetMonsterBehaviorIndex(monsterType, _movementType));
+	_behavior.store(GetMonsterBehavior(monsterType, _movementType));
 }
 
 void Monster::OnHeal()
@@ -89,34 +81,30 @@ void Monster::OnHeal()
 		return;
 	}
 
-	_currentMonsterType = _basemonsterType;
-	if (_currentMonsterType == MonsterType::Peace) {
-		if (_movementType == MovementType::Fixed) {
-			_behavior = std::make_unique<PeaceFixedBehavior>();
-		}
-
-		else {
-			_behavior = std::make_unique<PeaceRoamingBehavior>();
-		}
+	// Spawn Table에서 빠진 Monster는 살아나지 않음
+	if (_retired.load()) {
+		service->OnNpcRetire(shared_from_this());
+		return;
 	}
 
-	else {
-		if (_movementType == MovementType::Fixed) {
-			_behavior = std::make_unique<AgroFixedBehavior>();
+	// Respawn이면 현재 Spawn Table 항목 적용 (Script Reload 반영)
+	if (not _isAlive.load()) {
+		const ScriptBundle& scripts = service->GetScriptManager()->GetCachedBundle();
+		if ((_spawnIndex >= 0) and (_spawnIndex < static_cast<int>(scripts.spawns.size()))) {
+			ApplySpawnEntry(scripts.spawns[_spawnIndex]);
 		}
+	}
 
-		else {
-			_behavior = std::make_unique<AgroRoamingBehavior>();
-		}
-	};
+	_currentMonsterType = _basemonsterType;
+	SetBehavior(_currentMonsterType);
 
-	_behavior->OnHeal(shared_from_this(), service);
+	_behavior.load()->OnHeal(shared_from_this(), service);
 }
 
 void Monster::RegisterTimer()
 {
 	if (_movePending.exchange(true)) {
-		LOG_INF("Monster %d: RegisterTimer skipped, movePending already true", _id);
+		LOG_DBG("Monster %d: RegisterTimer skipped, movePending already true", _id);
 		return;
 	}
 
@@ -125,41 +113,39 @@ void Monster::RegisterTimer()
 		return;
 	}
 
+	// 개별 Timer Event 대신 NpcSystem의 Sector Batch에 등록
 	if (auto service = _service.lock()) {
-		int interval = service->GetRandomInterval(1000, 2000);
-		service->_timerQueue.push(
-			Event{ _id,
-			std::chrono::high_resolution_clock::now() + std::chrono::milliseconds(interval),
-			EV_MOVE, 0 });
+		// 값으로 복사. Cache된 Bundle은 이 Thread의 다음 GetCachedBundle에서 바뀔 수 있음
+		MonsterAiParams ai = service->GetScriptManager()->GetCachedBundle().GetAi(_typeId);
+		int interval = service->GetRandomInterval(ai.moveMinMs, ai.moveMaxMs);
+		service->GetNpcSystem()->Schedule(shared_from_this(), interval);
 	}
 }
 
-std::unordered_set<int> Monster::RandomMove(std::shared_ptr<Service> service)
+void Monster::RandomMove(std::shared_ptr<Service> service)
 {
-	// 0. Random State 
+	// 0. Random State에서만 실행
 	if (_state.load() != NpcState::ST_Random) {
-		return {};
+		return;
 	}
 
 	int oldX = GetX();
 	int oldY = GetY();
 
-	// 2. ̵   (Default Pos ߽ 20 x 20)
+	// 2. 이동 범위 제한 (Default Pos를 중심으로 20 x 20)
 	int minX = std::max<int>(0, _defaultX - 10);
 	int maxX = std::min<int>(W_WIDTH - 1, _defaultX + 10);
 
 	int minY = std::max<int>(0, _defaultY - 10);
 	int maxY = std::min<int>(W_HEIGHT - 1, _defaultY + 10);
 
-	thread_local static std::default_random_engine dre{ std::random_device{}() };
-
 	std::array<int, 4> dirs{ 0, 1, 2, 3 };
-	std::shuffle(dirs.begin(), dirs.end(), dre);
+	std::shuffle(dirs.begin(), dirs.end(), GameRandom::GetEngine());
 
 	const int dx[4]{ 0, 0, -1, 1 };
 	const int dy[4]{ -1, 1, 0, 0 };
 
-	// 3.   Random Move
+	// 3. 범위 내에서 Random Move
 	for (int dir : dirs) {
 		int nx = _x + dx[dir];
 		int ny = _y + dy[dir];
@@ -174,32 +160,28 @@ std::unordered_set<int> Monster::RandomMove(std::shared_ptr<Service> service)
 	}
 
 	service->OnNpcMove(shared_from_this(), oldX, oldY);
-
-	return service->CollectViewList(shared_from_this());
 }
 
-std::unordered_set<int> Monster::AStarMove(std::shared_ptr<Service> service, APos npcPos, APos targetPos)
+void Monster::AStarMove(std::shared_ptr<Service> service, APos npcPos, APos targetPos)
 {
-	// Agro State 
+	// Agro State에서만 실행
 	if (_state.load() != NpcState::ST_Agro) {
-		return {};
+		return;
 	}
 
-	// Temp : service Map Data Ľ ʿ
+	// Temp : service에서 Map Data 파싱 필요
 	auto path = AStar(service->_navigationMap, npcPos, targetPos);
 	if (path.size() > 1) {
 		int oldX = GetX();
 		int oldY = GetY();
 
-		// ̵
+		// 이동
 		APos next = path[1];
 		_x = next.x;
 		_y = next.y;
 
 		service->OnNpcMove(shared_from_this(), oldX, oldY);
 	}
-
-	return service->CollectViewList(shared_from_this());
 }
 
 void Monster::TakeDamage(short damage)
@@ -221,14 +203,7 @@ void Monster::TakeDamage(short damage)
 	if (_currentMonsterType == MonsterType::Peace) {
 		_state.store(NpcState::ST_Agro);
 		_currentMonsterType = MonsterType::Agro;
-
-		if (_movementType == MovementType::Fixed) {
-			_behavior = std::make_unique<AgroFixedBehavior>();
-		}
-
-		else {
-			_behavior = std::make_unique<AgroRoamingBehavior>();
-		}
+		SetBehavior(_currentMonsterType);
 	}
 
 	if (CheckDie()) {
@@ -245,11 +220,6 @@ HANDLE Monster::GetHandle()
 void Monster::Dispatch(ExpOver* expOver, int numBytes)
 {
 	switch (expOver->_operationType) {
-	case NpcMove:
-		OnMove();
-		delete static_cast<EventOver*>(expOver);
-		break;
-
 	case NpcHeal:
 		OnHeal();
 		delete static_cast<EventOver*>(expOver);
@@ -276,8 +246,9 @@ void Monster::Die()
 	
 	// Respawn Event Push
 	if (not _healPending.exchange(true)) {
+		int respawnSec = service->GetScriptManager()->GetCachedBundle().GetAi(_typeId).respawnSec;
 		service->_timerQueue.push(Event{ GetId(),
-			std::chrono::high_resolution_clock::now() + std::chrono::seconds(30),
+			GameClock::Now() + std::chrono::seconds(respawnSec),
 			EV_HEAL, 0 });
 	}
 }
\ No newline at end of file
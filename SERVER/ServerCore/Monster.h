@@ -28,29 +28,39 @@ public:
 public:
 	void WakeUp(bool force = false, int playerId = -1);
 
-	void OnMove();
+	// NpcSystem Tick에서 Behavior 호출 전에 확인. 이번 Tick에 움직일 차례(살아 있음, 활성, movePending)면 true
+	bool BeginMove();
 	void OnHeal();
 
 	void RegisterTimer();
 
 public:
-	// Service 
+	// Service 관련
 	void SetService(std::shared_ptr<Service> service) { _service = service; }
 	const std::shared_ptr<Service>& GetService() const { return _service.lock(); }
 
 public:
-	// ̽ 
+	// 인터페이스 구현
 	virtual HANDLE GetHandle() override;
 	virtual void Dispatch(class ExpOver* expOver, int nuOfBytes = 0) override;
 
 public:
 	int GetTypeId() const { return _typeId; }
+	int GetSpawnIndex() const { return _spawnIndex; }
 	char GetState() const { return _state.load(); }
 
+	// Behavior 교체 시 함께 바뀜. NpcSystem은 index별로 묶어서 Behavior를 한 번에 실행
+	const class IMonsterBehavior* GetBehavior() const { return _behavior.load(); }
+	int GetBehaviorIndex() const { return _behaviorIndex.load(); }
+
 	void SetState(NpcState state) { _state.store(state); }
 	void SetMovePending(bool move) { _movePending.store(move); }
 	void SetHealPending(bool heal) { _healPending.store(heal); }
 	void SetActive(bool active) { _isActive.store(active); }
+	void SetSpawnIndex(int spawnIndex) { _spawnIndex = spawnIndex; }
+
+	// Spawn Table에서 빠짐. 다음 Respawn 때 살아나지 않고 World에서 제거
+	void Retire() { _retired.store(true); }
 	void SetLevel(int level)
 	{
 		_level = level;
@@ -62,17 +72,25 @@ public:
 	virtual void Die() override;
 
 public:
-	std::unordered_set<int> RandomMove(std::shared_ptr<Service> service);
-	std::unordered_set<int> AStarMove(std::shared_ptr<Service> service, APos npcPos, APos targetPos);
+	// Respawn 직전에 현재 Spawn Table 항목의 위치 / 종류 / Level 적용
+	void ApplySpawnEntry(const struct SpawnEntry& entry);
+
+	void RandomMove(std::shared_ptr<Service> service);
+	void AStarMove(std::shared_ptr<Service> service, APos npcPos, APos targetPos);
 
 public:
 	virtual void TakeDamage(short damage) override;
 
+private:
+	void SetBehavior(MonsterType monsterType);
+
 private:
 	std::weak_ptr<Service> _service;
 
 private:
 	int _typeId{ 1 };
+	int _spawnIndex{ -1 };		// Spawn Table 몇 번째 항목으로 만들어졌는지 (Reload 후 Respawn 시 항목 갱신)
+	std::atomic<bool> _retired{ false };
 
 private:
 	std::atomic<bool> _isActive{ false };
@@ -86,6 +104,8 @@ private:
 
 	MonsterType _currentMonsterType{ MonsterType::Peace };
 
-	std::unique_ptr<class IMonsterBehavior> _behavior;
+	// 공유 Behavior 객체를 가리키기만 하므로 교체 시 할당 없음
+	std::atomic<const class IMonsterBehavior*> _behavior{ nullptr };
+	std::atomic<int> _behaviorIndex{ 0 };		// [MonsterType][MovementType] 순서 (GetMonsterBehaviorIndex)
 };
 
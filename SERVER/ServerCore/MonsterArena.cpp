@@ -0,0 +1,37 @@
+#include "pch.h"
+#include "MonsterArena.h"
+
+MonsterArena::MonsterArena(size_t count)
+	: _buffer(std::make_unique<std::byte[]>(count * (sizeof(Monster) + SLOT_OVERHEAD))), _capacity(count * (sizeof(Monster) + SLOT_OVERHEAD))
+{
+}
+
+void* MonsterArena::Allocate(size_t size, size_t alignment)
+{
+	// 1. 정렬 맞춘 다음 위치에 공간이 있으면 Bump
+	uintptr_t base = reinterpret_cast<uintptr_t>(_buffer.get());
+	size_t offset = ((base + _used + alignment - 1) & ~(alignment - 1)) - base;
+	if (offset + size <= _capacity) {
+		_used = offset + size;
+		return _buffer.get() + offset;
+	}
+
+	// 2. Control Block 크기가 예상보다 크면 나머지는 Heap
+	return ::operator new(size, std::align_val_t{ alignment });
+}
+
+void MonsterArena::Deallocate(void* ptr, size_t size, size_t alignment)
+{
+	// Arena 안의 Memory는 Arena가 해제될 때 한 번에 반환
+	if (Owns(ptr)) {
+		return;
+	}
+
+	::operator delete(ptr, size, std::align_val_t{ alignment });
+}
+
+bool MonsterArena::Owns(const void* ptr) const
+{
+	const std::byte* p = static_cast<const std::byte*>(ptr);
+	return (p >= _buffer.get()) and (p < _buffer.get() + _capacity);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+// Spawn Batch 하나의 Monster를 한 번에 잡은 Memory에 연속으로 만드는 Bump Arena
+// Monster와 Control Block을 std::allocate_shared로 같이 넣으므로 shared_from_this / weak_ptr은 그대로 동작
+// Arena는 만든 Monster들의 Control Block(ArenaAllocator 복사본)이 잡고 있다가 마지막 Monster가 사라질 때 해제
+class MonsterArena
+{
+public:
+	// Control Block(참조 Count, Allocator 복사본)까지 들어가도록 Monster 하나당 여유를 둠
+	static constexpr size_t SLOT_OVERHEAD{ 64 };
+
+public:
+	explicit MonsterArena(size_t count);
+
+	MonsterArena(const MonsterArena&) = delete;
+	MonsterArena& operator=(const MonsterArena&) = delete;
+
+public:
+	// 한 Thread(Batch를 가져간 Thread)에서만 호출. 공간이 모자라면 Heap으로 넘김
+	void* Allocate(size_t size, size_t alignment);
+	void Deallocate(void* ptr, size_t size, size_t alignment);
+
+	size_t GetUsed() const { return _used; }
+	size_t GetCapacity() const { return _capacity; }
+
+private:
+	bool Owns(const void* ptr) const;
+
+private:
+	std::unique_ptr<std::byte[]> _buffer;
+	size_t _capacity;
+	size_t _used{ 0 };
+};
+
+template<typename T>
+class ArenaAllocator
+{
+public:
+	using value_type = T;
+
+public:
+	explicit ArenaAllocator(std::shared_ptr<MonsterArena> arena) : _arena(std::move(arena)) {}
+
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U>& other) : _arena(other.GetArena()) {}
+
+	T* allocate(size_t n) { return static_cast<T*>(_arena->Allocate(sizeof(T) * n, alignof(T))); }
+	void deallocate(T* ptr, size_t n) { _arena->Deallocate(ptr, sizeof(T) * n, alignof(T)); }
+
+	const std::shared_ptr<MonsterArena>& GetArena() const { return _arena; }
+
+	template<typename U>
+	bool operator==(const ArenaAllocator<U>& other) const { return _arena == other.GetArena(); }
+
+private:
+	std::shared_ptr<MonsterArena> _arena;
+};
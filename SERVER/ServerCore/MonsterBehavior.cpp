@@ -1,7 +1,97 @@
 #include "pch.h"
 #include "MonsterBehavior.h"
 
-void PeaceFixedBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service)
+namespace
+{
+	const PeaceFixedBehavior s_peaceFixed;
+	const PeaceRoamingBehavior s_peaceRoaming;
+	const AgroFixedBehavior s_agroFixed;
+	const AgroRoamingBehavior s_agroRoaming;
+
+	// [MonsterType][MovementType]
+	constexpr const IMonsterBehavior* s_behaviorTable[2][2]{
+		{ &s_peaceFixed, &s_peaceRoaming },
+		{ &s_agroFixed, &s_agroRoaming },
+	};
+
+	// Player가 agroRange 정사각형 안에 들어오면 Agro (기본 11 x 11)
+	// monster_ai.lua에 ShouldChase가 있으면 시야 안의 Player마다 Script 판정 사용
+	bool FindAgroTarget(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players, APos npcPos, APos& targetPos)
+	{
+		auto& scripts = service->GetScriptManager();
+		const ScriptBundle& bundle = scripts->GetCachedBundle();
+		const MonsterAiParams& ai = bundle.GetAi(owner->GetTypeId());
+
+		for (const PlayerSnapshot& player : players) {
+			int dx = std::abs(player.x - npcPos.x);
+			int dy = std::abs(player.y - npcPos.y);
+
+			bool chase = (dx <= ai.agroRange) and (dy <= ai.agroRange);
+			if (bundle.hasChaseHook and (dx <= VIEW_RANGE) and (dy <= VIEW_RANGE)) {
+				scripts->ShouldChase(bundle, owner->GetTypeId(), owner->GetLevel(), dx, dy, chase);
+			}
+
+			if (chase) {
+				targetPos = { player.x, player.y };
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	template<typename Behavior>
+	void MoveBatch(const Behavior& behavior, int behaviorIndex, const std::vector<std::shared_ptr<Monster>>& monsters, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players)
+	{
+		for (const auto& monster : monsters) {
+			if (not monster->BeginMove()) continue;
+
+			// Schedule 뒤에 Behavior가 바뀐 Monster(피격으로 Agro 전환)만 가상 호출
+			if (monster->GetBehaviorIndex() != behaviorIndex) {
+				monster->GetBehavior()->OnMove(monster, service, players);
+				continue;
+			}
+
+			behavior.Behavior::OnMove(monster, service, players);
+		}
+	}
+}
+
+const IMonsterBehavior* GetMonsterBehavior(MonsterType monsterType, MovementType movementType)
+{
+	return s_behaviorTable[monsterType][movementType];
+}
+
+int GetMonsterBehaviorIndex(MonsterType monsterType, MovementType movementType)
+{
+	return monsterType * 2 + movementType;
+}
+
+void MoveMonsters(int behaviorIndex, const std::vector<std::shared_ptr<Monster>>& monsters, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players)
+{
+	switch (behaviorIndex) {
+	case 0: MoveBatch(s_peaceFixed, behaviorIndex, monsters, service, players); break;
+	case 1: MoveBatch(s_peaceRoaming, behaviorIndex, monsters, service, players); break;
+	case 2: MoveBatch(s_agroFixed, behaviorIndex, monsters, service, players); break;
+	case 3: MoveBatch(s_agroRoaming, behaviorIndex, monsters, service, players); break;
+	default:
+		LOG_ERR("MoveMonsters invalid behavior index %d", behaviorIndex);
+		break;
+	}
+}
+
+bool HasPlayerInView(const std::vector<PlayerSnapshot>& players, short x, short y)
+{
+	for (const PlayerSnapshot& player : players) {
+		if ((std::abs(player.x - x) <= VIEW_RANGE) and (std::abs(player.y - y) <= VIEW_RANGE)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void PeaceFixedBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players) const
 {
 	if (not owner->IsAlive()) {
 		owner->SetMovePending(false);
@@ -13,7 +103,7 @@ void PeaceFixedBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std
 	owner->SetMovePending(false);
 }
 
-void PeaceFixedBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service)
+void PeaceFixedBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service) const
 {
 	if (owner->IsAlive()) {
 		owner->SetHealPending(false);
@@ -31,7 +121,7 @@ void PeaceFixedBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const std
 	owner->RegisterTimer();
 }
 
-void PeaceRoamingBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service)
+void PeaceRoamingBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players) const
 {
 	if (not owner->IsAlive()) {
 		owner->SetMovePending(false);
@@ -43,7 +133,7 @@ void PeaceRoamingBehavior::OnMove(const std::shared_ptr<Monster>& owner, const s
 	owner->RegisterTimer();
 }
 
-void PeaceRoamingBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service)
+void PeaceRoamingBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service) const
 {
 	if (owner->IsAlive()) {
 		owner->SetHealPending(false);
@@ -61,7 +151,7 @@ void PeaceRoamingBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const s
 	owner->SetHealPending(false);
 }
 
-void AgroFixedBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service)
+void AgroFixedBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players) const
 {
 	if (not owner->IsAlive()) {
 		owner->SetMovePending(false);
@@ -70,57 +160,31 @@ void AgroFixedBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std:
 
 	APos npcPos{ owner->GetX(), owner->GetY() };
 
-	// 1. ֺ Player Ž
+	// 1. 주변 Player 탐색 (Sector Tick에서 수집한 Snapshot 사용)
 	bool agro{ false };
-	auto visibleList = service->CollectViewList(owner);
 
 	APos targetPos;
 
-	// 2.  
-	for (int id : visibleList) {
-		auto object = service->FindObject(id);
-		if (object->GetType() == ObjectType::PLAYER) {
-			auto player = static_pointer_cast<GameSession>(object);
-			if ((nullptr != player) and (player->IsAlive())) {
-				int dx = std::abs(player->GetX() - npcPos.x);
-				int dy = std::abs(player->GetY() - npcPos.y);
-
-				// Player 11 x 11 ȿ  Agro 
-				if ((dx <= 5) and (dy <= 5)) {
-					int dist = dx + dy;
-					targetPos = { player->GetX(), player->GetY() };
-					agro = true;
-					break;
-				}
-			}
-		}
-	}
-
-	std::unordered_set<int> newViewList;
+	// 2. 상태 결정
+	agro = FindAgroTarget(owner, service, players, npcPos, targetPos);
 
-	// 3-1. Agro ¸ AStar Player Ѿư
+	// 3-1. Agro 상태면 AStar로 Player 쫓아가기
 	if (agro) {
 		owner->SetActive(true);
 		owner->SetState(NpcState::ST_Agro);
-		newViewList = owner->AStarMove(service, npcPos, targetPos);
+		owner->AStarMove(service, npcPos, targetPos);
 	}
 
-	// 3-2. Agro  ƴϸ Random Move
+	// 3-2. Agro 상태 아니면 Random Move
 	else {
 		owner->SetMovePending(false);
 		owner->SetActive(false);
 		return;
 	}
 
-	bool isActive{ false };
-	for (int id : newViewList) {
-		if (service->FindObject(id)->GetType() == ObjectType::PLAYER) {
-			isActive = true;
-			break;
-		}
-	}
+	bool isActive = HasPlayerInView(players, owner->GetX(), owner->GetY());
 
-	// 4.  Ŀ Player ó   Event Push,  Ȱȭ
+	// 4. 움직인 후에도 Player가 근처에 있으면 다음 Event Push, 없으면 비활성화
 	if (isActive) {
 		owner->RegisterTimer();
 	}
@@ -130,7 +194,7 @@ void AgroFixedBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std:
 	}
 }
 
-void AgroFixedBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service)
+void AgroFixedBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service) const
 {
 	if (owner->IsAlive()) {
 		owner->SetHealPending(false);
@@ -149,7 +213,7 @@ void AgroFixedBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const std:
 	owner->RegisterTimer();
 }
 
-void AgroRoamingBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service)
+void AgroRoamingBehavior::OnMove(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players) const
 {
 	if (not owner->IsAlive()) {
 		owner->SetMovePending(false);
@@ -159,55 +223,29 @@ void AgroRoamingBehavior::OnMove(const std::shared_ptr<Monster>& owner, const st
 	APos npcPos{ owner->GetX(), owner->GetY() };
 	APos defaultPos{ owner->GetDefaultX(), owner->GetDefaultY() };
 
-	// 1. ֺ Player Ž
+	// 1. 주변 Player 탐색 (Sector Tick에서 수집한 Snapshot 사용)
 	bool agro{ false };
-	auto visibleList = service->CollectViewList(owner);
 
 	APos targetPos;
 
-	// 2.  
-	for (int id : visibleList) {
-		auto object = service->FindObject(id);
-		if (object->GetType() == ObjectType::PLAYER) {
-			auto player = static_pointer_cast<GameSession>(object);
-			if ((nullptr != player) and (player->IsAlive())) {
-				int dx = std::abs(player->GetX() - npcPos.x);
-				int dy = std::abs(player->GetY() - npcPos.y);
-
-				// Player 11 x 11 ȿ  Agro 
-				if ((dx <= 5) and (dy <= 5)) {
-					int dist = dx + dy;
-					targetPos = { player->GetX(), player->GetY() };
-					agro = true;
-					break;
-				}
-			}
-		}
-	}
-
-	std::unordered_set<int> newViewList;
+	// 2. 상태 결정
+	agro = FindAgroTarget(owner, service, players, npcPos, targetPos);
 
-	// 3-1. Agro ¸ AStar Player Ѿư
+	// 3-1. Agro 상태면 AStar로 Player 쫓아가기
 	if (agro) {
 		owner->SetState(NpcState::ST_Agro);
-		newViewList = owner->AStarMove(service, npcPos, targetPos);
+		owner->AStarMove(service, npcPos, targetPos);
 	}
 
-	// 3-2. Agro  ƴϸ Random Move
+	// 3-2. Agro 상태 아니면 Random Move
 	else {
 		owner->SetState(NpcState::ST_Random);
-		newViewList = owner->RandomMove(service);
+		owner->RandomMove(service);
 	}
 
-	bool isActive{ false };
-	for (int id : newViewList) {
-		if (service->FindObject(id)->GetType() == ObjectType::PLAYER) {
-			isActive = true;
-			break;
-		}
-	}
+	bool isActive = HasPlayerInView(players, owner->GetX(), owner->GetY());
 
-	// 4.  Ŀ Player ó   Event Push,  Ȱȭ
+	// 4. 움직인 후에도 Player가 근처에 있으면 다음 Event Push, 없으면 비활성화
 	if (isActive) {
 		owner->RegisterTimer();
 	}
@@ -217,7 +255,7 @@ void AgroRoamingBehavior::OnMove(const std::shared_ptr<Monster>& owner, const st
 	}
 }
 
-void AgroRoamingBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service)
+void AgroRoamingBehavior::OnHeal(const std::shared_ptr<Monster>& owner, const std::shared_ptr<Service>& service) const
 {
 	if (owner->IsAlive()) {
 		owner->SetHealPending(false);
@@ -3,48 +3,62 @@
 class Monster;
 class Service;
 
+struct PlayerSnapshot;
+
+constexpr int MONSTER_BEHAVIOR_COUNT = 4;	// MonsterType 2 x MovementType 2
+
+// Snapshot 중 Monster 시야 안에 Player가 있는지 확인
+bool HasPlayerInView(const std::vector<PlayerSnapshot>& players, short x, short y);
+
 class IMonsterBehavior
 {
 public:
 	virtual ~IMonsterBehavior() = default;
 
-	virtual void OnMove(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) abstract;
-	virtual void OnHeal(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) abstract;
+	virtual void OnMove(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players) const abstract;
+	virtual void OnHeal(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) const abstract;
 };
 
-class PeaceFixedBehavior : public IMonsterBehavior
+class PeaceFixedBehavior final : public IMonsterBehavior
 {
 public:
 	virtual ~PeaceFixedBehavior() = default;
 
-	virtual void OnMove(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) override;
-	virtual void OnHeal(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) override;
+	virtual void OnMove(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players) const override;
+	virtual void OnHeal(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) const override;
 };
 
-class PeaceRoamingBehavior : public IMonsterBehavior
+class PeaceRoamingBehavior final : public IMonsterBehavior
 {
 public:
 	virtual ~PeaceRoamingBehavior() = default;
 
-	virtual void OnMove(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) override;
-	virtual void OnHeal(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) override;
+	virtual void OnMove(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players) const override;
+	virtual void OnHeal(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) const override;
 };
 
-class AgroFixedBehavior : public IMonsterBehavior
+class AgroFixedBehavior final : public IMonsterBehavior
 {
 public:
 	virtual ~AgroFixedBehavior() = default;
 
-	virtual void OnMove(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) override;
-	virtual void OnHeal(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) override;
+	virtual void OnMove(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players) const override;
+	virtual void OnHeal(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) const override;
 };
 
-class AgroRoamingBehavior : public IMonsterBehavior
+class AgroRoamingBehavior final : public IMonsterBehavior
 {
 public:
 	virtual ~AgroRoamingBehavior() = default;
 
-	virtual void OnMove(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) override;
-	virtual void OnHeal(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) override;
+	virtual void OnMove(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players) const override;
+	virtual void OnHeal(const std::shared_ptr <Monster>& owner, const std::shared_ptr<Service>& service) const override;
 };
 
+// Behavior는 상태가 없으므로 (MonsterType, MovementType)별 하나의 객체를 공유
+const IMonsterBehavior* GetMonsterBehavior(MonsterType monsterType, MovementType movementType);
+int GetMonsterBehaviorIndex(MonsterType monsterType, MovementType movementType);
+
+// 같은 Behavior index로 묶인 Monster들을 한 번에 이동 (NpcSystem Sector Tick)
+// index마다 구체 Behavior를 한 번 고르고 Monster마다 가상 호출 없이 실행
+void MoveMonsters(int behaviorIndex, const std::vector<std::shared_ptr<Monster>>& monsters, const std::shared_ptr<Service>& service, const std::vector<PlayerSnapshot>& players);
@@ -0,0 +1,148 @@
+#include "pch.h"
+#include "NpcSystem.h"
+
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_NPC
+
+NpcSystem::NpcSystem(const std::shared_ptr<Service>& service) : _service(service)
+{
+	_batches.reserve(SECTOR_COUNT * SECTOR_COUNT);
+	for (int i = 0; i < SECTOR_COUNT * SECTOR_COUNT; ++i) {
+		_batches.push_back(std::make_unique<SectorBatch>());
+	}
+}
+
+void NpcSystem::Schedule(const std::shared_ptr<Monster>& monster, int delayMs)
+{
+	auto service = _service.lock();
+	if (nullptr == service) {
+		return;
+	}
+
+	int behaviorIndex = monster->GetBehaviorIndex();
+	if ((behaviorIndex < 0) or (behaviorIndex >= MONSTER_BEHAVIOR_COUNT)) {
+		LOG_ERR("Monster %d has invalid behavior index %d", monster->GetId(), behaviorIndex);
+		return;
+	}
+
+	auto [sx, sy] = Sector::GetSector(monster->GetX(), monster->GetY());
+	int sectorIndex = GetSectorIndex(sx, sy);
+	auto wakeupTime = GameClock::Now() + std::chrono::milliseconds(delayMs);
+
+	SectorBatch& batch = *_batches[sectorIndex];
+	std::lock_guard lock{ batch.mutex };
+
+	BehaviorGroup& group = batch.groups[behaviorIndex];
+	group.wakeupTimes.push_back(wakeupTime);
+	group.monsters.push_back(monster);
+
+	ScheduleTick(service, sectorIndex, batch, wakeupTime);
+}
+
+void NpcSystem::TickSector(int sectorIndex)
+{
+	PROFILE_ZONE("NpcSystem::TickSector");
+
+	auto service = _service.lock();
+	if (nullptr == service) {
+		return;
+	}
+
+	if ((sectorIndex < 0) or (sectorIndex >= static_cast<int>(_batches.size()))) {
+		LOG_ERR("TickSector invalid sector index %d", sectorIndex);
+		return;
+	}
+
+	SectorBatch& batch = *_batches[sectorIndex];
+	auto now = GameClock::Now();
+
+	// 1. 깨어날 시간이 된 Monster를 Behavior index별로 추출
+	std::array<std::vector<std::shared_ptr<Monster>>, MONSTER_BEHAVIOR_COUNT> dueMonsters;
+	size_t dueCount{ 0 };
+	{
+		std::lock_guard lock{ batch.mutex };
+
+		if (batch.tickScheduled and (batch.nextTick <= now)) {
+			batch.tickScheduled = false;
+		}
+
+		auto earliest = Clock::time_point::max();
+		for (int index = 0; index < MONSTER_BEHAVIOR_COUNT; ++index) {
+			auto& monsters = batch.groups[index].monsters;
+			auto& wakeupTimes = batch.groups[index].wakeupTimes;
+
+			size_t keep{ 0 };
+			for (size_t i = 0; i < monsters.size(); ++i) {
+				if (wakeupTimes[i] <= now) {
+					dueMonsters[index].push_back(std::move(monsters[i]));
+					continue;
+				}
+
+				earliest = std::min(earliest, wakeupTimes[i]);
+				if (keep != i) {
+					monsters[keep] = std::move(monsters[i]);
+					wakeupTimes[keep] = wakeupTimes[i];
+				}
+				++keep;
+			}
+
+			monsters.resize(keep);
+			wakeupTimes.resize(keep);
+			dueCount += dueMonsters[index].size();
+		}
+
+		// 2. 남은 Monster가 있으면 다음 Tick 예약
+		if (earliest != Clock::time_point::max()) {
+			ScheduleTick(service, sectorIndex, batch, earliest);
+		}
+	}
+
+	if (0 == dueCount) {
+		return;
+	}
+
+	// 3. Sector 주변 Player Snapshot은 Tick당 한 번만 수집
+	int sx = sectorIndex / SECTOR_COUNT;
+	int sy = sectorIndex % SECTOR_COUNT;
+
+	std::vector<PlayerSnapshot> players;
+	CollectPlayerSnapshot(service, sx, sy, players);
+
+	// 4. Behavior index 단위로 묶어서 Update (index마다 Behavior 선택 한 번)
+	for (int index = 0; index < MONSTER_BEHAVIOR_COUNT; ++index) {
+		if (not dueMonsters[index].empty()) {
+			MoveMonsters(index, dueMonsters[index], service, players);
+		}
+	}
+}
+
+void NpcSystem::CollectPlayerSnapshot(const std::shared_ptr<Service>& service, int sx, int sy, std::vector<PlayerSnapshot>& out) const
+{
+	// Sector 안의 Monster는 한 Tick에 최대 1칸 이동하므로 주변 1 Sector면 시야를 모두 덮음
+	// Region Thread에서 실행되므로 Halo를 포함한 Region Mirror에서 Lock 없이 수집
+	std::unordered_set<int> candidates = service->CollectRegionObjects(sx, sy, 1);
+	out.reserve(candidates.size());
+
+	for (int id : candidates) {
+		if (id >= MAX_USER) continue;
+
+		auto object = service->FindObject(id);
+		if ((nullptr == object) or (object->GetType() != ObjectType::PLAYER)) continue;
+		if ((not object->IsVisible()) or (not object->IsAlive())) continue;
+
+		out.push_back(PlayerSnapshot{ id, object->GetX(), object->GetY() });
+	}
+}
+
+void NpcSystem::ScheduleTick(const std::shared_ptr<Service>& service, int sectorIndex, SectorBatch& batch, Clock::time_point wakeupTime)
+{
+	// 이미 더 이른 Tick이 예약되어 있으면 그 Tick에서 함께 처리
+	if (batch.tickScheduled and (batch.nextTick <= wakeupTime)) {
+		return;
+	}
+
+	batch.tickScheduled = true;
+	batch.nextTick = wakeupTime;
+
+	service->_timerQueue.push(Event{ sectorIndex, wakeupTime, EV_NPC_TICK, 0 });
+}
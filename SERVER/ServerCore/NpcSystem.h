@@ -0,0 +1,50 @@
+#pragma once
+
+class Monster;
+class Service;
+
+// Sector Tick 동안 모든 Monster가 공유하는 Player 정보
+struct PlayerSnapshot {
+	int id;
+	short x, y;
+};
+
+class NpcSystem : public std::enable_shared_from_this<NpcSystem>
+{
+	using Clock = GameClock::Clock;
+
+	// Sector 하나에 속한 Monster들을 Behavior index별 배열로 보관 (Struct of Arrays)
+	// 깨어날 시간 검사는 wakeupTimes만 순회하고 Monster는 깨어난 것만 접근
+	// 위치 / Target은 View / Combat / Handoff도 읽으므로 Monster에 그대로 둠
+	struct BehaviorGroup {
+		std::vector<Clock::time_point> wakeupTimes;
+		std::vector<std::shared_ptr<Monster>> monsters;
+	};
+
+	struct SectorBatch {
+		std::array<BehaviorGroup, MONSTER_BEHAVIOR_COUNT> groups;
+
+		bool tickScheduled{ false };
+		Clock::time_point nextTick;
+
+		std::mutex mutex;
+	};
+
+public:
+	NpcSystem(const std::shared_ptr<Service>& service);
+
+public:
+	void Schedule(const std::shared_ptr<Monster>& monster, int delayMs);
+	void TickSector(int sectorIndex);
+
+public:
+	static int GetSectorIndex(int sx, int sy) { return sx * SECTOR_COUNT + sy; }
+
+private:
+	void CollectPlayerSnapshot(const std::shared_ptr<Service>& service, int sx, int sy, std::vector<PlayerSnapshot>& out) const;
+	void ScheduleTick(const std::shared_ptr<Service>& service, int sectorIndex, SectorBatch& batch, Clock::time_point wakeupTime);
+
+private:
+	std::vector<std::unique_ptr<SectorBatch>> _batches;
+	std::weak_ptr<Service> _service;
+};
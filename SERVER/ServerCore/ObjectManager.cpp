@@ -18,11 +18,34 @@ int ObjectManager::AddObject(const std::shared_ptr<GameObject>& object)
 	return id;
 }
 
+int ObjectManager::ReserveNpcIds(int count)
+{
+	int firstId = _nextNpcId.fetch_add(count);
+	if (firstId + count > MAX_USER + MAX_NPC) {
+		_nextNpcId.fetch_sub(count);
+		return -1;
+	}
+
+	return firstId;
+}
+
+void ObjectManager::AddMonsters(const std::vector<std::shared_ptr<Monster>>& monsters)
+{
+	std::unique_lock lock{ _mutex };
+	for (const auto& monster : monsters) {
+		_objects.insert(std::make_pair(monster->GetId(), monster));
+	}
+}
+
 int ObjectManager::RemoveObject(const std::shared_ptr<GameObject>& object)
 {
 	std::unique_lock lock{ _mutex };
 	_objects.unsafe_erase(object->GetId());
-	_freePlayerIds.push(object->GetId());
+
+	// NPC Id는 Timer Event가 Id로 찾으므로 재사용하지 않음
+	if (object->GetType() == ObjectType::PLAYER) {
+		_freePlayerIds.push(object->GetId());
+	}
 
 	return object->GetId();
 }
@@ -79,9 +102,8 @@ const std::vector<int> ObjectManager::GetPlayerInTile(short x, short y, const st
 	std::vector<int> result;
 	result.reserve(1);
 
-	std::shared_ptr<Monster> temp = std::make_shared<Monster>(-1, x, y, "-1");
-
-	auto viewList = service->CollectViewList(temp);
+	// Region Thread 전용 : (x, y)가 호출 Region의 소유 Sector 또는 Halo 안이어야 함
+	auto viewList = service->CollectRegionViewList(-1, x, y);
 
 	for (int id : viewList) {
 		auto object = service->FindObject(id);
@@ -102,9 +124,8 @@ const std::vector<int> ObjectManager::GetMonsterInTile(short x, short y, const s
 	std::vector<int> result;
 	result.reserve(1);
 
-	std::shared_ptr<Monster> temp = std::make_shared<Monster>(-1, x, y, "-1");
-
-	auto viewList = service->CollectViewList(temp);
+	// Region Thread 전용 : (x, y)가 호출 Region의 소유 Sector 또는 Halo 안이어야 함
+	auto viewList = service->CollectRegionViewList(-1, x, y);
 
 	for (int id : viewList) {
 		auto object = service->FindObject(id);
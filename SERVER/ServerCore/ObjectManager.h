@@ -6,12 +6,18 @@ public:
 	ObjectManager() : _nextPlayerId(0), _nextNpcId(5000) {}
 
 	int AddObject(const std::shared_ptr<GameObject>& object);
+
+	// 초기 Spawn용 : 연속된 NPC Id를 count개 예약해서 첫 Id 반환 (부족하면 -1)
+	// 예약한 Id를 넣어 만든 Monster는 AddMonsters로 한 번에 등록
+	int ReserveNpcIds(int count);
+	void AddMonsters(const std::vector<std::shared_ptr<Monster>>& monsters);
 	int RemoveObject(const std::shared_ptr<GameObject>& object);
 	std::shared_ptr<GameObject> FindObject(int id, bool player = false) const;
 
 	void ForEachObject(const std::function<void(int, const std::shared_ptr<GameObject>&)>& f) const;
 	void ForEachPlayer(const std::function<void(const std::shared_ptr<GameSession>&)>& f) const;
 
+	// Region Thread 전용 (Region Mirror에서 수집)
 	const std::vector<int> GetPlayerInTile(short x, short y, const std::shared_ptr<Service>& service) const;
 	const std::vector<int> GetMonsterInTile(short x, short y, const std::shared_ptr<Service>& service) const;
 
@@ -29,58 +29,29 @@ std::vector<char> PacketFactory::BuildLoginFailPacket(const GameObject& target)
 
 std::vector<char> PacketFactory::BuildAddPacket(const GameObject& target, char symbol)
 {
-	SC_ADD_OBJECT_PACKET add;
-	add.id = target.GetId();
-	add.size = sizeof(add);
-	add.type = SC_ADD_OBJECT;
-	add.x = target.GetX();
-	add.y = target.GetY();
-	add.objType = target.GetType();
-	add.questSymbol = symbol;
-
-	if (add.objType == ObjectType::MONSTER) {
-		auto monster = static_cast<const Monster*>(&target);
-		if (nullptr != monster) {
-			add.monsterType = monster->GetTypeId();
-		}
-
-		else {
-			add.monsterType = -1;
-		}
-	}
+	int id = target.GetId();
+	int monsterType = -1;
 
-	else if (add.objType == ObjectType::PLAYER) {
-		auto player = static_cast<const GameSession*>(&target);
-		add.id = player->GetUserID();
-		add.monsterType = -1;
+	if (target.GetType() == ObjectType::MONSTER) {
+		monsterType = static_cast<const Monster*>(&target)->GetTypeId();
 	}
 
-	else {
-		add.monsterType = -1;
+	else if (target.GetType() == ObjectType::PLAYER) {
+		id = static_cast<const GameSession*>(&target)->GetUserID();
 	}
 
-	strcpy_s(add.name, NAME_SIZE, target.GetName().c_str());
-	add.name[NAME_SIZE - 1] = '\0';
-
-	return Serialize(add);
+	return BuildAddPacket(id, target.GetX(), target.GetY(), static_cast<char>(target.GetType()), monsterType, symbol, target.GetName());
 }
 
-std::vector<char> PacketFactory::BuildMovePacket(const GameObject& target)
+std::vector<char> PacketFactory::BuildMovePacket(const GameObject& target, unsigned int moveTime)
 {
-	SC_MOVE_OBJECT_PACKET move;
-	move.id = target.GetId();
-	move.size = sizeof(move);
-	move.type = SC_MOVE_OBJECT;
-	move.x = target.GetX();
-	move.y = target.GetY();
-	move.move_time = target._lastMoveTime;
+	int id = target.GetId();
 
 	if (target.GetType() == ObjectType::PLAYER) {
-		auto player = static_cast<const GameSession*>(&target);
-		move.id = player->GetUserID();
+		id = static_cast<const GameSession*>(&target)->GetUserID();
 	}
 
-	return Serialize(move);
+	return BuildMovePacket(id, target.GetX(), target.GetY(), moveTime);
 }
 
 std::vector<char> PacketFactory::BuildRemovePacket(const GameObject& target)
@@ -235,18 +206,42 @@ std::vector<char> PacketFactory::BuildQuestSymbolUpdatePacket(int npcId, char sy
 
 std::vector<char> PacketFactory::BuildChatPacket(const std::shared_ptr<GameObject>& object, const char* msg)
 {
-	SC_CHAT_PACKET chat;
-	chat.size = sizeof(chat);
-	chat.type = SC_CHAT;
-	chat.id = object->GetId();
-	chat.targetId = -1;
-	strcpy_s(chat.message, CHAT_SIZE - 1, msg);
-	chat.message[CHAT_SIZE - 1] = '\0';
+	int id = object->GetId();
 
 	if (object->GetType() == ObjectType::PLAYER) {
-		auto player = static_pointer_cast<GameSession>(object);
-		chat.id = player->GetUserID();
+		id = static_pointer_cast<GameSession>(object)->GetUserID();
 	}
 
-	return Serialize(chat);
+	return BuildChatPacket(id, msg);
+}
+
+std::vector<char> PacketFactory::BuildHandoffPacket(char targetZone, const HandoffState& state)
+{
+	ZG_HANDOFF_PACKET handoff;
+	handoff.size = sizeof(handoff);
+	handoff.type = static_cast<char>(ZG_HANDOFF);
+	handoff.targetZone = targetZone;
+	handoff.state = state;
+
+	return Serialize(handoff);
+}
+
+std::vector<char> PacketFactory::BuildHandoffReplayPacket(const std::vector<char>& packet)
+{
+	ZG_HANDOFF_REPLAY_HEADER header;
+	header.size = static_cast<unsigned char>(sizeof(header) + packet.size());
+	header.type = static_cast<char>(ZG_HANDOFF_REPLAY);
+
+	std::vector<char> replay = Serialize(header);
+	replay.insert(replay.end(), packet.begin(), packet.end());
+	return replay;
+}
+
+std::vector<char> PacketFactory::BuildHandoffDonePacket()
+{
+	ZG_HANDOFF_DONE_PACKET done;
+	done.size = sizeof(done);
+	done.type = static_cast<char>(ZG_HANDOFF_DONE);
+
+	return Serialize(done);
 }
@@ -5,6 +5,8 @@
 class GameObject;
 class Party;
 
+struct HandoffState;
+
 class PacketFactory
 {
 public:
@@ -12,7 +14,7 @@ public:
 	static std::vector<char> BuildLoginOkPacket(const GameObject& target);
 	static std::vector<char> BuildLoginFailPacket(const GameObject& target);
 	static std::vector<char> BuildAddPacket(const GameObject& target, char symbol = 0);
-	static std::vector<char> BuildMovePacket(const GameObject& target);
+	static std::vector<char> BuildMovePacket(const GameObject& target, unsigned int moveTime = 0);
 	static std::vector<char> BuildRemovePacket(const GameObject& target);
 	static std::vector<char> BuildStatChangePacket(const GameObject& target);
 
@@ -35,9 +37,59 @@ public:
 	static std::vector<char> BuildQuestCompletePacket(int questId);
 	static std::vector<char> BuildQuestSymbolUpdatePacket(int npcId, char symbol);
 
+public:
+	// Zone
+	static std::vector<char> BuildHandoffPacket(char targetZone, const HandoffState& state);
+	static std::vector<char> BuildHandoffReplayPacket(const std::vector<char>& packet);
+	static std::vector<char> BuildHandoffDonePacket();
+
 public:
 	static std::vector<char> BuildChatPacket(const std::shared_ptr<GameObject>& object, const char* msg);
 
+public:
+	// 필드 값으로 직접 만드는 Builder. 위의 GameObject 버전이 id / 위치 / 이름을 꺼내서 호출
+	// GameObject에 의존하지 않으므로 SERVERCORE_PORTABLE 빌드(MicroBench)에서도 같은 코드를 측정
+	static std::vector<char> BuildAddPacket(int id, short x, short y, char objType, int monsterType, char symbol, std::string_view name)
+	{
+		SC_ADD_OBJECT_PACKET add{};
+		add.size = sizeof(add);
+		add.type = SC_ADD_OBJECT;
+		add.id = id;
+		add.x = x;
+		add.y = y;
+		add.objType = objType;
+		add.questSymbol = symbol;
+		add.monsterType = monsterType;
+		name.copy(add.name, NAME_SIZE - 1);
+
+		return Serialize(add);
+	}
+
+	static std::vector<char> BuildMovePacket(int id, short x, short y, unsigned int moveTime)
+	{
+		SC_MOVE_OBJECT_PACKET move{};
+		move.size = sizeof(move);
+		move.type = SC_MOVE_OBJECT;
+		move.id = id;
+		move.x = x;
+		move.y = y;
+		move.move_time = moveTime;
+
+		return Serialize(move);
+	}
+
+	static std::vector<char> BuildChatPacket(int id, std::string_view msg)
+	{
+		SC_CHAT_PACKET chat{};
+		chat.size = sizeof(chat);
+		chat.type = SC_CHAT;
+		chat.id = id;
+		chat.targetId = -1;
+		msg.copy(chat.message, CHAT_SIZE - 1);
+
+		return Serialize(chat);
+	}
+
 public:
 	template<typename Packet>
 	static std::vector<char> Serialize(const Packet& packet)
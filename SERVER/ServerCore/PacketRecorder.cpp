@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "PacketRecorder.h"
+
+PacketRecorder::~PacketRecorder()
+{
+	Close();
+}
+
+bool PacketRecorder::Open(const std::string& path)
+{
+	if (_file.is_open()) {
+		LOG_WRN("PacketRecorder already opened");
+		return false;
+	}
+
+	_file.open(path, std::ios::binary | std::ios::trunc);
+	if (not _file) {
+		LOG_ERR("PacketRecorder open failed: %s", path);
+		return false;
+	}
+
+	// 1. Header
+	PacketTraceHeader header{};
+	std::memcpy(header.magic, PACKET_TRACE_MAGIC, sizeof(header.magic));
+	header.version = PACKET_TRACE_VERSION;
+	header.startUnixMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+	_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	// 2. Writer Thread 시작
+	_startTime = Clock::now();
+	_pending.reserve(FLUSH_BYTES * 2);
+	_stop = false;
+	_writer = std::thread(&PacketRecorder::WriterThread, this);
+
+	LOG_INF("PacketRecorder started: %s", path);
+	return true;
+}
+
+void PacketRecorder::Close()
+{
+	if (not _file.is_open()) {
+		return;
+	}
+
+	{
+		std::lock_guard lock{ _pendingMutex };
+		_stop = true;
+	}
+	_pendingCv.notify_all();
+
+	if (_writer.joinable()) {
+		_writer.join();
+	}
+
+	_file.close();
+
+	LOG_INF("PacketRecorder closed (%lld packets, %lld dropped)", _recordedCount.load(), _droppedCount.load());
+}
+
+void PacketRecorder::Record(unsigned int traceId, const std::vector<char>& packet)
+{
+	PacketTraceRecord record{};
+	record.timeUs = static_cast<unsigned long long>(
+		std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _startTime).count());
+	record.traceId = traceId;
+	record.size = static_cast<unsigned short>(std::min<size_t>(packet.size(), std::numeric_limits<unsigned short>::max()));
+
+	bool notify{ false };
+	{
+		std::lock_guard lock{ _pendingMutex };
+		if (_stop or (_pending.size() + sizeof(record) + record.size > MAX_PENDING_BYTES)) {
+			_droppedCount.fetch_add(1);
+			return;
+		}
+
+		const char* raw = reinterpret_cast<const char*>(&record);
+		_pending.insert(_pending.end(), raw, raw + sizeof(record));
+		_pending.insert(_pending.end(), packet.begin(), packet.begin() + record.size);
+
+		notify = (_pending.size() >= FLUSH_BYTES);
+	}
+
+	_recordedCount.fetch_add(1);
+	if (notify) {
+		_pendingCv.notify_one();
+	}
+}
+
+void PacketRecorder::WriterThread()
+{
+	std::vector<char> buffer;
+	buffer.reserve(FLUSH_BYTES * 2);
+
+	while (true) {
+		bool stop{ false };
+		{
+			std::unique_lock lock{ _pendingMutex };
+			_pendingCv.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS),
+				[this]() { return _stop or (_pending.size() >= FLUSH_BYTES); });
+
+			buffer.swap(_pending);
+			stop = _stop;
+		}
+
+		// 파일 쓰기는 Lock 밖에서
+		if (not buffer.empty()) {
+			_file.write(buffer.data(), buffer.size());
+			buffer.clear();
+		}
+
+		if (stop) {
+			break;
+		}
+	}
+
+	_file.flush();
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <fstream>
+
+#include "PacketTrace.h"
+
+// 받은 Packet을 도착 시각과 함께 Packet Trace 파일로 기록 (STRESS_TEST/Replay로 재생)
+// Session마다 traceId를 하나씩 받아서 기록하고, 파일 쓰기는 Writer Thread가 모아서 처리
+class PacketRecorder
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr size_t FLUSH_BYTES{ 64 * 1024 };
+	static constexpr size_t MAX_PENDING_BYTES{ 16 * 1024 * 1024 };
+	static constexpr int FLUSH_INTERVAL_MS{ 100 };
+
+public:
+	PacketRecorder() = default;
+	~PacketRecorder();
+
+public:
+	bool Open(const std::string& path);
+	void Close();
+
+	unsigned int NewTraceId() { return _nextTraceId.fetch_add(1); }
+
+	// Disk가 밀려서 MAX_PENDING_BYTES를 넘으면 기록하지 않고 버린 수만 셈
+	void Record(unsigned int traceId, const std::vector<char>& packet);
+
+private:
+	void WriterThread();
+
+private:
+	std::ofstream _file;
+	Clock::time_point _startTime;
+
+	std::vector<char> _pending;
+	std::mutex _pendingMutex;
+	std::condition_variable _pendingCv;
+	bool _stop{ false };
+
+	std::thread _writer;
+
+	std::atomic<unsigned int> _nextTraceId{ 1 };
+	std::atomic<long long> _recordedCount{ 0 };
+	std::atomic<long long> _droppedCount{ 0 };
+};
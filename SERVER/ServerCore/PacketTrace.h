@@ -0,0 +1,25 @@
+#pragma once
+
+// Server(PacketRecorder)와 Replay Tool이 함께 쓰는 Packet Trace 파일 구조
+// Windows / pch에 의존하지 않아야 함 (STRESS_TEST/Replay Linux Build)
+
+// Packet Trace 파일 : header 한 번, 이후 record가 연속으로 기록됨 (little endian, padding 없음)
+//  header : magic[8], version:u32, startUnixMs:i64
+//  record : timeUs:u64 (기록 시작 기준 도착 시각), traceId:u32 (Session 구분), size:u16, Packet bytes
+// record는 Thread 간 경쟁으로 timeUs가 조금씩 어긋난 순서로 기록될 수 있으므로 읽는 쪽에서 정렬
+constexpr char PACKET_TRACE_MAGIC[8] = { 'G', 'S', 'P', 'T', 'R', 'A', 'C', 'E' };
+constexpr unsigned int PACKET_TRACE_VERSION = 1;
+
+#pragma pack (push, 1)
+struct PacketTraceHeader {
+	char				magic[8];
+	unsigned int		version;
+	long long			startUnixMs;
+};
+
+struct PacketTraceRecord {
+	unsigned long long	timeUs;
+	unsigned int		traceId;
+	unsigned short		size;
+};
+#pragma pack (pop)
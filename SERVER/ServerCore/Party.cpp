@@ -5,7 +5,7 @@ bool Party::AddMember(const std::shared_ptr<GameSession>& session)
 {
 	int id = session->GetUserID();
 
-	// 1. ߺ ˻
+	// 1. 중복 검사
 	{
 		std::shared_lock lock{ _memberMutex };
 
@@ -15,20 +15,20 @@ bool Party::AddMember(const std::shared_ptr<GameSession>& session)
 		}
 	}
 
-	// 2. ο 
+	// 2. 인원 제한
 	int oldCount = _memberCount.fetch_add(1);
 	if (oldCount >= MAX_MEMBER) {
 		_memberCount.fetch_sub(1);
 		return false;
 	}
 
-	// 3. 
+	// 3. 등록
 	{
 		std::unique_lock lock{ _memberMutex };
 		_members.insert(std::make_pair(id, session));
 	}
 
-	// 4. session Party 
+	// 4. session의 Party 설정
 	session->SetParty(shared_from_this());
 
 	return true;
@@ -77,7 +77,7 @@ void Party::Disband()
 
 void Party::ShareExp(int totalExp)
 {
-	// ִ  Exp Share
+	// 살아있는 멤버만 Exp Share
 	std::vector<std::shared_ptr<GameSession>> aliveMembers;
 	aliveMembers.reserve(_members.size());
 	{
@@ -98,12 +98,13 @@ void Party::ShareExp(int totalExp)
 
 	int shareExp = totalExp / static_cast<int>(aliveMembers.size());
 
-	for (auto member : aliveMembers) {
-		member->AddExp(shareExp);
-	}
-
-	for (auto& sp : aliveMembers) {
-		sp->Send(PacketFactory::BuildStatChangePacket(*sp));
+	// 다른 Member의 Exp는 각자의 Strand에서 변경
+	for (auto& member : aliveMembers) {
+		member->Post([member, shareExp]()
+			{
+				member->AddExp(shareExp);
+				member->Send(PacketFactory::BuildStatChangePacket(*member));
+			});
 	}
 }
 
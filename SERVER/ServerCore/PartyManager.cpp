@@ -52,7 +52,7 @@ std::shared_ptr<Party> PartyManager::GetParty(int id) const
 
 bool PartyManager::HandleRequest(const std::shared_ptr<GameSession>& requester, const std::shared_ptr<GameSession>& responser)
 {
-    // 0. ûڿ ڰ   ó 
+    // 0. 요청자와 응답자가 동일한 경우 처리하지 않음
     if (requester->GetUserID() == responser->GetUserID()) {
         LOG_WRN("Player %d attempted to invite themselves to a party", requester->GetUserID());
         auto failPacket = PacketFactory::BuildPartyResultPacket(responser->GetUserID(), false);
@@ -60,22 +60,22 @@ bool PartyManager::HandleRequest(const std::shared_ptr<GameSession>& requester,
         return false;
     }
 
-    // 1. ̹ Ƽ ִ Ȯ
+    // 1. 이미 파티가 있는지 확인
     if (auto exist = responser->GetParty()) {
         LOG_INF("Player %d already in party %d", responser->GetUserID(), exist->GetId());
 
-        // ̹ ٸ Ƽ  
+        // 이미 다른 파티가 있으면 실패
         auto failPacket = PacketFactory::BuildPartyResultPacket(responser->GetUserID(), false);
         requester->Send(failPacket);
 
         return false;
     }
 
-    // 2. ̹ ٸ ʴ밡 pending  Ȯ
+    // 2. 이미 다른 초대가 pending 중인지 확인
     if (auto exist = responser->GetPendingPartyRequester()) {
         LOG_INF("Player %d already has a pending invite from %d", responser->GetUserID(), exist->GetUserID());
 
-        // ̹ ٸ ʴ밡  
+        // 이미 다른 초대가 있으면 실패
         auto failPacket = PacketFactory::BuildPartyResultPacket(responser->GetUserID(), false);
         requester->Send(failPacket);
 
@@ -85,7 +85,7 @@ bool PartyManager::HandleRequest(const std::shared_ptr<GameSession>& requester,
     // 3. responser Pending Party Requester Setting
     responser->SetPendingPartyRequester(requester);
 
-    // 4. responser Session ʴ ˸ Send
+    // 4. responser Session에게 초대 알림 Send
     auto packetForTarget = PacketFactory::BuildPartyRequestPacket(requester->GetUserID());
     responser->Send(packetForTarget);
 
@@ -94,14 +94,14 @@ bool PartyManager::HandleRequest(const std::shared_ptr<GameSession>& requester,
 
 bool PartyManager::HandleResponse(const std::shared_ptr<GameSession>& responser, bool response)
 {
-    // 1. Pending Party Requester Ľ
+    // 1. Pending Party Requester 파싱
     auto requester = responser->ConsumePendingPartyRequester();
     if (nullptr == requester) {
         LOG_WRN("Party Requester is Null");
         return false;
     }
 
-    // 2. ̹ Ƽ   
+    // 2. 이미 파티에 속해 있으면 거절
     if (nullptr != responser->GetParty()) {
         LOG_INF("Player %d tried to accept invite but is already in party", responser->GetUserID());
 
@@ -109,7 +109,7 @@ bool PartyManager::HandleResponse(const std::shared_ptr<GameSession>& responser,
         return true;
     }
 
-    // 3. requester  ִ Ƽ  á ڵ 
+    // 3. requester가 속해 있는 파티가 정원이 찼으면 자동 거절
     if (auto exist = requester->GetParty()) {
         if (exist->GetMemberInfos().size() >= Party::MAX_MEMBER) {
             LOG_INF("Party[%d] is full, cannot add player %d", exist->GetId(), responser->GetUserID());
@@ -119,7 +119,7 @@ bool PartyManager::HandleResponse(const std::shared_ptr<GameSession>& responser,
         }
     }
 
-    // 4.   or  Ͽ  Send
+    // 4. 실제로 수락 or 거절 하였을 경우 Send
     auto packetForTarget = PacketFactory::BuildPartyResultPacket(responser->GetUserID(), response);
     requester->Send(packetForTarget);
 
@@ -127,7 +127,7 @@ bool PartyManager::HandleResponse(const std::shared_ptr<GameSession>& responser,
         return true;
     }
 
-    // 5. Ƽ 
+    // 5. 파티 생성
     CreateParty(requester, responser);
 
     return true;
@@ -141,11 +141,11 @@ bool PartyManager::HandleLeave(const std::shared_ptr<GameSession>& session)
         return false;
     }
 
-    // 1. Ƽ 
+    // 1. 파티에서 제거
     party->RemoveMember(session->GetUserID());
     session->SetParty(nullptr);
 
-    // 2. Ƽ ػ or Ƽ 
+    // 2. 파티 해산 or 파티 갱신
     if (party->Empty()) {
         party->Disband();
         DisbandParty(party->GetId());
@@ -0,0 +1,185 @@
+#include "pch.h"
+#include "PlayerCache.h"
+
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_DB
+
+PlayerCache::PlayerCache(const std::shared_ptr<IStorage>& storage, const std::shared_ptr<DBExecutor>& dbExecutor)
+	: _storage(storage), _dbExecutor(dbExecutor)
+{
+}
+
+PlayerCache::~PlayerCache()
+{
+	Stop();
+}
+
+void PlayerCache::Start(int flushIntervalMs, std::function<void()> onCapture)
+{
+	if (_running.exchange(true)) {
+		LOG_WRN("PlayerCache already started");
+		return;
+	}
+
+	_flushIntervalMs = std::max(1, flushIntervalMs);
+	_onCapture = std::move(onCapture);
+
+	_flusher = std::thread(&PlayerCache::FlusherThread, this);
+
+	LOG_INF("PlayerCache started (flush interval %d ms)", _flushIntervalMs);
+}
+
+void PlayerCache::Stop()
+{
+	if (not _running.exchange(false)) {
+		return;
+	}
+
+	{
+		std::lock_guard lock{ _flusherMutex };
+		_flusherCv.notify_all();
+	}
+
+	if (_flusher.joinable()) {
+		_flusher.join();
+	}
+
+	// 종료 시 남은 변경 모두 기록
+	Flush();
+}
+
+void PlayerCache::Track(const UserData& userData, const std::vector<QuestData>& quests)
+{
+	std::lock_guard lock{ _mutex };
+	_tracked.insert_or_assign(userData.id, TrackedUser{ userData, quests });
+}
+
+void PlayerCache::UpdateUser(const UserData& userData, const std::vector<QuestData>& quests)
+{
+	std::lock_guard lock{ _mutex };
+
+	auto it = _tracked.find(userData.id);
+	if (it == _tracked.end()) {
+		return;
+	}
+
+	TrackedUser& tracked = it->second;
+
+	// 1. 기준값과 같으면 기록할 필요 없음
+	bool userChanged = not (tracked.userData == userData);
+	bool questChanged = not (tracked.quests == quests);
+
+	if ((not userChanged) and (not questChanged)) {
+		return;
+	}
+
+	// 2. 마지막 값만 남기고 기준값 갱신
+	DirtyEntry& entry = _dirty[userData.id];
+
+	if (userChanged) {
+		entry.userDirty = true;
+		entry.userData = userData;
+		tracked.userData = userData;
+	}
+
+	if (questChanged) {
+		entry.questDirty = true;
+		entry.quests = quests;
+		tracked.quests = quests;
+	}
+}
+
+void PlayerCache::AddItem(int userId, int itemId, int delta)
+{
+	if (0 == delta) {
+		return;
+	}
+
+	std::lock_guard lock{ _mutex };
+
+	// 획득/사용을 누적해서 Flush 때 증감량 하나로 기록
+	_dirty[userId].itemDeltas[itemId] += delta;
+}
+
+void PlayerCache::Release(int userId)
+{
+	DirtyEntry entry;
+	bool hasEntry{ false };
+
+	{
+		std::lock_guard lock{ _mutex };
+		_tracked.erase(userId);
+
+		auto it = _dirty.find(userId);
+		if (it != _dirty.end()) {
+			entry = std::move(it->second);
+			_dirty.erase(it);
+			hasEntry = true;
+		}
+	}
+
+	if (hasEntry) {
+		WriteEntry(userId, std::move(entry));
+	}
+}
+
+void PlayerCache::Flush()
+{
+	std::unordered_map<int, DirtyEntry> dirty;
+	{
+		std::lock_guard lock{ _mutex };
+		dirty.swap(_dirty);
+	}
+
+	for (auto& [userId, entry] : dirty) {
+		WriteEntry(userId, std::move(entry));
+	}
+}
+
+void PlayerCache::FlusherThread()
+{
+	Profiler::SetThreadName("PlayerCache");
+
+	while (true) {
+		{
+			std::unique_lock lock{ _flusherMutex };
+			_flusherCv.wait_for(lock, std::chrono::milliseconds(_flushIntervalMs), [this]() { return not _running.load(); });
+		}
+
+		if (not _running.load()) {
+			break;
+		}
+
+		// Capture는 각 Session Strand로 비동기 전달되므로 이번 값은 다음 Flush에 반영됨
+		if (_onCapture) {
+			_onCapture();
+		}
+
+		Flush();
+	}
+}
+
+void PlayerCache::WriteEntry(int userId, DirtyEntry&& entry)
+{
+	// 같은 User는 같은 DB Thread에서 순서대로 기록
+	_dbExecutor->Post(userId, [storage = _storage, userId, entry = std::move(entry)]()
+		{
+			if (entry.userDirty) {
+				storage->UpdateUserInfo(entry.userData);
+			}
+
+			if (entry.questDirty) {
+				storage->UpdateUserQuests(userId, entry.quests);
+			}
+
+			for (const auto& [itemId, delta] : entry.itemDeltas) {
+				if (delta > 0) {
+					storage->UserGetItem(userId, itemId, delta);
+				}
+
+				else if (delta < 0) {
+					storage->UserUseItem(userId, itemId, -delta);
+				}
+			}
+		});
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+// Player 상태를 바로 DB에 쓰지 않고 모아 두었다가 주기적으로 한 번에 반영하는 Write-Behind Cache
+// 같은 User의 변경은 마지막 값(UserData, Quest) / 누적 증감량(Item)으로 합쳐서 기록
+class PlayerCache
+{
+	struct DirtyEntry {
+		bool userDirty{ false };
+		bool questDirty{ false };
+
+		UserData userData{ -1, };
+		std::vector<QuestData> quests;
+		std::unordered_map<int, int> itemDeltas;
+	};
+
+	struct TrackedUser {
+		UserData userData;
+		std::vector<QuestData> quests;
+	};
+
+public:
+	static constexpr int DEFAULT_FLUSH_INTERVAL_MS{ 5000 };
+
+public:
+	PlayerCache(const std::shared_ptr<IStorage>& storage, const std::shared_ptr<DBExecutor>& dbExecutor);
+	~PlayerCache();
+
+public:
+	// onCapture : Flush 직전에 호출, 접속 중인 Player 상태를 Cache에 넣는 용도
+	void Start(int flushIntervalMs, std::function<void()> onCapture);
+	void Stop();
+
+	// DB에서 읽은(또는 넘겨받은) 상태를 기준값으로 등록
+	void Track(const UserData& userData, const std::vector<QuestData>& quests);
+
+	// 기준값과 달라졌을 때만 Dirty로 표시, Track되지 않은 User는 무시
+	void UpdateUser(const UserData& userData, const std::vector<QuestData>& quests);
+	void AddItem(int userId, int itemId, int delta);
+
+	// 해당 User의 변경을 바로 DB Thread로 넘기고 Track 해제
+	void Release(int userId);
+	void Flush();
+
+private:
+	void FlusherThread();
+	void WriteEntry(int userId, DirtyEntry&& entry);
+
+private:
+	std::shared_ptr<IStorage> _storage;
+	std::shared_ptr<DBExecutor> _dbExecutor;
+
+	std::unordered_map<int, TrackedUser> _tracked;
+	std::unordered_map<int, DirtyEntry> _dirty;
+	std::mutex _mutex;
+
+	std::thread _flusher;
+	std::atomic<bool> _running{ false };
+	std::mutex _flusherMutex;
+	std::condition_variable _flusherCv;
+
+	int _flushIntervalMs{ DEFAULT_FLUSH_INTERVAL_MS };
+	std::function<void()> _onCapture;
+};
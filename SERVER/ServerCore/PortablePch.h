@@ -0,0 +1,34 @@
+#pragma once
+
+// SERVERCORE_PORTABLE 빌드용 pch (SERVER/MicroBench)
+// Windows / IOCP / ODBC에 의존하지 않는 File만 포함 : RecvBuffer, Sector, ViewQuery, AStar, Metrics, AtomicQueue, TimerEvent, PacketFactory (Serialize, 필드 Builder)
+
+#include <vector>
+#include <array>
+#include <queue>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <algorithm>
+#include <type_traits>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <cstring>
+
+#include "RecvBuffer.h"
+#include "AtomicQueue.h"
+#include "Metrics.h"
+#include "TimerEvent.h"
+#include "Sector.h"
+#include "ViewQuery.h"
+#include "AStar.h"
+#include "Macro.h"
+#include "protocol.h"
+#include "PacketFactory.h"
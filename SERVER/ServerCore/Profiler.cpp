@@ -0,0 +1,232 @@
+#include "pch.h"
+#include "Profiler.h"
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+namespace
+{
+	struct ZoneSummary {
+		unsigned long long count{ 0 };
+		long long totalNs{ 0 };
+		long long maxNs{ 0 };
+	};
+
+	void AppendMicroseconds(std::string& out, long long ns)
+	{
+		char buf[32];
+		snprintf(buf, sizeof(buf), "%lld.%03lld", ns / 1000, ns % 1000);
+		out += buf;
+	}
+}
+
+void Profiler::SetThreadName(const std::string& name)
+{
+	ProfileThreadBuffer& buffer = GetBuffer();
+
+	std::lock_guard lock{ buffer.lock };
+	buffer.threadName = name;
+}
+
+void Profiler::Record(const char* name, Clock::time_point start, Clock::time_point end)
+{
+	// Capture 시작 전에 열린 Zone은 버림
+	long long startNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		start - Clock::time_point{ Clock::duration{ _captureStart.load(std::memory_order_relaxed) } }).count();
+	if (startNs < 0) {
+		return;
+	}
+
+	ProfileThreadBuffer& buffer = GetBuffer();
+
+	std::lock_guard lock{ buffer.lock };
+	if (buffer.events.size() >= MAX_EVENTS_PER_THREAD) {
+		++buffer.dropped;
+		return;
+	}
+
+	buffer.events.push_back(ProfileEvent{ name, startNs, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() });
+}
+
+ProfileThreadBuffer* Profiler::RegisterThread()
+{
+	auto buffer = std::make_unique<ProfileThreadBuffer>();
+	buffer->threadId = static_cast<unsigned int>(::GetCurrentThreadId());
+
+	ProfileThreadBuffer* raw = buffer.get();
+	{
+		std::lock_guard lock{ _buffersLock };
+		_buffers.push_back(std::move(buffer));
+	}
+
+	_threadBuffer = raw;
+	return raw;
+}
+
+void Profiler::Begin()
+{
+	// 1. 이전 Capture 잔여 Event 제거
+	{
+		std::lock_guard lock{ _buffersLock };
+		for (auto& buffer : _buffers) {
+			std::lock_guard bufferLock{ buffer->lock };
+			buffer->events.clear();
+			buffer->dropped = 0;
+		}
+	}
+
+	// 2. 기준 시각 설정 후 기록 시작
+	_captureStart.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+	_enabled.store(true);
+
+	LOG_INF("Profiler capture started");
+}
+
+bool Profiler::End(const std::string& path)
+{
+	_enabled.store(false);
+
+	// Thread별 Event를 꺼내고 Lock 밖에서 JSON 작성
+	std::vector<std::pair<const ProfileThreadBuffer*, std::vector<ProfileEvent>>> threads;
+	unsigned long long dropped{ 0 };
+	{
+		std::lock_guard lock{ _buffersLock };
+		for (auto& buffer : _buffers) {
+			std::lock_guard bufferLock{ buffer->lock };
+			dropped += buffer->dropped;
+
+			if (not buffer->events.empty()) {
+				threads.emplace_back(buffer.get(), std::move(buffer->events));
+				buffer->events.clear();
+			}
+		}
+	}
+
+	if (dropped > 0) {
+		LOG_WRN("Profiler dropped %llu events (per-thread limit %zu)", dropped, MAX_EVENTS_PER_THREAD);
+	}
+
+	return WriteTrace(path, threads);
+}
+
+bool Profiler::Capture(const std::string& path, int durationMs)
+{
+	if (_capturing.exchange(true)) {
+		LOG_WRN("Profiler capture already running");
+		return false;
+	}
+
+	if (_captureThread.joinable()) {
+		_captureThread.join();
+	}
+
+	{
+		std::lock_guard lock{ _captureLock };
+		_captureStop = false;
+	}
+
+	_captureThread = std::thread([path, durationMs]()
+		{
+			Begin();
+			{
+				std::unique_lock lock{ _captureLock };
+				_captureCv.wait_for(lock, std::chrono::milliseconds(durationMs), []() { return _captureStop; });
+			}
+			End(path);
+
+			_capturing.store(false);
+		});
+	return true;
+}
+
+void Profiler::StopCapture()
+{
+	{
+		std::lock_guard lock{ _captureLock };
+		_captureStop = true;
+	}
+	_captureCv.notify_all();
+
+	if (_captureThread.joinable()) {
+		_captureThread.join();
+	}
+}
+
+bool Profiler::WriteTrace(const std::string& path, const std::vector<std::pair<const ProfileThreadBuffer*, std::vector<ProfileEvent>>>& threads)
+{
+	// {"traceEvents":[...],"displayTimeUnit":"ms","zoneSummary":[...]}
+	// ts / dur 단위는 us, zoneSummary는 Zone 이름별 호출 수와 누적 / 최대 시간 (Handler별 CPU 점유 비교용)
+	std::string out;
+	out.reserve(1 << 20);
+	out += "{\"traceEvents\":[";
+
+	std::map<std::string, ZoneSummary> summaries;
+	bool first{ true };
+
+	for (const auto& [buffer, events] : threads) {
+		const std::string tid = std::to_string(buffer->threadId);
+
+		// 1. Thread 이름 Metadata
+		if (not first) out += ',';
+		first = false;
+		out += "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid + ",\"args\":{\"name\":\"";
+		out += buffer->threadName.empty() ? ("Thread " + tid) : buffer->threadName;
+		out += "\"}}";
+
+		// 2. Complete Event
+		for (const ProfileEvent& event : events) {
+			out += ",\n{\"name\":\"";
+			out += event.name;
+			out += "\",\"ph\":\"X\",\"pid\":1,\"tid\":" + tid + ",\"ts\":";
+			AppendMicroseconds(out, event.startNs);
+			out += ",\"dur\":";
+			AppendMicroseconds(out, event.durationNs);
+			out += '}';
+
+			ZoneSummary& summary = summaries[event.name];
+			++summary.count;
+			summary.totalNs += event.durationNs;
+			summary.maxNs = std::max(summary.maxNs, event.durationNs);
+		}
+	}
+
+	out += "\n],\"displayTimeUnit\":\"ms\",\"zoneSummary\":[";
+
+	// 3. 누적 시간이 큰 Zone부터
+	std::vector<std::pair<std::string, ZoneSummary>> sorted(summaries.begin(), summaries.end());
+	std::sort(sorted.begin(), sorted.end(),
+		[](const auto& a, const auto& b) { return a.second.totalNs > b.second.totalNs; });
+
+	for (size_t i = 0; i < sorted.size(); ++i) {
+		const auto& [name, summary] = sorted[i];
+		if (i > 0) out += ',';
+		out += "\n{\"name\":\"" + name + "\",\"count\":" + std::to_string(summary.count) + ",\"totalUs\":";
+		AppendMicroseconds(out, summary.totalNs);
+		out += ",\"maxUs\":";
+		AppendMicroseconds(out, summary.maxNs);
+		out += '}';
+	}
+	out += "\n]}\n";
+
+	// 4. 임시 파일에 쓴 뒤 교체
+	std::string tempPath = path + ".tmp";
+	{
+		std::ofstream ofs{ tempPath, std::ios::trunc | std::ios::binary };
+		if (not ofs) {
+			LOG_WRN("Profiler trace open failed: %s", tempPath);
+			return false;
+		}
+		ofs.write(out.data(), out.size());
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tempPath, path, ec);
+	if (ec) {
+		LOG_WRN("Profiler trace rename failed: %s", ec.message());
+		return false;
+	}
+
+	LOG_INF("Profiler trace written: %s", path);
+	return true;
+}
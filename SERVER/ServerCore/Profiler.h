@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// PROFILE_ZONE("name")으로 감싼 구간의 시작 / 길이를 기록해서 Chrome Trace Event JSON으로 저장
+// (chrome://tracing, ui.perfetto.dev에서 열기). 항상 컴파일되고 Capture 중에만 기록
+// name은 문자열 상수만 사용 (포인터만 저장)
+struct ProfileEvent {
+	const char* name;
+	long long startNs;		// Capture 시작 기준
+	long long durationNs;
+};
+
+// Thread별 Event 목록. 소유 Thread와 Capture 종료 시점만 Lock을 잡으므로 경쟁 거의 없음
+struct ProfileThreadBuffer {
+	unsigned int threadId{ 0 };
+	std::string threadName;
+
+	std::mutex lock;
+	std::vector<ProfileEvent> events;
+	unsigned long long dropped{ 0 };
+};
+
+class Profiler
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr size_t MAX_EVENTS_PER_THREAD{ 1 << 20 };
+
+public:
+	static bool IsEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+	// Trace에서 Thread 이름으로 표시 (IOCP Worker, Region 등)
+	static void SetThreadName(const std::string& name);
+
+	static void Record(const char* name, Clock::time_point start, Clock::time_point end);
+
+public:
+	// 기록 시작 / 종료 후 path에 JSON 저장
+	static void Begin();
+	static bool End(const std::string& path);
+
+	// durationMs 동안 기록하고 path에 저장 (별도 Thread). 이미 Capture 중이면 false
+	static bool Capture(const std::string& path, int durationMs);
+	static void StopCapture();
+
+private:
+	static ProfileThreadBuffer& GetBuffer()
+	{
+		ProfileThreadBuffer* buffer = _threadBuffer;
+		if (nullptr == buffer) {
+			buffer = RegisterThread();
+		}
+		return *buffer;
+	}
+
+	static ProfileThreadBuffer* RegisterThread();
+	static bool WriteTrace(const std::string& path, const std::vector<std::pair<const ProfileThreadBuffer*, std::vector<ProfileEvent>>>& threads);
+
+private:
+	static inline std::atomic<bool>										_enabled{ false };
+	static inline std::atomic<Clock::rep>								_captureStart{ 0 };
+
+	static inline thread_local ProfileThreadBuffer*						_threadBuffer{ nullptr };
+	static inline std::mutex											_buffersLock;
+	static inline std::vector<std::unique_ptr<ProfileThreadBuffer>>	_buffers;
+
+	static inline std::thread											_captureThread;
+	static inline std::mutex											_captureLock;
+	static inline std::condition_variable								_captureCv;
+	static inline bool													_captureStop{ false };
+	static inline std::atomic<bool>										_capturing{ false };
+};
+
+// 생성 시점에 Capture 중이었을 때만 소멸 시점에 기록
+class ProfileZone
+{
+public:
+	explicit ProfileZone(const char* name) : _name(name), _active(Profiler::IsEnabled())
+	{
+		if (_active) {
+			_start = Profiler::Clock::now();
+		}
+	}
+
+	~ProfileZone()
+	{
+		if (_active) {
+			Profiler::Record(_name, _start, Profiler::Clock::now());
+		}
+	}
+
+	ProfileZone(const ProfileZone&) = delete;
+	ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+	const char* _name;
+	bool _active;
+	Profiler::Clock::time_point _start;
+};
@@ -1,6 +1,9 @@
 ﻿#include "pch.h"
 #include "QuestManager.h"
 
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_QUEST
+
 QuestManager::QuestManager(const std::shared_ptr<Service>& service) : _service(service)
 {
     Init();
@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "RecvBuffer.h"
 
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_NET
+
 RecvBuffer::RecvBuffer(int bufferSize) : _readPos(0), _writePos(0)
 {
 	_buffer.resize(bufferSize);
@@ -35,23 +38,23 @@ int RecvBuffer::GetContiguousFreeSize() const
 
 bool RecvBuffer::Write(const char* data, int dataSize)
 {
-	// 1. Buffer   ִ Ȯ
-	//  - ִٸ Write 
-	//  - ٸ false returnϰ ߿ Write
+	// 1. Buffer에 빈 공간이 있는지 확인
+	//  - 있다면 Write 진행
+	//  - 없다면 false를 return하고 나중에 Write진행
 	if (dataSize <= 0) return false;
 	if (dataSize > GetFreeSize()) {
 		LOG_WRN("RecvBuffer::Write overflow (size: %d, free: %d)", dataSize, GetFreeSize());
 		return false;
 	}
 
-	// 2. Write 
-	//  - data _buffer ϰ
-	//  - writePos dataSizeŭ ̵
+	// 2. Write 진행
+	//  - data를 _buffer에 복사하고
+	//  - writePos를 dataSize만큼 이동
 
-	//  
-	// dataSize _capacity - _writePos  Ŭ 
-	// _capacity - _writePosŭ ϰ
-	//  Data _buffer ù κп ؾ 
+	// 유의할 점
+	// dataSize가 _capacity - _writePos 보다 클 때
+	// _capacity - _writePos만큼만 복사하고
+	// 남은 Data를 _buffer의 첫 부분에 복사해야 함
 	
 	if (data != nullptr) {
 		int	sizeToEnd = static_cast<int>(_buffer.size()) - _writePos;
@@ -69,23 +72,23 @@ bool RecvBuffer::Write(const char* data, int dataSize)
 
 bool RecvBuffer::Read(char* readBuffer, int readSize)
 {
-	// 1.  Sizeŭ Data  ִ Ȯ
-	//  - ִٸ Read 
-	//  - ٸ false returnϰ ߿ Read 
+	// 1. 읽을 Size만큼 Data가 들어가 있는지 확인
+	//  - 있다면 Read 진행
+	//  - 없다면 false를 return하고 나중에 Read 진행
 	if (readSize <= 0) return false;
 	if (readSize > GetUsedSize()) {
 		LOG_WRN("RecvBuffer::Read underflow (size: %d, used: %d)", readSize, GetUsedSize());
 		return false;
 	}
 
-	// 2. Read 
-	//  - data readBuffer ϰ
-	//  - readPos readSizeŭ ̵
+	// 2. Read 진행
+	//  - data를 readBuffer에 복사하고
+	//  - readPos를 readSize만큼 이동
 
-	//  
-	// dataSize _capacity - _readPos  Ŭ 
-	// _capacity - _readPosŭ ϰ
-	//  Sizeŭ _buffer ù κп ؾ 
+	// 유의할 점
+	// dataSize가 _capacity - _readPos 보다 클 때
+	// _capacity - _readPos만큼만 복사하고
+	// 남은 Size만큼 _buffer의 첫 부분에서 복사해야 됨
 	
 	int sizeToEnd = static_cast<int>(_buffer.size()) - _readPos;
 	int firstCopySize = std::min<int>(readSize, sizeToEnd);
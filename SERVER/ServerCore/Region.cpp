@@ -0,0 +1,184 @@
+#include "pch.h"
+#include "Region.h"
+
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_VIEW
+
+thread_local Region* Region::t_current{ nullptr };
+
+Region::Region(int id, int minSx, int minSy, int maxSx, int maxSy)
+	: _id(id), _minSx(minSx), _minSy(minSy), _maxSx(maxSx), _maxSy(maxSy)
+{
+	_haloMinSx = std::max(0, minSx - HALO_SECTORS);
+	_haloMinSy = std::max(0, minSy - HALO_SECTORS);
+	_haloMaxSx = std::min(SECTOR_COUNT - 1, maxSx + HALO_SECTORS);
+	_haloMaxSy = std::min(SECTOR_COUNT - 1, maxSy + HALO_SECTORS);
+
+	_sectors.resize((_haloMaxSx - _haloMinSx + 1) * (_haloMaxSy - _haloMinSy + 1));
+}
+
+Region::~Region()
+{
+	Stop();
+}
+
+void Region::Start()
+{
+	if (_running.exchange(true)) {
+		return;
+	}
+
+	_thread = std::thread(&Region::WorkerThread, this);
+}
+
+void Region::Stop()
+{
+	if (not _running.exchange(false)) {
+		return;
+	}
+
+	_jobCv.notify_all();
+
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+
+	std::lock_guard lock{ _jobMutex };
+	_jobs.clear();
+}
+
+void Region::Post(Job job)
+{
+	// Start 전에 들어온 Job(초기 Spawn 등)은 쌓아뒀다가 Thread 시작 후 처리
+	{
+		std::lock_guard lock{ _jobMutex };
+		_jobs.push_back(std::move(job));
+	}
+
+	_jobCv.notify_one();
+}
+
+size_t Region::RunPending()
+{
+	if (_running.load()) {
+		LOG_ERR("Region[%d] RunPending called while thread is running", _id);
+		return 0;
+	}
+
+	std::deque<Job> jobs;
+	{
+		std::lock_guard lock{ _jobMutex };
+		jobs.swap(_jobs);
+	}
+
+	t_current = this;
+	for (Job& job : jobs) {
+		job();
+	}
+	t_current = nullptr;
+
+	return jobs.size();
+}
+
+long long Region::GetPendingCount()
+{
+	std::lock_guard lock{ _jobMutex };
+	return static_cast<long long>(_jobs.size());
+}
+
+void Region::AddObject(int id, int sx, int sy)
+{
+	int index = GetLocalIndex(sx, sy);
+	if (index < 0) {
+		LOG_ERR("Region[%d] AddObject out of range (%d, %d)", _id, sx, sy);
+		return;
+	}
+
+	_sectors[index].insert(id);
+}
+
+void Region::RemoveObject(int id, int sx, int sy)
+{
+	int index = GetLocalIndex(sx, sy);
+	if (index < 0) {
+		LOG_ERR("Region[%d] RemoveObject out of range (%d, %d)", _id, sx, sy);
+		return;
+	}
+
+	_sectors[index].erase(id);
+}
+
+std::unordered_set<int> Region::CollectSectorObjects(int sx, int sy, int radius) const
+{
+	return CollectSectorObjects({ sx - radius, sx + radius }, { sy - radius, sy + radius });
+}
+
+std::unordered_set<int> Region::CollectSectorObjects(std::pair<int, int> xRange, std::pair<int, int> yRange) const
+{
+	// Halo 밖은 Mirror가 없으므로 Halo 범위로 잘라냄
+	int minX = std::clamp(xRange.first, _haloMinSx, _haloMaxSx);
+	int maxX = std::clamp(xRange.second, _haloMinSx, _haloMaxSx);
+	int minY = std::clamp(yRange.first, _haloMinSy, _haloMaxSy);
+	int maxY = std::clamp(yRange.second, _haloMinSy, _haloMaxSy);
+
+	std::unordered_set<int> result;
+
+	for (int x = minX; x <= maxX; ++x) {
+		for (int y = minY; y <= maxY; ++y) {
+			const auto& objects = _sectors[GetLocalIndex(x, y)];
+			result.insert(objects.begin(), objects.end());
+		}
+	}
+
+	return result;
+}
+
+bool Region::Owns(int sx, int sy) const
+{
+	return (sx >= _minSx) and (sx <= _maxSx) and (sy >= _minSy) and (sy <= _maxSy);
+}
+
+bool Region::InHalo(int sx, int sy) const
+{
+	return (sx >= _haloMinSx) and (sx <= _haloMaxSx) and (sy >= _haloMinSy) and (sy <= _haloMaxSy);
+}
+
+void Region::WorkerThread()
+{
+	Profiler::SetThreadName("Region " + std::to_string(_id));
+	Watchdog::RegisterWorker("Region " + std::to_string(_id));
+	t_current = this;
+
+	std::deque<Job> jobs;
+	while (true) {
+		Watchdog::Idle();
+		{
+			std::unique_lock lock{ _jobMutex };
+			_jobCv.wait(lock, [this]() { return (not _jobs.empty()) or (not _running.load()); });
+
+			if (not _running.load()) {
+				break;
+			}
+
+			jobs.swap(_jobs);
+		}
+
+		for (Job& job : jobs) {
+			Watchdog::Heartbeat();
+			job();
+		}
+		jobs.clear();
+	}
+
+	t_current = nullptr;
+	Watchdog::UnregisterWorker();
+}
+
+int Region::GetLocalIndex(int sx, int sy) const
+{
+	if (not InHalo(sx, sy)) {
+		return -1;
+	}
+
+	return (sx - _haloMinSx) * (_haloMaxSy - _haloMinSy + 1) + (sy - _haloMinSy);
+}
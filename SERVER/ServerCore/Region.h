@@ -0,0 +1,67 @@
+#pragma once
+
+// 월드를 Sector 단위 직사각형으로 나눈 Simulation 구역
+// Region 전용 Thread 하나가 소유 Sector의 NPC Tick과 Sector Mirror 갱신을 모두 처리
+class Region
+{
+public:
+	// 시야(VIEW_RANGE)가 Sector 하나보다 작으므로 경계 바깥 1 Sector만 보면 충분
+	static constexpr int HALO_SECTORS{ 1 };
+
+public:
+	Region(int id, int minSx, int minSy, int maxSx, int maxSy);
+	~Region();
+
+public:
+	void Start();
+	void Stop();
+
+	void Post(Job job);
+
+	// Start하지 않은 Region의 Job을 호출 Thread에서 실행 (Simulation)
+	size_t RunPending();
+
+	long long GetPendingCount();
+
+public:
+	// Region Thread에서만 호출
+	void AddObject(int id, int sx, int sy);
+	void RemoveObject(int id, int sx, int sy);
+	std::unordered_set<int> CollectSectorObjects(int sx, int sy, int radius) const;
+	std::unordered_set<int> CollectSectorObjects(std::pair<int, int> xRange, std::pair<int, int> yRange) const;
+
+public:
+	int GetId() const { return _id; }
+	bool Owns(int sx, int sy) const;
+	bool InHalo(int sx, int sy) const;
+	bool IsCurrent() const { return t_current == this; }
+
+	// 호출 Thread가 실행 중인 Region (Region Thread / RunPending 밖이면 nullptr)
+	static Region* GetCurrent() { return t_current; }
+
+private:
+	void WorkerThread();
+	int GetLocalIndex(int sx, int sy) const;
+
+private:
+	int _id;
+
+	// 소유 Sector 범위 (inclusive)
+	int _minSx, _minSy, _maxSx, _maxSy;
+
+	// 소유 Sector + Halo 범위 (inclusive)
+	int _haloMinSx, _haloMinSy, _haloMaxSx, _haloMaxSy;
+
+	// 소유 + Halo Sector의 Object 목록, Region Thread만 접근하므로 Lock 없음
+	std::vector<std::unordered_set<int>> _sectors;
+
+private:
+	std::thread _thread;
+	std::atomic<bool> _running{ false };
+
+	std::deque<Job> _jobs;
+	std::mutex _jobMutex;
+	std::condition_variable _jobCv;
+
+	static thread_local Region* t_current;
+};
@@ -0,0 +1,163 @@
+#include "pch.h"
+#include "RegionManager.h"
+
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_VIEW
+
+RegionManager::RegionManager(int regionCountX, int regionCountY)
+{
+	_regionCountX = std::clamp(regionCountX, 1, SECTOR_COUNT);
+	_regionCountY = std::clamp(regionCountY, 1, SECTOR_COUNT);
+
+	_regionWidth = (SECTOR_COUNT + _regionCountX - 1) / _regionCountX;
+	_regionHeight = (SECTOR_COUNT + _regionCountY - 1) / _regionCountY;
+
+	_regions.reserve(_regionCountX * _regionCountY);
+	for (int rx = 0; rx < _regionCountX; ++rx) {
+		for (int ry = 0; ry < _regionCountY; ++ry) {
+			int minSx = rx * _regionWidth;
+			int minSy = ry * _regionHeight;
+			int maxSx = std::min(SECTOR_COUNT - 1, minSx + _regionWidth - 1);
+			int maxSy = std::min(SECTOR_COUNT - 1, minSy + _regionHeight - 1);
+
+			_regions.push_back(std::make_unique<Region>(static_cast<int>(_regions.size()), minSx, minSy, maxSx, maxSy));
+		}
+	}
+
+	LOG_INF("RegionManager created %d x %d regions", _regionCountX, _regionCountY);
+}
+
+RegionManager::~RegionManager()
+{
+	Stop();
+}
+
+void RegionManager::Start()
+{
+	for (auto& region : _regions) {
+		region->Start();
+	}
+}
+
+void RegionManager::Stop()
+{
+	for (auto& region : _regions) {
+		region->Stop();
+	}
+}
+
+size_t RegionManager::RunPending()
+{
+	size_t executed{ 0 };
+	for (auto& region : _regions) {
+		executed += region->RunPending();
+	}
+
+	return executed;
+}
+
+long long RegionManager::GetPendingCount()
+{
+	long long pending{ 0 };
+	for (auto& region : _regions) {
+		pending += region->GetPendingCount();
+	}
+
+	return pending;
+}
+
+Region& RegionManager::GetRegion(int sx, int sy)
+{
+	int rx = std::clamp(sx / _regionWidth, 0, _regionCountX - 1);
+	int ry = std::clamp(sy / _regionHeight, 0, _regionCountY - 1);
+
+	return *_regions[rx * _regionCountY + ry];
+}
+
+void RegionManager::Post(int sx, int sy, Job job)
+{
+	GetRegion(sx, sy).Post(std::move(job));
+}
+
+void RegionManager::NotifyEnter(int id, int sx, int sy)
+{
+	for (auto& region : _regions) {
+		if (not region->InHalo(sx, sy)) continue;
+
+		Region* target = region.get();
+		if (target->IsCurrent()) {
+			target->AddObject(id, sx, sy);
+		}
+
+		else {
+			target->Post([target, id, sx, sy]() { target->AddObject(id, sx, sy); });
+		}
+	}
+}
+
+void RegionManager::NotifyEnter(std::vector<int> ids, int sx, int sy)
+{
+	auto shared = std::make_shared<const std::vector<int>>(std::move(ids));
+
+	for (auto& region : _regions) {
+		if (not region->InHalo(sx, sy)) continue;
+
+		Region* target = region.get();
+		auto addObjects = [target, shared, sx, sy]()
+			{
+				for (int id : *shared) {
+					target->AddObject(id, sx, sy);
+				}
+			};
+
+		if (target->IsCurrent()) {
+			addObjects();
+		}
+
+		else {
+			target->Post(std::move(addObjects));
+		}
+	}
+}
+
+void RegionManager::NotifyLeave(int id, int sx, int sy)
+{
+	for (auto& region : _regions) {
+		if (not region->InHalo(sx, sy)) continue;
+
+		Region* target = region.get();
+		if (target->IsCurrent()) {
+			target->RemoveObject(id, sx, sy);
+		}
+
+		else {
+			target->Post([target, id, sx, sy]() { target->RemoveObject(id, sx, sy); });
+		}
+	}
+}
+
+void RegionManager::NotifyMove(int id, int oldSx, int oldSy, int newSx, int newSy)
+{
+	// 이전 / 새 Sector 중 하나라도 Halo로 보는 Region에 Remove + Add를 Job 하나로 전달
+	// Region Queue는 FIFO이므로 같은 Object의 Enter / Leave 순서가 Region마다 유지됨
+	for (auto& region : _regions) {
+		bool seesOld = region->InHalo(oldSx, oldSy);
+		bool seesNew = region->InHalo(newSx, newSy);
+		if ((not seesOld) and (not seesNew)) continue;
+
+		Region* target = region.get();
+		auto moveObject = [target, id, oldSx, oldSy, newSx, newSy, seesOld, seesNew]()
+			{
+				if (seesOld) target->RemoveObject(id, oldSx, oldSy);
+				if (seesNew) target->AddObject(id, newSx, newSy);
+			};
+
+		if (target->IsCurrent()) {
+			moveObject();
+		}
+
+		else {
+			target->Post(std::move(moveObject));
+		}
+	}
+}
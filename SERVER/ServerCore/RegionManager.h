@@ -0,0 +1,58 @@
+#pragma once
+
+class Region;
+
+// 월드를 regionCountX x regionCountY개의 Region으로 나누고 Sector 변경을 전달
+class RegionManager
+{
+public:
+	RegionManager(int regionCountX, int regionCountY);
+	~RegionManager();
+
+public:
+	void Start();
+	void Stop();
+
+	// Region Thread 대신 호출 Thread에서 Region 순서대로 Job 실행 (Simulation)
+	size_t RunPending();
+
+	// 모든 Region Queue에 쌓인 Job 수 (Watchdog)
+	long long GetPendingCount();
+
+public:
+	Region& GetRegion(int sx, int sy);
+	void Post(int sx, int sy, Job job);
+
+	// 호출 Thread가 (sx, sy)를 소유한 Region Thread면 바로 실행, 아니면 소유 Region에 Post
+	template<typename Func>
+	void Run(int sx, int sy, Func&& func);
+
+	// Sector 변경을 소유 Region과 Halo로 보고 있는 Region에 모두 전달
+	// 호출 Thread의 Region Mirror는 바로 갱신해서 같은 Job 안의 수집에 반영
+	void NotifyEnter(int id, int sx, int sy);
+	void NotifyEnter(std::vector<int> ids, int sx, int sy);
+	void NotifyLeave(int id, int sx, int sy);
+	void NotifyMove(int id, int oldSx, int oldSy, int newSx, int newSy);
+
+private:
+	int _regionCountX;
+	int _regionCountY;
+
+	// Region 하나가 가지는 Sector 수
+	int _regionWidth;
+	int _regionHeight;
+
+	std::vector<std::unique_ptr<Region>> _regions;
+};
+
+template<typename Func>
+void RegionManager::Run(int sx, int sy, Func&& func)
+{
+	Region& region = GetRegion(sx, sy);
+	if (region.IsCurrent()) {
+		func();
+		return;
+	}
+
+	region.Post(Job{ std::forward<Func>(func) });
+}
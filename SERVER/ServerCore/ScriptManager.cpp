@@ -0,0 +1,391 @@
+#include "pch.h"
+#include "ScriptManager.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+	using LuaStatePtr = std::unique_ptr<lua_State, decltype(&lua_close)>;
+
+	// typeId 순서 (1 PeaceFixed, 2 PeaceRoaming, 3 AgroFixed, 4 AgroRoaming)
+	constexpr const char* s_aiTypeNames[4]{ "PeaceFixed", "PeaceRoaming", "AgroFixed", "AgroRoaming" };
+
+	// Worker Thread마다 하나. Thread가 끝날 때 닫힘
+	struct WorkerLuaState {
+		unsigned int version{ 0 };
+		lua_State* L{ nullptr };
+
+		~WorkerLuaState()
+		{
+			if (nullptr != L) {
+				lua_close(L);
+			}
+		}
+	};
+
+	thread_local WorkerLuaState t_luaState;
+
+	// Worker Thread마다 마지막으로 본 Bundle. Reload 뒤에는 다음 호출 때 한 번만 다시 load
+	struct CachedBundle {
+		unsigned int version{ 0 };
+		std::shared_ptr<const ScriptBundle> bundle;
+	};
+
+	thread_local CachedBundle t_cachedBundle;
+
+	int WriteChunk(lua_State* L, const void* data, size_t size, void* userData)
+	{
+		static_cast<std::string*>(userData)->append(static_cast<const char*>(data), size);
+		return 0;
+	}
+
+	bool CompileFile(lua_State* L, const char* path, std::string& chunk)
+	{
+		if (luaL_loadfilex(L, path, "t") != LUA_OK) {
+			LOG_ERR("[Lua Error] %s", lua_tostring(L, -1));
+			lua_pop(L, 1);
+			return false;
+		}
+
+		lua_dump(L, WriteChunk, &chunk, 0);
+		lua_pop(L, 1);
+		return true;
+	}
+
+	bool RunChunk(lua_State* L, const std::string& chunk, const char* name)
+	{
+		if ((luaL_loadbufferx(L, chunk.data(), chunk.size(), name, "b") != LUA_OK) or (lua_pcall(L, 0, 0, 0) != LUA_OK)) {
+			LOG_ERR("[Lua Error] %s", lua_tostring(L, -1));
+			lua_pop(L, 1);
+			return false;
+		}
+
+		return true;
+	}
+
+	// 좌표는 Map 안, Level은 1 ~ MAX_SPAWN_LEVEL
+	bool IsValidSpawn(long long x, long long y, long long level)
+	{
+		return (x >= 0) and (x < W_WIDTH) and (y >= 0) and (y < W_HEIGHT) and (level >= 1) and (level <= MAX_SPAWN_LEVEL);
+	}
+
+	// spawnMonster(x, y, type, move, level)를 바로 Spawn하지 않고 목록에 모음
+	int CollectSpawn(lua_State* L)
+	{
+		auto spawns = static_cast<std::vector<SpawnEntry>*>(lua_touserdata(L, lua_upvalueindex(1)));
+
+		const char* typeStr = lua_tostring(L, 3);
+		const char* moveStr = lua_tostring(L, 4);
+		if ((nullptr == typeStr) or (nullptr == moveStr)) {
+			return 0;
+		}
+
+		// 범위 밖 값은 short로 잘리기 전에 확인하고 Script 오류로 처리 (Load 실패, 이전 Bundle 유지)
+		lua_Integer x = lua_tointeger(L, 1);
+		lua_Integer y = lua_tointeger(L, 2);
+		lua_Integer level = lua_tointeger(L, 5);
+		if (not IsValidSpawn(x, y, level)) {
+			return luaL_error(L, "spawnMonster(%d, %d, level %d) out of range", static_cast<int>(x), static_cast<int>(y), static_cast<int>(level));
+		}
+
+		SpawnEntry entry{};
+		entry.x = static_cast<short>(x);
+		entry.y = static_cast<short>(y);
+		entry.level = static_cast<int>(level);
+
+		if (strcmp(typeStr, "Peace") == 0) entry.monsterType = MonsterType::Peace;
+		else if (strcmp(typeStr, "Agro") == 0) entry.monsterType = MonsterType::Agro;
+		else return 0;
+
+		if (strcmp(moveStr, "Fixed") == 0) entry.movementType = MovementType::Fixed;
+		else if (strcmp(moveStr, "Roaming") == 0) entry.movementType = MovementType::Roaming;
+		else return 0;
+
+		spawns->push_back(entry);
+		return 0;
+	}
+
+	void ReadInt(lua_State* L, const char* key, int& value)
+	{
+		if (lua_getfield(L, -1, key) == LUA_TNUMBER) {
+			value = static_cast<int>(lua_tointeger(L, -1));
+		}
+		lua_pop(L, 1);
+	}
+
+	// MonsterAi = { AgroRoaming = { agroRange = 5, moveMinMs = 1000, moveMaxMs = 2000, respawnSec = 30 }, ... }
+	bool ReadAiParams(lua_State* L, std::array<MonsterAiParams, 4>& ai)
+	{
+		if (lua_getglobal(L, "MonsterAi") == LUA_TTABLE) {
+			for (int i = 0; i < 4; ++i) {
+				if (lua_getfield(L, -1, s_aiTypeNames[i]) == LUA_TTABLE) {
+					ReadInt(L, "agroRange", ai[i].agroRange);
+					ReadInt(L, "moveMinMs", ai[i].moveMinMs);
+					ReadInt(L, "moveMaxMs", ai[i].moveMaxMs);
+					ReadInt(L, "respawnSec", ai[i].respawnSec);
+				}
+				lua_pop(L, 1);
+			}
+		}
+		lua_pop(L, 1);
+
+		for (int i = 0; i < 4; ++i) {
+			const MonsterAiParams& params = ai[i];
+			if ((params.agroRange < 0) or (params.moveMinMs <= 0) or (params.moveMaxMs < params.moveMinMs) or (params.respawnSec <= 0)) {
+				LOG_ERR("[Lua Error] MonsterAi.%s has invalid values", s_aiTypeNames[i]);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// spawnMonster 호출을 목록으로 모으는 Lua 실행 (Server 시작 / --compile-spawns 공용)
+	bool RunSpawnScript(lua_State* L, const char* path, std::vector<SpawnEntry>& spawns)
+	{
+		std::string chunk;
+		if (not CompileFile(L, path, chunk)) {
+			return false;
+		}
+
+		lua_pushlightuserdata(L, &spawns);
+		lua_pushcclosure(L, CollectSpawn, 1);
+		lua_setglobal(L, "spawnMonster");
+
+		return RunChunk(L, chunk, path);
+	}
+
+	bool ParseSpawnTable(const char* data, long long size, std::vector<SpawnEntry>& spawns)
+	{
+		if (size < static_cast<long long>(sizeof(SpawnTableHeader))) {
+			return false;
+		}
+
+		SpawnTableHeader header;
+		std::memcpy(&header, data, sizeof(header));
+		if ((std::memcmp(header.magic, SPAWN_TABLE_MAGIC, sizeof(header.magic)) != 0) or (header.version != SPAWN_TABLE_VERSION)) {
+			return false;
+		}
+
+		if (size != static_cast<long long>(sizeof(SpawnTableHeader) + sizeof(SpawnTableRecord) * header.count)) {
+			return false;
+		}
+
+		// 고정 크기 Record를 그대로 변환 (문자열 비교 없음)
+		const SpawnTableRecord* records = reinterpret_cast<const SpawnTableRecord*>(data + sizeof(SpawnTableHeader));
+		spawns.resize(header.count);
+		for (unsigned int i = 0; i < header.count; ++i) {
+			const SpawnTableRecord& record = records[i];
+			if ((record.monsterType > MonsterType::Agro) or (record.movementType > MovementType::Roaming)
+				or (not IsValidSpawn(record.x, record.y, record.level))) {
+				LOG_ERR("Spawn table record %u invalid (%d, %d) level %d", i, record.x, record.y, record.level);
+				return false;
+			}
+
+			spawns[i] = SpawnEntry{ record.x, record.y,
+				static_cast<MonsterType>(record.monsterType), static_cast<MovementType>(record.movementType), record.level };
+		}
+
+		return true;
+	}
+
+	bool MapSpawnTable(const char* path, std::vector<SpawnEntry>& spawns)
+	{
+		HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (INVALID_HANDLE_VALUE == file) {
+			LOG_ERR("Spawn table open failed: %s (%u)", path, ::GetLastError());
+			return false;
+		}
+
+		LARGE_INTEGER size{};
+		::GetFileSizeEx(file, &size);
+
+		HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		const void* view = (nullptr != mapping) ? ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+		bool result = (nullptr != view) and ParseSpawnTable(static_cast<const char*>(view), size.QuadPart, spawns);
+		if (not result) {
+			LOG_ERR("Spawn table invalid: %s", path);
+		}
+
+		if (nullptr != view) ::UnmapViewOfFile(view);
+		if (nullptr != mapping) ::CloseHandle(mapping);
+		::CloseHandle(file);
+
+		return result;
+	}
+
+	// Binary가 있고 Lua Script보다 최신일 때만 사용 (Script만 고치고 변환을 잊은 경우 Lua 사용)
+	bool IsSpawnTableCurrent(const char* tablePath, const char* scriptPath)
+	{
+		std::error_code ec;
+		if (not std::filesystem::exists(tablePath, ec)) {
+			return false;
+		}
+
+		if (not std::filesystem::exists(scriptPath, ec)) {
+			return true;
+		}
+
+		if (std::filesystem::last_write_time(tablePath, ec) < std::filesystem::last_write_time(scriptPath, ec)) {
+			LOG_WRN("%s is older than %s, running the script (rebuild with --compile-spawns)", tablePath, scriptPath);
+			return false;
+		}
+
+		return true;
+	}
+}
+
+bool ScriptManager::CompileSpawnTable(const std::string& scriptPath, const std::string& tablePath)
+{
+	// 1. Lua 실행해서 Spawn 목록 수집
+	std::vector<SpawnEntry> spawns;
+	{
+		LuaStatePtr state{ luaL_newstate(), &lua_close };
+		luaL_openlibs(state.get());
+
+		if (not RunSpawnScript(state.get(), scriptPath.c_str(), spawns)) {
+			return false;
+		}
+	}
+
+	// 2. Header + Record 배열
+	SpawnTableHeader header{};
+	std::memcpy(header.magic, SPAWN_TABLE_MAGIC, sizeof(header.magic));
+	header.version = SPAWN_TABLE_VERSION;
+	header.count = static_cast<unsigned int>(spawns.size());
+
+	std::vector<SpawnTableRecord> records;
+	records.reserve(spawns.size());
+	for (const SpawnEntry& spawn : spawns) {
+		records.push_back(SpawnTableRecord{ spawn.x, spawn.y,
+			static_cast<unsigned char>(spawn.monsterType), static_cast<unsigned char>(spawn.movementType), static_cast<short>(spawn.level) });
+	}
+
+	// 3. 임시 파일에 쓴 뒤 교체
+	std::string tempPath = tablePath + ".tmp";
+	{
+		std::ofstream ofs{ tempPath, std::ios::binary | std::ios::trunc };
+		if (not ofs) {
+			LOG_ERR("Spawn table open failed: %s", tempPath);
+			return false;
+		}
+
+		ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		ofs.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(SpawnTableRecord));
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tempPath, tablePath, ec);
+	if (ec) {
+		LOG_ERR("Spawn table rename failed: %s", ec.message());
+		return false;
+	}
+
+	LOG_INF("Spawn table written: %s (%zu spawns)", tablePath, spawns.size());
+	return true;
+}
+
+bool ScriptManager::Load()
+{
+	// 1. 새 Bundle은 임시 Lua State에서 만들고, 다 만들어진 뒤에만 교체
+	auto bundle = std::make_shared<ScriptBundle>();
+
+	LuaStatePtr state{ luaL_newstate(), &lua_close };
+	lua_State* L = state.get();
+	luaL_openlibs(L);
+
+	// 2. Spawn Table : 변환해둔 Binary가 최신이면 Memory Map으로 읽고, 아니면 Lua 실행
+	if (IsSpawnTableCurrent(SPAWN_TABLE, SPAWN_SCRIPT)) {
+		if (not MapSpawnTable(SPAWN_TABLE, bundle->spawns)) {
+			return false;
+		}
+	}
+
+	else if (not RunSpawnScript(L, SPAWN_SCRIPT, bundle->spawns)) {
+		return false;
+	}
+
+	// 3. AI Script (선택). 값은 C++ 쪽에 복사하고, ShouldChase Hook은 Worker State에서 호출
+	if (std::filesystem::exists(AI_SCRIPT)) {
+		if ((not CompileFile(L, AI_SCRIPT, bundle->aiChunk)) or (not RunChunk(L, bundle->aiChunk, AI_SCRIPT))) {
+			return false;
+		}
+
+		if (not ReadAiParams(L, bundle->ai)) {
+			return false;
+		}
+
+		bundle->hasChaseHook = (lua_getglobal(L, "ShouldChase") == LUA_TFUNCTION);
+		lua_pop(L, 1);
+	}
+
+	// 4. 교체
+	bundle->version = _nextVersion.fetch_add(1);
+	_bundle.store(bundle);
+	_bundleVersion.store(bundle->version);
+
+	LOG_INF("Scripts loaded (version %u, %zu spawns, chase hook %d)", bundle->version, bundle->spawns.size(), bundle->hasChaseHook);
+	return true;
+}
+
+const ScriptBundle& ScriptManager::GetCachedBundle() const
+{
+	// atomic<shared_ptr>::load는 내부 Lock과 참조 Count 증감이 있으므로 version이 같으면 건너뜀
+	CachedBundle& cached = t_cachedBundle;
+	if ((nullptr == cached.bundle) or (cached.version != _bundleVersion.load())) {
+		cached.bundle = _bundle.load();
+		cached.version = cached.bundle->version;
+	}
+
+	return *cached.bundle;
+}
+
+bool ScriptManager::ShouldChase(const ScriptBundle& bundle, int typeId, int level, int dx, int dy, bool& chase)
+{
+	lua_State* L = GetWorkerState(bundle);
+	if (nullptr == L) {
+		return false;
+	}
+
+	lua_getglobal(L, "ShouldChase");
+	lua_pushinteger(L, typeId);
+	lua_pushinteger(L, level);
+	lua_pushinteger(L, dx);
+	lua_pushinteger(L, dy);
+
+	if (lua_pcall(L, 4, 1, 0) != LUA_OK) {
+		LOG_ERR("[Lua Error] %s", lua_tostring(L, -1));
+		lua_pop(L, 1);
+		return false;
+	}
+
+	chase = lua_toboolean(L, -1);
+	lua_pop(L, 1);
+	return true;
+}
+
+lua_State* ScriptManager::GetWorkerState(const ScriptBundle& bundle)
+{
+	WorkerLuaState& state = t_luaState;
+	if (state.version == bundle.version) {
+		return state.L;
+	}
+
+	// Bundle이 바뀌었으면 새 State에 미리 Compile한 Chunk만 실행 (실패해도 같은 version은 다시 시도하지 않음)
+	if (nullptr != state.L) {
+		lua_close(state.L);
+	}
+
+	state.version = bundle.version;
+	state.L = luaL_newstate();
+	luaL_openlibs(state.L);
+
+	if (not RunChunk(state.L, bundle.aiChunk, AI_SCRIPT)) {
+		lua_close(state.L);
+		state.L = nullptr;
+	}
+
+	return state.L;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+struct lua_State;
+
+// Monster::SetLevel의 hp(level * 20)가 short를 넘지 않는 범위
+constexpr int MAX_SPAWN_LEVEL = 1000;
+
+// monster_spawn.lua의 spawnMonster(x, y, type, move, level) 한 번
+struct SpawnEntry {
+	short x;
+	short y;
+	MonsterType monsterType;
+	MovementType movementType;
+	int level;
+};
+
+// Monster 종류별 AI 값. monster_ai.lua의 MonsterAi 표에 없는 값은 기본값
+struct MonsterAiParams {
+	int agroRange{ 5 };
+	int moveMinMs{ 1000 };
+	int moveMaxMs{ 2000 };
+	int respawnSec{ 30 };
+};
+
+// 한 번 Load한 Script 묶음. 만든 뒤에는 바뀌지 않으므로 여러 Thread가 Lock 없이 읽음
+struct ScriptBundle {
+	unsigned int version{ 0 };
+
+	// monster_ai.lua를 미리 Compile한 Bytecode. Worker Lua State는 Parse 없이 바로 Load
+	std::string aiChunk;
+
+	std::vector<SpawnEntry> spawns;
+	std::array<MonsterAiParams, 4> ai;		// [Monster typeId - 1]
+	bool hasChaseHook{ false };
+
+	const MonsterAiParams& GetAi(int typeId) const { return ai[std::clamp(typeId, 1, 4) - 1]; }
+};
+
+// Spawn Table / AI Script를 Load해서 Bundle로 만들고 통째로 교체
+// Reload는 새 Bundle을 다 만든 뒤에 교체하므로 Worker는 이전 Bundle 또는 새 Bundle 하나만 봄
+class ScriptManager
+{
+public:
+	static constexpr const char* SPAWN_SCRIPT{ "monster_spawn.lua" };
+	static constexpr const char* SPAWN_TABLE{ "monster_spawn.bin" };	// SPAWN_SCRIPT보다 최신이면 대신 사용
+	static constexpr const char* AI_SCRIPT{ "monster_ai.lua" };		// 없으면 기본 AI 값
+
+public:
+	// 실패하면 이전 Bundle 유지
+	bool Load();
+
+	// Spawn Script를 실행해서 Binary Spawn Table로 저장 (Offline 변환, GameServer.exe --compile-spawns)
+	static bool CompileSpawnTable(const std::string& scriptPath, const std::string& tablePath);
+
+	std::shared_ptr<const ScriptBundle> GetBundle() const { return _bundle.load(); }
+
+	// Monster 이동 / Timer 같은 Hot Path용. Thread마다 Bundle을 들고 있다가 version이 바뀌었을 때만 다시 load
+	// 같은 Thread에서 다음 GetCachedBundle을 부르기 전까지만 유효
+	const ScriptBundle& GetCachedBundle() const;
+
+	// monster_ai.lua의 ShouldChase(typeId, level, dx, dy)를 호출 Thread의 Lua State에서 실행
+	// Script 오류면 false를 돌려주고 chase는 그대로 둠
+	bool ShouldChase(const ScriptBundle& bundle, int typeId, int level, int dx, int dy, bool& chase);
+
+private:
+	// Thread마다 하나씩 유지하고 Bundle version이 바뀌었을 때만 다시 만듦
+	lua_State* GetWorkerState(const ScriptBundle& bundle);
+
+private:
+	std::atomic<std::shared_ptr<const ScriptBundle>> _bundle;
+	std::atomic<unsigned int> _bundleVersion{ 0 };	// _bundle 교체 뒤에 갱신. Worker는 이 값만 보고 Cache를 확인
+
+	// Worker State가 어느 Bundle로 만들어졌는지 구분하므로 Process 전체에서 유일
+	static inline std::atomic<unsigned int> _nextVersion{ 1 };
+};
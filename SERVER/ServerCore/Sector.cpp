@@ -7,6 +7,13 @@ void Sector::AddObject(int id)
 	_objects.insert(id);
 }
 
+void Sector::AddObjects(const std::vector<int>& ids)
+{
+	std::unique_lock lock{ _mutex };
+	_objects.reserve(_objects.size() + ids.size());
+	_objects.insert(ids.begin(), ids.end());
+}
+
 void Sector::RemoveObject(int id)
 {
 	std::unique_lock lock{ _mutex };
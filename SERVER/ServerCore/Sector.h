@@ -3,11 +3,13 @@
 constexpr int MAP_SIZE = 2000;
 constexpr int SECTOR_SIZE = 20;
 constexpr int SECTOR_COUNT = MAP_SIZE / SECTOR_SIZE;
+constexpr int VIEW_RANGE = 7;
 
 class Sector
 {
 public:
 	void AddObject(int id);
+	void AddObjects(const std::vector<int>& ids);
 	void RemoveObject(int id);
 	void CollectObject(std::unordered_set<int>& out) const;
 
@@ -5,7 +5,7 @@
 #include "ObjectManager.h"
 
 Service::Service(std::shared_ptr<IocpCore> core, int maxSessionCount)
-	: _iocpCore(core)
+	: _iocpCore(core), _flushIntervalMs(PlayerCache::DEFAULT_FLUSH_INTERVAL_MS)
 {
 	for (auto& row : _navigationMap) {
 		row.fill(true);
@@ -29,17 +29,47 @@ bool Service::Start(std::string_view database, const std::string& map)
 		return false;
 	}
 
-	// 2. Monster Initialize / Monster Timer Thread Start
+	// 2. Monster Initialize / Region Thread, Monster Timer Thread Start
 	InitNpcs(MAX_NPC);
+	_viewManager->GetRegionManager().Start();
 	StartNpcTimerThread();
 
 	LoadMap(map);
 
-	// 3. QuestManager, DBManager Init
+	// 3. QuestManager, Storage Init
 	_questManager->Init();
-	_dbManager->Init(std::wstring().assign(database.begin(), database.end()));
+
+	_storage = CreateStorage(database);
+	if ((nullptr == _storage) or (not _storage->Init(std::string(StripStoragePrefix(database))))) {
+		LOG_ERR("Storage Init failed");
+		return false;
+	}
+
+	_dbExecutor = std::make_shared<DBExecutor>(_storage);
+	_playerCache = std::make_shared<PlayerCache>(_storage, _dbExecutor);
+
+	_dbExecutor->Start();
+	_playerCache->Start(_flushIntervalMs, [this]()
+		{
+			CapturePlayerStates();
+			LogStorageStats();
+		});
+
+	// 3-1. Packet Trace 기록 (Accept 전에 열어야 첫 Login부터 기록)
+	if (not _packetTracePath.empty()) {
+		_packetRecorder = std::make_unique<PacketRecorder>();
+		if (not _packetRecorder->Open(_packetTracePath)) {
+			_packetRecorder.reset();
+		}
+	}
 
 	// 4. Listener에서 Accept 시작
+	// Zone Server는 GZ_HANDOFF_IN으로 Login 없이 상태를 받으므로 Gateway 확인 없이는 열지 않음
+	if ((_zoneCount > 1) and _zoneSecret.empty()) {
+		LOG_ERR("Zone server needs %s", ZONE_SECRET_ENV);
+		return false;
+	}
+
 	if (_listener == nullptr) {
 		LOG_ERR("Listener allocation failed");
 		return false;
@@ -51,12 +81,21 @@ bool Service::Start(std::string_view database, const std::string& map)
 	}
 
 	// 5. Worker Thread Start
-	unsigned int threadCount = std::thread::hardware_concurrency();
-	_workers.reserve(threadCount);
-	for (unsigned int i = 0; i < threadCount; ++i) {
-		_workers.emplace_back([this]()
+	// I/O Thread는 Completion만 받아서 Job으로 넘기고, Game Logic은 Job Worker가 처리
+	unsigned int threadCount = std::max<unsigned int>(2, std::thread::hardware_concurrency());
+	unsigned int ioThreadCount = std::max<unsigned int>(1, threadCount / 4);
+
+	_jobScheduler->Start(threadCount - ioThreadCount);
+
+	_workers.reserve(ioThreadCount);
+	for (unsigned int i = 0; i < ioThreadCount; ++i) {
+		_workers.emplace_back([this, i]()
 			{
+				Profiler::SetThreadName("IOCP Worker " + std::to_string(i));
+				Watchdog::RegisterWorker("IOCP Worker " + std::to_string(i));
+
 				while (_running.load()) {
+					Watchdog::Idle();
 					if (not _iocpCore->Dispatch()) {
 						int error = WSAGetLastError();
 
@@ -72,18 +111,98 @@ bool Service::Start(std::string_view database, const std::string& map)
 						break;
 					}
 				}
+
+				Watchdog::UnregisterWorker();
 			});
 	}
 
+	// 6. Metrics Gauge 등록, 주기적으로 파일에 Snapshot 기록
+	Metrics::AddGaugeProvider([this](MetricGauges& gauges) { CollectMetricGauges(gauges); });
+	Metrics::StartDump("metrics_zone" + std::to_string(_zoneId) + ".json");
+
+	// 7. Watchdog 시작 (Timer 지연, Worker Heartbeat, Queue 길이 감시)
+	Watchdog::Start("watchdog_zone" + std::to_string(_zoneId) + ".log", WatchdogConfig{},
+		[this](MetricGauges& queues) { CollectQueueDepths(queues); });
+
 	return true;
 }
 
+bool Service::StartSimulation(const std::shared_ptr<IStorage>& storage, const std::string& map)
+{
+	LOG_INF("Start Service (simulation)");
+
+	// 0. running Flag 설정
+	_running.store(true);
+
+	// 1. WinSock 초기화 (Socket은 만들지 않지만 Session 생성자가 WSASocket 호출)
+	WSADATA WSAData;
+	if (WSAStartup(MAKEWORD(2, 2), &WSAData) != 0) {
+		LOG_ERR("WSAStartup Error");
+		return false;
+	}
+
+	// 2. Monster Initialize. Region / Timer Thread는 띄우지 않고 RunSimulation에서 실행
+	InitNpcs(MAX_NPC);
+	LoadMap(map);
+
+	// 3. QuestManager, Storage Init
+	_questManager->Init();
+
+	_storage = storage;
+	if ((nullptr == _storage) or (not _storage->Init(""))) {
+		LOG_ERR("Storage Init failed");
+		return false;
+	}
+
+	// PlayerCache Flusher는 별도 Thread에서 Strand로 Job을 넣으므로 시작하지 않음
+	_dbExecutor = std::make_shared<DBExecutor>(_storage);
+	_playerCache = std::make_shared<PlayerCache>(_storage, _dbExecutor);
+
+	_dbExecutor->StartManual();
+	_jobScheduler->StartManual();
+
+	return true;
+}
+
+std::shared_ptr<GameSession> Service::CreateSimulationSession(std::function<void(const std::vector<char>&)> sink)
+{
+	auto session = std::make_shared<GameSession>();
+
+	session->SetService(shared_from_this());
+	session->SetInventory(std::make_shared<Inventory>(session));
+	session->SetSendSink(std::move(sink));
+
+	return session;
+}
+
+size_t Service::RunSimulation()
+{
+	// Job이 다른 단계의 작업을 만들 수 있으므로 한 바퀴 동안 아무것도 실행하지 않을 때까지 반복
+	size_t total{ 0 };
+	while (true) {
+		size_t executed = static_cast<size_t>(ProcessTimers());
+		executed += _dbExecutor->RunPending();
+		executed += _jobScheduler->RunPending();
+		executed += _viewManager->GetRegionManager().RunPending();
+
+		if (0 == executed) {
+			break;
+		}
+		total += executed;
+	}
+
+	return total;
+}
+
 void Service::CloseService()
 {
-	// 0) _running Flag 설정
+	// 0) _running Flag 설정, Metrics Dump / Watchdog 종료 (Provider가 Service 내부를 참조)
 	_running.store(false);
 
-	_dbManager->Shutdown();
+	Watchdog::Stop();
+	Metrics::StopDump();
+	Metrics::ClearGaugeProviders();
+	Profiler::StopCapture();
 
 	// 1) Accept 종료
 	_listener->StopAccept();
@@ -105,6 +224,29 @@ void Service::CloseService()
 		_npcTimerThread.join();
 	}
 
+	// 3-1) Region Thread, Job Worker 종료. 더 이상 Packet을 처리하지 않으므로 Trace도 닫음
+	_viewManager->GetRegionManager().Stop();
+	_jobScheduler->Stop();
+
+	if (_packetRecorder) {
+		_packetRecorder->Close();
+	}
+
+	// 3-2) Strand가 모두 멈췄으므로 접속 중인 Player 상태를 직접 Cache에 반영 후 Flush
+	{
+		std::shared_lock lock{ _inGameUsersMutex };
+		for (auto& [userId, weakSession] : _inGameUsers) {
+			if (auto session = weakSession.lock()) {
+				SavePlayerState(session);
+			}
+		}
+	}
+	_playerCache->Stop();
+
+	// 3-3) 남은 DB 요청 처리 후 DB Thread 종료
+	_dbExecutor->Stop();
+	_storage->Shutdown();
+
 	// 4) Session 정리
 	_objectManager->ForEachPlayer(
 		[&](const std::shared_ptr<GameSession>& session)
@@ -136,18 +278,29 @@ int Service::AddObject(const std::shared_ptr<GameObject> object)
 
 void Service::ReleaseSession(const std::shared_ptr<GameSession>& session)
 {
+	// viewList는 Session Strand에서만 접근하므로 Strand 밖에서 불리면 넘겨서 처리
+	if (not session->IsInStrand()) {
+		session->Post([self = shared_from_this(), session]() { self->ReleaseSession(session); });
+		return;
+	}
+
 	int id = session->GetId();
 
 	session->Close();
 
+	// 0. Logout 없이 끊긴 경우에도 마지막 상태 저장 (Logout / Handoff로 이미 Release된 User는 무시됨)
+	if (session->GetUserID() != -1) {
+		SavePlayerState(session);
+		_playerCache->Release(session->GetUserID());
+	}
+
 	// 1. viewList 동기화
-	std::unordered_set<int> viewList = *(session->GetViewList());
+	const std::unordered_set<int>& viewList = session->GetViewList();
 
 	for (int objId : viewList) {
 		auto object = FindObject(objId);
-		if (object->GetType() == ObjectType::PLAYER) {
+		if ((nullptr != object) and (object->GetType() == ObjectType::PLAYER)) {
 			auto target = static_pointer_cast<GameSession>(object);
-			if (nullptr == target) continue;
 
 			auto packetForTarget = PacketFactory::BuildRemovePacket(*session);
 			target->Send(packetForTarget);
@@ -175,20 +328,15 @@ void Service::ReleaseSession(const std::shared_ptr<GameSession>& session)
 
 void Service::InitNpcs(int npcCount)
 {
-	lua_State* L = luaL_newstate();
-	luaL_openlibs(L);
-
-	lua_pushlightuserdata(L, this);
-	lua_pushcclosure(L, Lua_SpawnMonster_Wrapper, 1);
-	lua_setglobal(L, "spawnMonster");
-
-	if (luaL_dofile(L, "monster_spawn.lua") != LUA_OK) {
-		const char* err = lua_tostring(L, -1);
-		LOG_ERR("[Lua Error] %s", err);
+	if (not _scriptManager->Load()) {
+		LOG_ERR("Monster spawn script load failed");
 		return;
 	}
 
-	lua_close(L);
+	{
+		std::lock_guard lock{ _spawnLock };
+		SpawnMonsters(_scriptManager->GetBundle()->spawns);
+	}
 
 	std::string NPCname = "NPC" + std::to_string(1);
 	auto npc = std::make_shared<Npc>(-1, 1000, 1000, NPCname);
@@ -202,55 +350,95 @@ void Service::StartNpcTimerThread()
 
 	_npcTimerThread = std::thread([this]()
 		{
+			Profiler::SetThreadName("Timer");
+			Watchdog::RegisterWorker("Timer");
+
 			while (_running.load()) {
-				Event event;
-				while (_timerQueue.try_pop(event)) {
-					auto now = high_resolution_clock::now();
-					if (event.wakeupTime > now) {
-						_timerQueue.push(event);
-						break;
-					}
+				Watchdog::Heartbeat();
+				ProcessTimers();
+				std::this_thread::sleep_for(1ms);
+			}
 
-					OperationType opType;
-					switch (event.eventId) {
-					case EV_MOVE:			opType = NpcMove; break;
-					case EV_HEAL:			opType = NpcHeal; break;
-					case EV_ATTACK:			opType = NpcAttack; break;
-					case EV_PLAYER_HEAL:	opType = Heal; break;
-					case EV_PLAYER_RESPAWN:	opType = Respawn; break;
-					default: continue;
-					}
+			Watchdog::UnregisterWorker();
+		});
+}
 
-					EventOver* eventOver = new EventOver(opType, event.objId);
-					
-					auto object = FindObject(event.objId);
-					if (object->GetType() == ObjectType::PLAYER) {
-						if (auto player = static_pointer_cast<GameSession>(FindObject(event.objId))) {
-							eventOver->_owner = player;
-						}
+int Service::ProcessTimers()
+{
+	PROFILE_ZONE("Service::ProcessTimers");
 
-						else {
-							delete eventOver;
-							continue;
-						}
-					}
-					
-					else {
-						if (auto npc = static_pointer_cast<Monster>(FindObject(event.objId))) {
-							eventOver->_owner = npc;
-						}
+	using namespace std::chrono;
 
-						else {
-							delete eventOver;
-							continue;
-						}
-					}
-			
-					PostQueuedCompletionStatus(_iocpCore->GetHandle(), 0, event.objId, reinterpret_cast<LPOVERLAPPED>(eventOver));
-				}
-				std::this_thread::sleep_for(1ms);
-			}
-		});
+	int processed{ 0 };
+
+	Event event;
+	while (_timerQueue.try_pop(event)) {
+		auto now = GameClock::Now();
+		if (event.wakeupTime > now) {
+			_timerQueue.push(event);
+			break;
+		}
+
+		long long lagUs = duration_cast<microseconds>(now - event.wakeupTime).count();
+		Metrics::Record(METRIC_TIMER_LAG_US, lagUs);
+		Watchdog::RecordTimerLag(lagUs);
+
+		// Sector 단위 NPC Tick은 objId에 Sector Index가 들어있고, 해당 Sector를 소유한 Region Thread에서 실행
+		if (event.eventId == EV_NPC_TICK) {
+			int sx = event.objId / SECTOR_COUNT;
+			int sy = event.objId % SECTOR_COUNT;
+
+			_viewManager->GetRegionManager().Post(sx, sy, [npcSystem = _npcSystem, sectorIndex = event.objId]()
+				{
+					npcSystem->TickSector(sectorIndex);
+				});
+			++processed;
+			continue;
+		}
+
+		OperationType opType;
+		switch (event.eventId) {
+		case EV_HEAL:			opType = NpcHeal; break;
+		case EV_ATTACK:			opType = NpcAttack; break;
+		case EV_PLAYER_HEAL:	opType = Heal; break;
+		case EV_PLAYER_RESPAWN:	opType = Respawn; break;
+		default: continue;
+		}
+
+		EventOver* eventOver = new EventOver(opType, event.objId);
+		
+		// Logout / Spawn Table에서 빠져서 이미 없어진 Object의 Timer는 버림
+		auto object = FindObject(event.objId);
+		if (nullptr == object) {
+			delete eventOver;
+			continue;
+		}
+
+		if (object->GetType() == ObjectType::PLAYER) {
+			eventOver->_owner = static_pointer_cast<GameSession>(object);
+		}
+		
+		else {
+			eventOver->_owner = static_pointer_cast<Monster>(object);
+		}
+
+		// Player Timer Event는 Session Strand로, Monster는 바로 Job으로 실행
+		if (object->GetType() == ObjectType::PLAYER) {
+			auto player = static_pointer_cast<GameSession>(object);
+			player->Post([player, eventOver]() { player->Dispatch(eventOver); });
+		}
+
+		else {
+			_jobScheduler->Push([eventOver]()
+				{
+					std::shared_ptr<IocpObject> owner = eventOver->_owner;
+					owner->Dispatch(eventOver);
+				});
+		}
+		++processed;
+	}
+
+	return processed;
 }
 
 void Service::LoadMap(const std::string& filename)
@@ -296,22 +484,36 @@ void Service::LoadMap(const std::string& filename)
 
 void Service::OnPlayerLogin(const std::shared_ptr<GameSession>& session)
 {
+	PROFILE_ZONE("Service::OnPlayerLogin");
+
 	_viewManager->HandlePlayerLoginNotify(session);
 }
 
 void Service::OnPlayerMove(const std::shared_ptr<GameSession>& session)
 {
+	PROFILE_ZONE("Service::OnPlayerMove");
+
 	_viewManager->HandlePlayerMoveNotify(session);
-	_combatManager->HandlePlayerMove(session);
+
+	// 같은 Tile의 Monster 검색은 Region Mirror를 읽으므로 Player가 있는 Sector의 소유 Region에서
+	auto [sx, sy] = Sector::GetSector(session->GetX(), session->GetY());
+	_viewManager->GetRegionManager().Run(sx, sy, [combatManager = _combatManager, session]()
+		{
+			combatManager->HandlePlayerMove(session);
+		});
 }
 
 void Service::OnPlayerDeath(const std::shared_ptr<GameSession>& session)
 {
+	PROFILE_ZONE("Service::OnPlayerDeath");
+
 	_viewManager->HandlePlayerDeathNotify(session);
 }
 
 void Service::OnPlayerRevive(const std::shared_ptr<GameSession>& session)
 {
+	PROFILE_ZONE("Service::OnPlayerRevive");
+
 	// temp : 성능 테스트 할 때 부활 장소가 고정되어 있으니까 너무 빡셈
 	/*while (true) {
 		short x = rand() % 2000;
@@ -329,21 +531,39 @@ void Service::OnPlayerRevive(const std::shared_ptr<GameSession>& session)
 
 void Service::OnNpcMove(const std::shared_ptr<Monster>& npc, int oldX, int oldY)
 {
-	_viewManager->HandleNpcMove(npc, oldX, oldY);
-	_combatManager->HandleMonsterMove(npc);
+	PROFILE_ZONE("Service::OnNpcMove");
+
+	// NPC Tick은 이동 전 Sector를 소유한 Region Thread에서 실행되므로 보통 바로 실행
+	auto [sx, sy] = Sector::GetSector(oldX, oldY);
+	_viewManager->GetRegionManager().Run(sx, sy, [this, npc, oldX, oldY]()
+		{
+			_viewManager->HandleNpcMove(npc, oldX, oldY);
+			_combatManager->HandleMonsterMove(npc);
+		});
 }
 
 void Service::OnNpcDeath(const std::shared_ptr<Monster>& monster, const std::shared_ptr<GameSession>& killer)
 {
+	PROFILE_ZONE("Service::OnNpcDeath");
+
 	_viewManager->HandleNpcDeath(monster);
 	_questManager->HandleEvent(killer, KillMonster, monster->GetTypeId());
 }
 
 void Service::OnNpcRevive(const std::shared_ptr<Monster>& npc)
 {
+	PROFILE_ZONE("Service::OnNpcRevive");
+
 	_viewManager->HandleNpcRevive(npc);
 }
 
+void Service::OnNpcRetire(const std::shared_ptr<Monster>& npc)
+{
+	// Timer Event가 Id로 NPC를 찾으므로 Id는 재사용하지 않음
+	_objectManager->RemoveObject(npc);
+	LOG_INF("Monster %d despawned (removed from spawn table)", npc->GetId());
+}
+
 void Service::EnterSector(const std::shared_ptr<GameObject>& object)
 {
 	_viewManager->EnterSector(object);
@@ -364,18 +584,249 @@ void Service::LeaveSector(const std::shared_ptr<GameObject>& object, int sx, int
 	_viewManager->LeaveSector(object, sx, sy);
 }
 
-std::unordered_set<int> Service::CollectVisibleObjects(const std::shared_ptr<GameObject>& object) const
+std::unordered_set<int> Service::CollectRegionViewList(int selfId, int x, int y) const
+{
+	return _viewManager->CollectRegionViewList(selfId, x, y);
+}
+
+std::unordered_set<int> Service::CollectRegionObjects(int sx, int sy, int radius) const
+{
+	return _viewManager->CollectRegionObjects(sx, sy, radius);
+}
+
+void Service::SetZone(int zoneId, int zoneCount)
+{
+	_zoneCount = std::clamp(zoneCount, 1, MAX_ZONE_COUNT);
+	_zoneId = std::clamp(zoneId, 0, _zoneCount - 1);
+
+	LOG_INF("Zone %d / %d, listen port %u", _zoneId, _zoneCount, GetListenPort());
+}
+
+void Service::SetZoneGateway(const std::string& secret, const std::string& bindAddress)
+{
+	_zoneSecret = secret;
+	_listenAddress = bindAddress;
+}
+
+unsigned short Service::GetListenPort() const
+{
+	// 단일 Process면 Client가 직접 붙는 기존 Port, Zone 분할이면 Gateway 뒤의 Local Port
+	if (_zoneCount <= 1) {
+		return SERVER_PORT;
+	}
+
+	return static_cast<unsigned short>(ZONE_BASE_PORT + _zoneId);
+}
+
+bool Service::CheckZoneHandoff(const std::shared_ptr<GameSession>& session)
+{
+	if (_zoneCount <= 1) {
+		return false;
+	}
+
+	int targetZone = GetZoneOf(session->GetX(), _zoneCount);
+	if (targetZone == _zoneId) {
+		return false;
+	}
+
+	return HandoffOut(session, targetZone);
+}
+
+bool Service::HandoffOut(const std::shared_ptr<GameSession>& session, int targetZone)
+{
+	// 1. 이미 넘긴 Session이면 무시
+	if (not session->TryBeginHandoff()) {
+		return false;
+	}
+
+	// 2. Player 상태 Snapshot
+	HandoffState state{};
+	UserData userData = session->GetUserInfo();
+
+	state.userId = userData.id;
+	strcpy_s(state.name, NAME_SIZE, session->GetName().c_str());
+	state.level = userData.level;
+	state.exp = userData.exp;
+	state.hp = userData.hp;
+	state.maxHp = userData.maxHp;
+	state.x = userData.x;
+	state.y = userData.y;
+	state.partyId = userData.partyId;
+
+	auto quests = _questManager->GetUserQuestData(session->GetId());
+	if (quests.size() > MAX_HANDOFF_QUESTS) {
+		LOG_WRN("User[%d] has %zu quests, only %d handed off", userData.id, quests.size(), MAX_HANDOFF_QUESTS);
+	}
+
+	for (const QuestData& quest : quests) {
+		if (state.questCount >= MAX_HANDOFF_QUESTS) break;
+		state.quests[state.questCount++] = HandoffQuest{ quest.questId, quest.progress };
+	}
+
+	auto items = session->GetInventory()->GetItems();
+	if (items.size() > MAX_HANDOFF_ITEMS) {
+		LOG_WRN("User[%d] has %zu item kinds, only %d handed off", userData.id, items.size(), MAX_HANDOFF_ITEMS);
+	}
+
+	for (const auto& [itemId, count] : items) {
+		if (state.itemCount >= MAX_HANDOFF_ITEMS) break;
+		state.items[state.itemCount++] = HandoffItem{ itemId, count };
+	}
+
+	// 3. 이 Zone의 접속 목록에서 제거, 다음 Zone이 덮어쓰기 전에 이 Zone의 변경을 먼저 기록
+	{
+		std::unique_lock lock{ _inGameUsersMutex };
+		_inGameUsers.erase(userData.id);
+	}
+
+	SavePlayerState(session);
+	_playerCache->Release(userData.id);
+
+	// 4. Gateway로 전송, Gateway가 이 연결을 닫으면 ReleaseSession에서 World 정리
+	session->Send(PacketFactory::BuildHandoffPacket(static_cast<char>(targetZone), state));
+
+	LOG_INF("User[%d] handoff zone %d -> %d", userData.id, _zoneId, targetZone);
+	return true;
+}
+
+bool Service::OnHandedOffPacket(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
+{
+	PROFILE_ZONE("Service::OnHandedOffPacket");
+
+	unsigned char type = static_cast<unsigned char>(packet[1]);
+
+	// 1. Gateway가 이 연결로 보내는 마지막 Packet. 앞에서 돌려보낸 Packet이 전부임을 알림
+	if (GZ_HANDOFF_DRAIN == type) {
+		if (packet.size() != sizeof(GZ_HANDOFF_DRAIN_PACKET)) {
+			LOG_WRN("Session[%d] handoff drain size error", session->GetId());
+			return false;
+		}
+
+		session->Send(PacketFactory::BuildHandoffDonePacket());
+		return true;
+	}
+
+	if (type >= ZONE_PACKET_BEGIN) {
+		LOG_WRN("Session[%d] zone packet %d after handoff", session->GetId(), type);
+		return false;
+	}
+
+	// 2. ZG_HANDOFF 전에 Gateway가 보냈지만 아직 처리하지 않은 Client Packet, 새 Zone이 처리하도록 돌려보냄
+	if (packet.size() > MAX_REPLAY_PACKET_SIZE) {
+		LOG_WRN("Session[%d] packet %d too large to replay (%zu)", session->GetId(), type, packet.size());
+		return false;
+	}
+
+	session->Send(PacketFactory::BuildHandoffReplayPacket(packet));
+	return true;
+}
+
+void Service::PushJob(Job job)
+{
+	_jobScheduler->Push(std::move(job));
+}
+
+void Service::PostDB(int userId, Job job)
+{
+	_dbExecutor->Post(userId, std::move(job));
+}
+
+std::shared_ptr<IStorage> Service::CreateStorage(std::string_view database)
 {
-	return _viewManager->CollectVisibleObjects(object);
+	// "sqlite:<path>" 이면 SQLite, 그 외에는 ODBC DSN
+	if (database.starts_with(SQLITE_STORAGE_PREFIX)) {
+#ifdef USE_SQLITE_STORAGE
+		return std::make_shared<SqliteStorage>();
+#else
+		LOG_ERR("SQLite storage requested but server was built without USE_SQLITE_STORAGE");
+		return nullptr;
+#endif
+	}
+
+	return std::make_shared<DBManager>();
+}
+
+std::string_view Service::StripStoragePrefix(std::string_view database)
+{
+	if (database.starts_with(SQLITE_STORAGE_PREFIX)) {
+		database.remove_prefix(SQLITE_STORAGE_PREFIX.size());
+	}
+
+	return database;
 }
 
-std::unordered_set<int> Service::CollectViewList(const std::shared_ptr<GameObject>& object) const
+void Service::LogStorageStats()
 {
-	return _viewManager->CollectViewList(object);
+	// 1. DB Queue 깊이 / 대기 + 실행 시간
+	DBExecutor::Stats executor = _dbExecutor->GetStats();
+	LOG_INF("[DB] pending %lld (max %lld) executed %lld rejected %lld latency avg %lld us max %lld us",
+		executor.pending, executor.maxPending, executor.executed, executor.rejected, executor.avgLatencyUs, executor.maxLatencyUs);
+
+	// 2. ODBC 연결 Pool
+	if (auto dbManager = std::dynamic_pointer_cast<DBManager>(_storage)) {
+		DBConnectionPool::Stats pool = dbManager->GetPoolStats();
+		LOG_INF("[DB] pool %d/%d in use, waiting %d, acquire %lld timeout %lld reconnect %lld wait avg %lld us max %lld us",
+			pool.inUse, pool.poolSize, pool.waiting, pool.acquireCount, pool.timeoutCount, pool.reconnectCount, pool.avgWaitUs, pool.maxWaitUs);
+	}
+}
+
+void Service::CollectMetricGauges(MetricGauges& gauges) const
+{
+	// 1. Session State별 수
+	long long stateCounts[3]{};
+	_objectManager->ForEachPlayer(
+		[&](const std::shared_ptr<GameSession>& session)
+		{
+			++stateCounts[session->GetState()];
+		}
+	);
+
+	gauges.emplace_back("sessions.alloc", stateCounts[ST_ALLOC]);
+	gauges.emplace_back("sessions.ingame", stateCounts[ST_INGAME]);
+	gauges.emplace_back("sessions.free", stateCounts[ST_FREE]);
+
+	// 2. DB Queue
+	DBExecutor::Stats executor = _dbExecutor->GetStats();
+	gauges.emplace_back("db.pending", executor.pending);
+	gauges.emplace_back("db.rejected", executor.rejected);
+}
+
+void Service::CollectQueueDepths(MetricGauges& queues) const
+{
+	queues.emplace_back("timer", static_cast<long long>(_timerQueue.size()));
+	queues.emplace_back("jobs", _jobScheduler->GetPendingCount());
+	queues.emplace_back("regions", _viewManager->GetRegionManager().GetPendingCount());
+	queues.emplace_back("db", _dbExecutor->GetPendingCount());
+}
+
+void Service::SavePlayerState(const std::shared_ptr<GameSession>& session)
+{
+	_playerCache->UpdateUser(session->GetUserInfo(), _questManager->GetUserQuestData(session->GetId()));
+}
+
+void Service::CapturePlayerStates()
+{
+	// Flusher Thread에서 호출, Session 상태는 각 Strand에서 읽어서 Cache에 반영
+	std::shared_lock lock{ _inGameUsersMutex };
+	for (auto& [userId, weakSession] : _inGameUsers) {
+		auto session = weakSession.lock();
+		if (nullptr == session) continue;
+
+		session->Post([self = shared_from_this(), session]()
+			{
+				if ((ST_INGAME != session->GetState()) or session->IsHandedOff()) {
+					return;
+				}
+
+				self->SavePlayerState(session);
+			});
+	}
 }
 
 void Service::OnChatRequest(int senderId, const char* msg, int targetId)
 {
+	PROFILE_ZONE("Service::OnChatRequest");
+
 	_chatManager->HandleMessage(shared_from_this(), senderId, msg, targetId);
 }
 
@@ -386,9 +837,34 @@ void Service::Broadcast(const std::vector<char>& buf)
 }
 
 bool Service::OnPacket(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
+{
+	unsigned char packetType = static_cast<unsigned char>(packet[1]);
+	Metrics::AddPacketIn(packetType, packet.size());
+
+	auto start = Metrics::Clock::now();
+	bool result = DispatchPacket(session, packet);
+	Metrics::RecordHandler(packetType, start);
+
+	return result;
+}
+
+bool Service::DispatchPacket(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
 	char packetType = packet[1];
 
+	// Zone 분할이면 GZ_HELLO로 Gateway임을 증명한 연결만 받음. 단일 Process에서는 Zone Packet을 받지 않음
+	if (_zoneCount > 1) {
+		if (session->IsGatewayTrusted() == (packetType == static_cast<char>(GZ_HELLO))) {
+			LOG_WRN("Session[%d] sent packet %d before / after gateway hello", session->GetId(), packetType);
+			return false;
+		}
+	}
+
+	else if ((packetType == static_cast<char>(GZ_HANDOFF_IN)) or (packetType == static_cast<char>(GZ_HELLO))) {
+		LOG_WRN("Session[%d] sent zone packet %d to a single-process server", session->GetId(), packetType);
+		return false;
+	}
+
 	switch (packetType) {
 	case CS_LOGIN:			return OnLogin(session, packet);
 	case CS_LOGOUT:			return OnLogout(session, packet);
@@ -402,6 +878,8 @@ bool Service::OnPacket(const std::shared_ptr<GameSession>& session, const std::v
 	case CS_USE_ITEM:		return OnUseItem(session, packet);
 	case CS_TALK_TO_NPC:	return OnTalkToNpc(session, packet);
 	case CS_QUEST_ACCEPT:	return OnQuestAccept(session, packet);
+	case GZ_HANDOFF_IN:		return OnHandoffIn(session, packet);
+	case GZ_HELLO:			return OnGatewayHello(session, packet);
 
 	default:
 		LOG_WRN("Packet Type Error");
@@ -411,6 +889,8 @@ bool Service::OnPacket(const std::shared_ptr<GameSession>& session, const std::v
 
 bool Service::OnLogin(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnLogin");
+
 	// 1. packet 파싱
 	auto requestPacket = PacketFactory::Deserialize<CS_LOGIN_PACKET>(packet);
 	requestPacket.name[NAME_SIZE - 1] = '\0';
@@ -429,19 +909,24 @@ bool Service::OnLogin(const std::shared_ptr<GameSession>& session, const std::ve
 		}
 	}
 
+	// 이미 Login 요청 중인 Session이면 무시
+	if (session->GetUserID() != -1) {
+		LOG_WRN("Session %d login already requested", session->GetId());
+		return false;
+	}
+
 	{
 		std::unique_lock lock{ _inGameUsersMutex };
-		_inGameUsers.try_emplace(requestPacket.id, session);
-	}
+		if (not _inGameUsers.try_emplace(requestPacket.id, session).second) {
+			LOG_DBG("User[%d] is already in game now", requestPacket.id);
 
-	// 2. ALLOC 상태를 INGAME으로 변경
-	if (not session->TryExchangeState(ST_ALLOC, ST_INGAME)) {
-		LOG_WRN("Session state is not Alloc");
-		return false;
+			session->Send(PacketFactory::BuildLoginFailPacket(*session));
+			return false;
+		}
 	}
 
-	if (nullptr == _dbManager) {
-		LOG_ERR("[Service] DBManager is not Init");
+	if (nullptr == _storage) {
+		LOG_ERR("[Service] Storage is not Init");
 		
 		session->Send(PacketFactory::BuildLoginFailPacket(*session));
 		session->Close();
@@ -449,79 +934,225 @@ bool Service::OnLogin(const std::shared_ptr<GameSession>& session, const std::ve
 		return false;
 	}
 
-	if (not _dbManager->CheckUserID(id)) {
-		LOG_WRN("ID[%s] is not DB ", userId.c_str());
+	session->SetUserID(requestPacket.id);
 
-		session->Send(PacketFactory::BuildLoginFailPacket(*session));
-		session->Close();
+	// 2. Session name 설정
+	session->SetName(requestPacket.name);
+
+	// 3. DB 조회는 DB Thread에서, 결과는 Session Strand로 돌려받아서 처리
+	bool posted = _dbExecutor->TryPost(requestPacket.id, [self = shared_from_this(), storage = _storage, session, id]()
+		{
+			UserLoadResult result;
+			storage->LoadUser(id, result);
+
+			session->Post([self, session, result = std::move(result)]()
+				{
+					self->OnLoginLoaded(session, result);
+				});
+		});
+
+	// DB Queue가 밀려 있으면 Login 거절, Client는 다시 시도
+	if (not posted) {
+		LOG_WRN("User[%d] login rejected, DB queue is full", requestPacket.id);
 
+		{
+			std::unique_lock lock{ _inGameUsersMutex };
+			_inGameUsers.erase(requestPacket.id);
+		}
+
+		session->SetUserID(-1);
+		session->Send(PacketFactory::BuildLoginFailPacket(*session));
 		return false;
 	}
 
-	session->SetUserID(requestPacket.id);
+	LOG_DBG("Process Login Packet Success");
+	return true;
+}
 
-	// 3. Session name 설정
-	session->SetName(requestPacket.name);
+void Service::OnLoginLoaded(const std::shared_ptr<GameSession>& session, const UserLoadResult& result)
+{
+	PROFILE_ZONE("Service::OnLoginLoaded");
 
-	UserData userData;
+	const int userId = session->GetUserID();
 
-	// Session Position 설정
-	if (_dbManager->GetUserInfo(id, userData)) {
-		session->SetUserInfo(userData);
-		//session->SetPos(rand() % 2000, rand() % 2000);
-		
-		if (userData.partyId != -1) {
-			auto party = _partyManager->GetParty(userData.partyId);
-			if (nullptr != party) {
-				party->RemoveMember(session->GetUserID());
-				party->AddMember(session);
-				party->Update();
+	// 1. DB 조회 실패 / 조회 중 접속 종료
+	if ((not result.success) or (ST_FREE == session->GetState())) {
+		{
+			std::unique_lock lock{ _inGameUsersMutex };
+			auto it = _inGameUsers.find(userId);
+			if ((it != _inGameUsers.end()) and (it->second.lock() == session)) {
+				_inGameUsers.erase(it);
 			}
 		}
+
+		if (not result.success) {
+			LOG_WRN("ID[%d] is not DB ", userId);
+
+			session->Send(PacketFactory::BuildLoginFailPacket(*session));
+			session->Close();
+		}
+
+		return;
 	}
 
-	else {
-		LOG_ERR("[Service] DBManager GetPosition failed");
-		session->Close();
-		return false;
+	// 2. ALLOC 상태를 INGAME으로 변경
+	if (not session->TryExchangeState(ST_ALLOC, ST_INGAME)) {
+		LOG_WRN("Session state is not Alloc");
+		return;
 	}
 
-	// Session Item List Select
-	_itemManager->GetUserItem(session, shared_from_this());
+	// 3. Session 정보 설정
+	const UserData& userData = result.userData;
+	session->SetUserInfo(userData);
+
+	if (userData.partyId != -1) {
+		auto party = _partyManager->GetParty(userData.partyId);
+		if (nullptr != party) {
+			party->RemoveMember(session->GetUserID());
+			party->AddMember(session);
+			party->Update();
+		}
+	}
 
-	// 4. Session Container에 등록
+	// Session Item List 설정
+	_itemManager->LoadUserItems(session, result.items);
+
+	// 4. World 진입
+	EnterWorld(session, result.quests);
+
+	// 5. DB 위치가 다른 Zone이면 바로 넘김
+	CheckZoneHandoff(session);
+}
+
+void Service::EnterWorld(const std::shared_ptr<GameSession>& session, const std::vector<QuestData>& quests)
+{
+	PROFILE_ZONE("Service::EnterWorld");
+
+	// 1. Session Container에 등록
 	AddObject(session);
 
-	// 5. Login / Stat Packet Send
+	// 2. Login / Stat Packet Send
 	auto loginPacket = PacketFactory::BuildLoginOkPacket(*session);
 	auto statPacket = PacketFactory::BuildStatChangePacket(*session);
 
 	session->Send(loginPacket);
 	session->Send(statPacket);
 
-	// 6. Sector에 등록
+	// 3. Sector에 등록
 	_viewManager->EnterSector(session);
 
-	// 7. OnPlayerLogin 호출
+	// 4. OnPlayerLogin 호출
 	OnPlayerLogin(session);
 
-	// 8. 자동 회복 Event Push
+	// 5. 자동 회복 Event Push
 	_timerQueue.push(Event{ session->GetId(),
-		std::chrono::high_resolution_clock::now() + std::chrono::seconds(5),
+		GameClock::Now() + std::chrono::seconds(5),
 		EV_PLAYER_HEAL, 0 });
 
-	// 9. QuestManager 등록
-	auto quests = _dbManager->GetUserQuests(std::to_wstring(session->GetUserID()));
+	// 6. QuestManager 등록
 	_questManager->RegisterPlayer(session->GetId());
 	_questManager->SetUserQuests(session, quests);
 
+	// 7. 현재 상태를 Write-Behind Cache 기준값으로 등록
+	_playerCache->Track(session->GetUserInfo(), _questManager->GetUserQuestData(session->GetId()));
+}
 
-	LOG_DBG("Process Login Packet Success");
+bool Service::OnGatewayHello(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
+{
+	PROFILE_ZONE("Service::OnGatewayHello");
+
+	if (packet.size() != sizeof(GZ_HELLO_PACKET)) {
+		LOG_WRN("Session[%d] gateway hello size error", session->GetId());
+		return false;
+	}
+
+	auto requestPacket = PacketFactory::Deserialize<GZ_HELLO_PACKET>(packet);
+
+	char expected[ZONE_SECRET_SIZE];
+	FillZoneSecret(expected, _zoneSecret.c_str());
+	if (not ZoneSecretEquals(requestPacket.secret, expected)) {
+		LOG_WRN("Session[%d] gateway secret mismatch", session->GetId());
+		return false;
+	}
+
+	session->SetGatewayTrusted(true);
+	return true;
+}
+
+bool Service::OnHandoffIn(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
+{
+	PROFILE_ZONE("Service::OnHandoffIn");
+
+	// Login과 DB를 건너뛰므로 Gateway Secret을 확인한 Zone 연결에서만 받음
+	if ((_zoneCount <= 1) or (not session->IsGatewayTrusted())) {
+		LOG_WRN("Session[%d] handoff rejected: not a gateway connection", session->GetId());
+		return false;
+	}
+
+	if (packet.size() != sizeof(GZ_HANDOFF_IN_PACKET)) {
+		LOG_WRN("Session[%d] handoff size error", session->GetId());
+		return false;
+	}
+
+	// 1. packet 파싱
+	auto requestPacket = PacketFactory::Deserialize<GZ_HANDOFF_IN_PACKET>(packet);
+	HandoffState& state = requestPacket.state;
+	state.name[NAME_SIZE - 1] = '\0';
+
+	// 2. 중복 검사 후 등록
+	{
+		std::unique_lock lock{ _inGameUsersMutex };
+		if (not _inGameUsers.try_emplace(state.userId, session).second) {
+			LOG_WRN("Handoff User[%d] is already in zone %d", state.userId, _zoneId);
+
+			session->Send(PacketFactory::BuildLoginFailPacket(*session));
+			return false;
+		}
+	}
+
+	// 3. ALLOC 상태를 INGAME으로 변경
+	if (not session->TryExchangeState(ST_ALLOC, ST_INGAME)) {
+		LOG_WRN("Session state is not Alloc");
+		return false;
+	}
+
+	// 4. DB 조회 없이 넘겨받은 상태로 복원
+	session->SetUserID(state.userId);
+	session->SetName(state.name);
+
+	UserData userData{ state.userId, state.level, state.exp, state.hp, state.maxHp, state.x, state.y, state.partyId };
+	session->SetUserInfo(userData);
+
+	// Party는 Process마다 따로 관리하므로 이 Zone에 같은 Party가 있을 때만 다시 연결
+	if (userData.partyId != -1) {
+		if (auto party = _partyManager->GetParty(userData.partyId)) {
+			party->RemoveMember(session->GetUserID());
+			party->AddMember(session);
+			party->Update();
+		}
+	}
+
+	for (int i = 0; i < std::min<int>(state.itemCount, MAX_HANDOFF_ITEMS); ++i) {
+		session->GetInventory()->AddItem(state.items[i].itemId, state.items[i].count);
+	}
+
+	std::vector<QuestData> quests;
+	quests.reserve(state.questCount);
+	for (int i = 0; i < std::min<int>(state.questCount, MAX_HANDOFF_QUESTS); ++i) {
+		quests.emplace_back(state.quests[i].questId, state.quests[i].progress);
+	}
+
+	// 5. World 진입
+	EnterWorld(session, quests);
+
+	LOG_INF("User[%d] handed off into zone %d", state.userId, _zoneId);
 	return true;
 }
 
 bool Service::OnLogout(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnLogout");
+
 	{
 		std::unique_lock lock{ _inGameUsersMutex };
 		if (_inGameUsers.contains(session->GetUserID())) {
@@ -529,11 +1160,9 @@ bool Service::OnLogout(const std::shared_ptr<GameSession>& session, const std::v
 		}
 	}
 
-	UserData userData = session->GetUserInfo();
-	auto quests = _questManager->GetUserQuestData(session->GetId());
-
-	_dbManager->UpdateUserInfo(userData);
-	_dbManager->UpdateUserQuests(userData.id, quests);
+	// 바뀐 상태만 바로 DB Thread로 넘김
+	SavePlayerState(session);
+	_playerCache->Release(session->GetUserID());
 
 	session->Close();
 	return true;
@@ -541,6 +1170,8 @@ bool Service::OnLogout(const std::shared_ptr<GameSession>& session, const std::v
 
 bool Service::OnMove(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnMove");
+
 	// 0. INGAME이 아니면 실행 X
 	if (session->GetState() != ST_INGAME) {
 		LOG_WRN("Session state is not Ingame");
@@ -553,12 +1184,11 @@ bool Service::OnMove(const std::shared_ptr<GameSession>& session, const std::vec
 
 	// 1. packet 파싱
 	auto requestPacket = PacketFactory::Deserialize<CS_MOVE_PACKET>(packet);
-	//session->_lastMoveTime = requestPacket.move_time;
 
 	// 2. lastMoveTime과 현재 시각 계산해서 0.5초에 1번씩 움직이도록 제한
-	auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	auto now = GameClock::NowMs();
 	if ((now - session->_lastMoveTime) < 500) {
-		LOG_INF("Move Cooldown");
+		LOG_DBG("Move Cooldown");
 		return false;
 	}
 	session->_lastMoveTime = now;
@@ -588,12 +1218,16 @@ bool Service::OnMove(const std::shared_ptr<GameSession>& session, const std::vec
 
 	// 3. Sector 동기화
 	if (oldSector != newSector) {
-		_viewManager->LeaveSector(session, oldSector.first, oldSector.second);
-		_viewManager->EnterSector(session, newSector.first, newSector.second);
+		_viewManager->MoveSector(session, oldSector.first, oldSector.second, newSector.first, newSector.second);
 	}
 
-	// 4. OnPlayerMove 호출
+	// 4. OnPlayerMove 호출. Client의 move_time은 본인 Move 응답에 실어서 Round Trip 측정에 사용
+	session->SetMoveTimeEcho(requestPacket.move_time);
 	OnPlayerMove(session);
+	session->SetMoveTimeEcho(0);
+
+	// 5. Zone 경계를 넘었으면 다음 Zone으로 넘김
+	CheckZoneHandoff(session);
 
 	LOG_DBG("Process Move Packet Success");
 	return true;
@@ -601,6 +1235,8 @@ bool Service::OnMove(const std::shared_ptr<GameSession>& session, const std::vec
 
 bool Service::OnTeleport(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnTeleport");
+
 	// 0. INGAME이 아니면 실행 X
 	if (session->GetState() != ST_INGAME) {
 		LOG_WRN("Session state is not Ingame");
@@ -613,12 +1249,13 @@ bool Service::OnTeleport(const std::shared_ptr<GameSession>& session, const std:
 
 
 	while (true) {
-		short x = rand() % 2000;
-		short y = rand() % 2000;
+		short x = static_cast<short>(GameRandom::Next(0, MAP_SIZE - 1));
+		short y = static_cast<short>(GameRandom::Next(0, MAP_SIZE - 1));
 
 		if (_navigationMap[y][x]) {
 			session->SetPos(x, y);
 			session->Send(PacketFactory::BuildMovePacket(*session));
+			CheckZoneHandoff(session);
 			return true;
 		}
 	}
@@ -626,6 +1263,8 @@ bool Service::OnTeleport(const std::shared_ptr<GameSession>& session, const std:
 
 bool Service::OnAttack(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnAttack");
+
 	// 0. INGAME이 아니면 실행 X
 	if (session->GetState() != ST_INGAME) {
 		LOG_WRN("Session state is not Ingame");
@@ -647,10 +1286,10 @@ bool Service::OnAttack(const std::shared_ptr<GameSession>& session, const std::v
 	p.x[2] = session->GetX();     p.y[2] = session->GetY() - 1;
 	p.x[3] = session->GetX();     p.y[3] = session->GetY() + 1;
 
-	auto visible = _viewManager->CollectViewList(session);
-	for (int id : visible) {
+	// Session Strand 안이므로 viewList를 그대로 사용
+	for (int id : session->GetViewList()) {
 		auto object = FindObject(id);
-		if (object->GetType() == ObjectType::PLAYER) {
+		if ((nullptr != object) and (object->GetType() == ObjectType::PLAYER)) {
 			if (auto target = std::static_pointer_cast<GameSession>(object)) {
 				target->Send(PacketFactory::Serialize(p));
 			}
@@ -662,6 +1301,8 @@ bool Service::OnAttack(const std::shared_ptr<GameSession>& session, const std::v
 
 bool Service::OnChat(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnChat");
+
 	// 0. INGAME이 아니면 실행 X
 	if (session->GetState() != ST_INGAME) {
 		LOG_WRN("Session state is not Ingame");
@@ -681,6 +1322,8 @@ bool Service::OnChat(const std::shared_ptr<GameSession>& session, const std::vec
 
 bool Service::OnPartyRequest(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnPartyRequest");
+
 	// 0. INGAME이 아니면 실행 X
 	if (session->GetState() != ST_INGAME) {
 		LOG_WRN("Session state is not Ingame");
@@ -715,6 +1358,8 @@ bool Service::OnPartyRequest(const std::shared_ptr<GameSession>& session, const
 
 bool Service::OnPartyResponse(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnPartyResponse");
+
 	// 0. INGAME이 아니면 실행 X
 	if (session->GetState() != ST_INGAME) {
 		LOG_WRN("Session state is not Ingame");
@@ -729,16 +1374,22 @@ bool Service::OnPartyResponse(const std::shared_ptr<GameSession>& session, const
 
 bool Service::OnPartyLeave(const std::shared_ptr<GameSession>& session)
 {
+	PROFILE_ZONE("Service::OnPartyLeave");
+
 	return _partyManager->HandleLeave(session);
 }
 
 void Service::OnPartyDisband(int partyId)
 {
+	PROFILE_ZONE("Service::OnPartyDisband");
+
 	return _partyManager->DisbandParty(partyId);
 }
 
 bool Service::OnUseItem(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnUseItem");
+
 	// 0. INGAME이 아니면 실행 X
 	if (session->GetState() != ST_INGAME) {
 		LOG_WRN("Session state is not Ingame");
@@ -759,6 +1410,8 @@ bool Service::OnUseItem(const std::shared_ptr<GameSession>& session, const std::
 
 bool Service::OnTalkToNpc(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnTalkToNpc");
+
 	// 0. INGAME이 아니면 실행 X
 	if (session->GetState() != ST_INGAME) {
 		LOG_WRN("Session state is not Ingame");
@@ -786,6 +1439,8 @@ bool Service::OnTalkToNpc(const std::shared_ptr<GameSession>& session, const std
 
 bool Service::OnQuestAccept(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet)
 {
+	PROFILE_ZONE("Service::OnQuestAccept");
+
 	// 0. INGAME이 아니면 실행 X
 	if (session->GetState() != ST_INGAME) {
 		LOG_WRN("Session state is not Ingame");
@@ -805,25 +1460,17 @@ char Service::GetQuestSymbol(const std::shared_ptr<GameSession>& session, int np
 
 int Service::GetRandomInterval(int minMs, int maxMs)
 {
-	thread_local std::mt19937 rng{ std::random_device{}() };
-	std::uniform_int_distribution<int> dist{ minMs, maxMs };
-
-	return dist(rng);
-}
-
-std::vector<std::pair<int, int>> Service::GetUserItems(const std::shared_ptr<GameSession>& session)
-{
-	return _dbManager->GetUserItems(std::to_wstring(session->GetUserID()));
+	return GameRandom::Next(minMs, maxMs);
 }
 
-bool Service::UserGetItem(const std::shared_ptr<GameSession>& session, int itemId, int count)
+void Service::UserGetItem(const std::shared_ptr<GameSession>& session, int itemId, int count)
 {
-	return _dbManager->UserGetItem(session->GetUserID(), itemId, count);
+	_playerCache->AddItem(session->GetUserID(), itemId, count);
 }
 
-bool Service::UserUseItem(const std::shared_ptr<GameSession>& session, int itemId, int count)
+void Service::UserUseItem(const std::shared_ptr<GameSession>& session, int itemId, int count)
 {
-	return _dbManager->UserUseItem(session->GetUserID(), itemId, count);
+	_playerCache->AddItem(session->GetUserID(), itemId, -count);
 }
 
 const std::vector<int> Service::GetPlayersInTile(short x, short y)
@@ -842,16 +1489,32 @@ void Service::UpdateQuestSymbol(const std::shared_ptr<GameSession>& session, int
 	session->Send(PacketFactory::BuildQuestSymbolUpdatePacket(npcId, symbol));
 }
 
-std::shared_ptr<Service> Service::Create(std::shared_ptr<IocpCore> core, int maxSessionCount)
+std::shared_ptr<Service> Service::Create(std::shared_ptr<IocpCore> core, int maxSessionCount, int regionCountX, int regionCountY)
 {
+	// Region 수를 지정하지 않으면 Core 수의 절반을 Region Thread로 (나머지는 IOCP / Job Worker)
+	// Region이 정사각형에 가깝도록 x <= y인 약수 쌍 중 가장 가까운 쌍으로 나눔
+	if ((regionCountX <= 0) or (regionCountY <= 0)) {
+		int count = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) / 2);
+
+		regionCountX = 1;
+		for (int i = 1; i * i <= count; ++i) {
+			if (0 == count % i) {
+				regionCountX = i;
+			}
+		}
+		regionCountY = count / regionCountX;
+	}
+
 	std::shared_ptr<Service> service = std::make_shared<Service>(core, maxSessionCount);
 
 	service->_iocpCore = std::make_shared<IocpCore>(service);
 	service->_listener = std::make_shared<Listener>(service);
-	service->_viewManager = std::make_shared<ViewManager>(service);
+	service->_viewManager = std::make_shared<ViewManager>(service, regionCountX, regionCountY);
 	service->_questManager = std::make_shared<QuestManager>(service);
 	service->_combatManager = std::make_shared<CombatManager>(service);
-	service->_dbManager = std::make_shared<DBManager>();
+	service->_npcSystem = std::make_shared<NpcSystem>(service);
+	service->_scriptManager = std::make_shared<ScriptManager>();
+	service->_jobScheduler = std::make_shared<JobScheduler>();
 	service->_chatManager = std::make_shared<ChatManager>();
 	service->_itemManager = std::make_shared<ItemManager>();
 	service->_partyManager = std::make_shared<PartyManager>();
@@ -860,65 +1523,116 @@ std::shared_ptr<Service> Service::Create(std::shared_ptr<IocpCore> core, int max
 	return service;
 }
 
-int Service::Lua_SpawnMonster(lua_State* L)
+void Service::SpawnMonsters(const std::vector<SpawnEntry>& spawns, int firstIndex)
 {
-	int x = static_cast<int>(lua_tointeger(L, 1));
-	int y = static_cast<int>(lua_tointeger(L, 2));
-	const char* typeStr = lua_tostring(L, 3);
-	const char* moveStr = lua_tostring(L, 4);
-	int level = static_cast<int>(lua_tointeger(L, 5));
-	
-	MonsterType mType;
-	MovementType mvType;
-
-	std::string type;
-	std::string move;
+	constexpr int SPAWN_BATCH_SIZE{ 4096 };
 
-	if (strcmp(typeStr, "Peace") == 0) {
-		mType = MonsterType::Peace; 
-		type = "P";
+	int count = static_cast<int>(spawns.size()) - firstIndex;
+	if (count <= 0) {
+		return;
 	}
 
-	else if (strcmp(typeStr, "Agro") == 0) {
-		mType = MonsterType::Agro;
-		type = "A";
+	// 1. Id를 한 번에 예약 (하나씩 Spawn했을 때와 같은 순서의 Id)
+	int firstId = _objectManager->ReserveNpcIds(count);
+	if (firstId < 0) {
+		LOG_ERR("Too Many IDs (%d spawns)", count);
+		return;
 	}
 
-	else {
-		return 0;
-	}
+	// 2. 미리 크기를 잡은 목록에 Batch 단위로 병렬 생성. 각 Thread는 자기가 가져간 구간에만 씀
+	std::vector<std::shared_ptr<Monster>> monsters(count);
+	std::atomic<int> nextBatch{ 0 };
+	auto self = shared_from_this();
+
+	auto build = [&]()
+		{
+			while (true) {
+				int begin = nextBatch.fetch_add(SPAWN_BATCH_SIZE);
+				if (begin >= count) {
+					break;
+				}
+
+				int end = std::min(begin + SPAWN_BATCH_SIZE, count);
+
+				// Batch의 Monster는 Arena 하나에 연속으로 (Monster마다 Heap 할당 없음)
+				ArenaAllocator<Monster> allocator{ std::make_shared<MonsterArena>(end - begin) };
+
+				for (int i = begin; i < end; ++i) {
+					int spawnIndex = firstIndex + i;
+					const SpawnEntry& entry = spawns[spawnIndex];
 
-	if (strcmp(moveStr, "Fixed") == 0) {
-		mvType = MovementType::Fixed;
-		move = "F";
+					char name[32];
+					snprintf(name, sizeof(name), "M%c%c%d", (entry.monsterType == MonsterType::Peace) ? 'P' : 'A',
+						(entry.movementType == MovementType::Fixed) ? 'F' : 'R', spawnIndex);
+
+					auto monster = std::allocate_shared<Monster>(allocator, firstId + i, entry.x, entry.y, name, entry.monsterType, entry.movementType);
+					monster->SetLevel(entry.level);
+					monster->SetSpawnIndex(spawnIndex);
+					monster->SetService(self);
+					monsters[i] = std::move(monster);
+				}
+			}
+		};
+
+	unsigned int threadCount = std::clamp<unsigned int>(std::thread::hardware_concurrency(), 1, (count + SPAWN_BATCH_SIZE - 1) / SPAWN_BATCH_SIZE);
+
+	std::vector<std::thread> builders;
+	builders.reserve(threadCount - 1);
+	for (unsigned int i = 1; i < threadCount; ++i) {
+		builders.emplace_back(build);
 	}
+	build();
 
-	else if (strcmp(moveStr, "Roaming") == 0) {
-		mvType = MovementType::Roaming;
-		move = "R";
+	for (std::thread& builder : builders) {
+		builder.join();
 	}
 
-	else {
-		return 0;
+	// 3. ObjectManager / Sector 등록은 Lock과 Region Job을 묶어서 한 번씩
+	// Monster Handle은 INVALID_HANDLE_VALUE라 IOCP 등록은 항상 실패하고 효과가 없으므로 생략
+	_objectManager->AddMonsters(monsters);
+	_viewManager->EnterSectors(monsters);
+	_spawnedMonsters.insert(_spawnedMonsters.end(), monsters.begin(), monsters.end());
+
+	LOG_INF("Spawned %d monsters with %u threads", count, threadCount);
+}
+
+bool Service::ReloadScripts()
+{
+	std::lock_guard lock{ _spawnLock };
+
+	if (not _scriptManager->Load()) {
+		LOG_ERR("Script reload failed, keeping previous scripts");
+		return false;
 	}
 
-	static int idCounter = 0;
+	// 1. 남은 항목 : 바뀐 위치 / 종류 / Level과 AI 값은 다음 Tick, Respawn부터 적용 (Monster::OnHeal)
+	auto bundle = _scriptManager->GetBundle();
+	int newCount = static_cast<int>(bundle->spawns.size());
+	int oldCount = static_cast<int>(_spawnedMonsters.size());
 
-	std::string name = "M" + type + move + std::to_string(idCounter++);
+	// 2. 빠진 항목 : 살아 있으면 죽이고, Respawn 대신 World에서 제거 (OnNpcRetire)
+	for (int i = newCount; i < oldCount; ++i) {
+		const auto& monster = _spawnedMonsters[i];
 
-	auto monster = std::make_shared<Monster>(-1, x, y, name, mType, mvType);
-	monster->SetLevel(level);
-	monster->SetService(shared_from_this());
-	AddObject(monster);
-	EnterSector(monster);
-	_iocpCore->Register(monster);
+		bool wasAlive = monster->IsAlive();
+		monster->Retire();
+		monster->Die();
 
-	return 0;
-}
+		if (wasAlive) {
+			_viewManager->HandleNpcDeath(monster);
+		}
+	}
 
-int Lua_SpawnMonster_Wrapper(lua_State* L)
-{
-	Service* raw = static_cast<Service*>(lua_touserdata(L, lua_upvalueindex(1)));
-	auto service = raw->shared_from_this();
-	return service->Lua_SpawnMonster(L);
+	if (newCount < oldCount) {
+		_spawnedMonsters.resize(newCount);
+	}
+
+	// 3. 늘어난 항목 : 바로 Spawn
+	SpawnMonsters(bundle->spawns, oldCount);
+
+	if (newCount != oldCount) {
+		LOG_INF("Spawn table reloaded: %d -> %d entries", oldCount, newCount);
+	}
+
+	return true;
 }
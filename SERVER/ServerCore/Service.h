@@ -14,26 +14,21 @@ class ObjectManager;
 class ViewManager;
 class CombatManager;
 class Monster;
-class DBManager;
-
-enum EventType : char {
-	EV_MOVE,
-	EV_HEAL,
-	EV_ATTACK,
-	EV_PLAYER_HEAL,
-	EV_PLAYER_RESPAWN
-};
+class IStorage;
+class DBExecutor;
+class PlayerCache;
+class NpcSystem;
+class ScriptManager;
 
-struct Event {
-	int objId;
-	std::chrono::high_resolution_clock::time_point wakeupTime;
-	char eventId;
-	int targetId;
+struct SpawnEntry;
+class JobScheduler;
+class PacketRecorder;
 
-	bool operator<(const Event& other) const {
-		return wakeupTime > other.wakeupTime;
-	}
-};
+struct QuestData;
+struct UserLoadResult;
+
+// Service::Start의 database가 이 Prefix로 시작하면 SQLite File 경로로 사용
+constexpr std::string_view SQLITE_STORAGE_PREFIX{ "sqlite:" };
 
 class Service : public std::enable_shared_from_this<Service>
 {
@@ -44,6 +39,15 @@ public:
 	bool Start(std::string_view database, const std::string& map);
 	void CloseService();
 
+public:
+	// Socket, I/O Thread, Region / Timer / DB Thread 없이 시작 (SimHarness)
+	// 모든 Job은 RunSimulation을 부른 Thread에서 정해진 순서로 실행되므로 같은 입력이면 같은 출력
+	bool StartSimulation(const std::shared_ptr<IStorage>& storage, const std::string& map);
+	std::shared_ptr<GameSession> CreateSimulationSession(std::function<void(const std::vector<char>&)> sink);
+
+	// 처리할 Timer / DB / Job / Region 작업이 없을 때까지 실행하고 실행한 수 반환
+	size_t RunSimulation();
+
 public:
 	std::shared_ptr<GameObject> FindObject(int id, bool player = false) const;
 	int AddObject(const std::shared_ptr<GameObject> object);
@@ -53,6 +57,9 @@ public:
 	void InitNpcs(int npcCount);
 	void StartNpcTimerThread();
 
+	// 예정 시각(GameClock)이 지난 Timer Event를 Region / Strand / Job으로 넘기고 넘긴 수 반환
+	int ProcessTimers();
+
 	void LoadMap(const std::string& filename);
 
 	void OnPlayerLogin(const std::shared_ptr<GameSession>& session);
@@ -63,6 +70,7 @@ public:
 	void OnNpcMove(const std::shared_ptr<Monster>& npc, int oldX, int oldY);
 	void OnNpcDeath(const std::shared_ptr<Monster>& monster, const std::shared_ptr<GameSession>& killer);
 	void OnNpcRevive(const std::shared_ptr<Monster>& npc);
+	void OnNpcRetire(const std::shared_ptr<Monster>& npc);
 
 public:
 	void EnterSector(const std::shared_ptr<GameObject>& object);
@@ -70,8 +78,8 @@ public:
 	void EnterSector(const std::shared_ptr<GameObject>& object, int sx, int sy);
 	void LeaveSector(const std::shared_ptr<GameObject>& object, int sx, int sy);
 
-	std::unordered_set<int> CollectVisibleObjects(const std::shared_ptr<GameObject>& object) const;
-	std::unordered_set<int> CollectViewList(const std::shared_ptr<GameObject>& object) const;
+	std::unordered_set<int> CollectRegionViewList(int selfId, int x, int y) const;
+	std::unordered_set<int> CollectRegionObjects(int sx, int sy, int radius) const;
 
 public:
 	void OnChatRequest(int senderId, const char* msg, int targetId = -1);
@@ -92,26 +100,74 @@ public:
 	bool OnUseItem(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet);
 	bool OnTalkToNpc(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet);
 	bool OnQuestAccept(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet);
+	bool OnHandoffIn(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet);
+	bool OnGatewayHello(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet);
+
+public:
+	// Zone 분할 (x축 기준 zoneCount개), zoneCount가 1이면 단일 Process
+	void SetZone(int zoneId, int zoneCount);
+	int GetZoneId() const { return _zoneId; }
+	unsigned short GetListenPort() const;
+
+	// Zone 분할일 때 Gateway 확인용 Secret과 Listen 주소. Secret 없이는 Zone Server를 시작하지 않음
+	void SetZoneGateway(const std::string& secret, const std::string& bindAddress);
+	const std::string& GetListenAddress() const { return _listenAddress; }
+
+	bool CheckZoneHandoff(const std::shared_ptr<GameSession>& session);
+	bool HandoffOut(const std::shared_ptr<GameSession>& session, int targetZone);
+
+	// ZG_HANDOFF 뒤에 같은 연결로 들어온 Packet (Client Packet은 Gateway로 돌려보냄)
+	bool OnHandedOffPacket(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet);
 
 public:
 	char GetQuestSymbol(const std::shared_ptr<GameSession>& session, int npcId);
 	int GetRandomInterval(int minMs, int maxMs);
 	std::shared_ptr<IocpCore>& GetIocpCore() { return _iocpCore; }
+	std::shared_ptr<NpcSystem>& GetNpcSystem() { return _npcSystem; }
+	std::shared_ptr<ScriptManager>& GetScriptManager() { return _scriptManager; }
+
+	// Spawn Table / AI Script 다시 Load. 실패하면 이전 Script 유지
+	// Spawn 항목은 순서로 맞춤 : 늘어난 항목은 바로 Spawn, 빠진 항목은 Despawn, 바뀐 항목은 다음 Respawn부터 적용
+	bool ReloadScripts();
+
+	void PushJob(Job job);
+	void PostDB(int userId, Job job);
+
+	// Start 전에 설정, 기본값 PlayerCache::DEFAULT_FLUSH_INTERVAL_MS
+	void SetFlushInterval(int flushIntervalMs) { _flushIntervalMs = flushIntervalMs; }
+
+	// Start 전에 설정하면 받은 Packet을 path에 Packet Trace로 기록 (STRESS_TEST/Replay)
+	void SetPacketTracePath(const std::string& path) { _packetTracePath = path; }
+	PacketRecorder* GetPacketRecorder() const { return _packetRecorder.get(); }
+	void SavePlayerState(const std::shared_ptr<GameSession>& session);
 
-	std::vector<std::pair<int, int>> GetUserItems(const std::shared_ptr<GameSession>& session);
-	bool UserGetItem(const std::shared_ptr<GameSession>& session, int itemId, int count);
-	bool UserUseItem(const std::shared_ptr<GameSession>& session, int itemId, int count);
+	// Item 증감은 Write-Behind Cache에 누적했다가 주기적으로 DB에 반영
+	void UserGetItem(const std::shared_ptr<GameSession>& session, int itemId, int count);
+	void UserUseItem(const std::shared_ptr<GameSession>& session, int itemId, int count);
 
 	const std::vector<int> GetPlayersInTile(short x, short y);
 	const std::vector<int> GetMonstersInTile(short x, short y);
 
 	void UpdateQuestSymbol(const std::shared_ptr<GameSession>& session, int npcId);
 
-public:
-	int Lua_SpawnMonster(lua_State* L);
+private:
+	static std::shared_ptr<IStorage> CreateStorage(std::string_view database);
+	static std::string_view StripStoragePrefix(std::string_view database);
+
+	void CapturePlayerStates();
+	void LogStorageStats();
+	void CollectMetricGauges(MetricGauges& gauges) const;
+	void CollectQueueDepths(MetricGauges& queues) const;
+	bool DispatchPacket(const std::shared_ptr<GameSession>& session, const std::vector<char>& packet);
+	void OnLoginLoaded(const std::shared_ptr<GameSession>& session, const UserLoadResult& result);
+	void EnterWorld(const std::shared_ptr<GameSession>& session, const std::vector<QuestData>& quests);
+
+	// spawns[firstIndex..]를 Spawn해서 _spawnedMonsters 뒤에 추가
+	void SpawnMonsters(const std::vector<SpawnEntry>& spawns, int firstIndex = 0);
 
 public:
-	static std::shared_ptr<Service> Create(std::shared_ptr<IocpCore> core, int maxSessionCount = 10);
+	// regionCount가 0이면 hardware_concurrency로 정함
+	static std::shared_ptr<Service> Create(std::shared_ptr<IocpCore> core, int maxSessionCount = 10, int regionCountX = 0, int regionCountY = 0);
 
 public:
 	std::array<std::array<bool, 2000>, 2000> _navigationMap;
@@ -126,7 +182,9 @@ public:
 private:
 	std::shared_ptr<IocpCore>	   _iocpCore;
 	std::shared_ptr<Listener>      _listener;
-	std::shared_ptr<DBManager>     _dbManager;
+	std::shared_ptr<IStorage>      _storage;
+	std::shared_ptr<DBExecutor>    _dbExecutor;
+	std::shared_ptr<PlayerCache>   _playerCache;
 	std::shared_ptr<ChatManager>   _chatManager;
 	std::shared_ptr<ItemManager>   _itemManager;
 	std::shared_ptr<ViewManager>   _viewManager;
@@ -134,6 +192,20 @@ private:
 	std::shared_ptr<QuestManager>  _questManager;
 	std::shared_ptr<ObjectManager> _objectManager;
 	std::shared_ptr<CombatManager> _combatManager;
+	std::shared_ptr<NpcSystem>     _npcSystem;
+	std::shared_ptr<ScriptManager> _scriptManager;
+	std::shared_ptr<JobScheduler>  _jobScheduler;
+	std::unique_ptr<PacketRecorder> _packetRecorder;
+
+	// [Spawn Table index]. Reload 때 Spawn 항목과 Monster를 맞추는 데만 사용
+	std::mutex _spawnLock;
+	std::vector<std::shared_ptr<Monster>> _spawnedMonsters;
+
+	int _zoneId{ 0 };
+	int _zoneCount{ 1 };
+	std::string _zoneSecret;
+	std::string _listenAddress;		// 비어 있으면 INADDR_ANY
+
+	int _flushIntervalMs;
+	std::string _packetTracePath;
 };
-
-int Lua_SpawnMonster_Wrapper(struct lua_State* L);
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "Session.h"
 
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_NET
+
 Session::~Session()
 { 
 	LOG_DBG("Session %d Delete", _sessionId);
@@ -13,12 +16,22 @@ void Session::Send(const std::vector<char>& data)
 		return;
 	}
 
-	if (_socket == INVALID_SOCKET) {
+	if ((_socket == INVALID_SOCKET) and (not _sendSink)) {
+		return;
+	}
+
+	if (data.size() >= 2) {
+		Metrics::AddPacketOut(static_cast<unsigned char>(data[1]), data.size());
+	}
+
+	if (_sendSink) {
+		_sendSink(data);
 		return;
 	}
 
 	auto buf = std::make_shared<std::vector<char>>(data);
 	_sendQueue.push(buf);
+	Metrics::Record(METRIC_SEND_QUEUE_DEPTH, _sendQueueDepth.fetch_add(1) + 1);
 
 	bool expected{ false };
 	if (_isSending.compare_exchange_strong(expected, true)) {
@@ -26,6 +39,16 @@ void Session::Send(const std::vector<char>& data)
 	}
 }
 
+void Session::SetSendSink(SendSink sink)
+{
+	if (_socket != INVALID_SOCKET) {
+		closesocket(_socket);
+		_socket = INVALID_SOCKET;
+	}
+
+	_sendSink = std::move(sink);
+}
+
 void Session::doRecv()
 {
 	if ((ST_FREE == _state.load()) or (_socket == INVALID_SOCKET)) {
@@ -70,6 +93,7 @@ void Session::doSend()
 	while ((packets.size() < MAX_PACKET) and (_sendQueue.try_pop(sendData))) {
 		packets.push_back(std::move(sendData));
 	}
+	_sendQueueDepth.fetch_sub(static_cast<int>(packets.size()));
 
 	if (packets.empty()) {
 		_isSending.store(false);
@@ -120,8 +144,24 @@ void Session::RecvCallback(DWORD numBytes)
 	std::vector<char> readBuffer(numBytes);
 	_recvOver._buffer.Read(readBuffer.data(), numBytes);
 
-	ProcessPacket(readBuffer);
+	auto service = _service.lock();
+	if (nullptr == service) {
+		Close();
+		return;
+	}
 
+	// Packet 처리는 Session Strand에 넘기고 I/O Thread는 바로 다음 Completion을 받음
+	// 다음 Recv는 처리가 끝난 뒤 걸어야 Session 안의 Packet 순서가 유지됨
+	auto self = static_cast<GameSession*>(this)->shared_from_this();
+	self->Post([self, packet = std::move(readBuffer)]()
+		{
+			self->ProcessPacket(packet);
+			self->RecvCompleted();
+		});
+}
+
+void Session::RecvCompleted()
+{
 	if (_pendingIoCount.fetch_sub(1) == 1) {
 		if (_shouldRelease) {
 			if (auto service = _service.lock()) {
@@ -152,7 +192,7 @@ void Session::SendCallback()
 
 void Session::Close()
 {
-	// ̹  Session̸ return,  ʾ state Free 
+	// 이미 닫힌 Session이면 return, 닫히지 않았으면 state를 Free로 변경
 	if (_state.exchange(ST_FREE) == ST_FREE) {
 		return;
 	}
@@ -214,7 +254,6 @@ void GameSession::Dispatch(ExpOver* expOver, int numOfBytes)
 GameSession::GameSession() : Session(), GameObject()
 {
 	_type = ObjectType::PLAYER;
-	_viewList.store(std::make_shared<std::unordered_set<int>>());
 	_inventory = nullptr;
 }
 
@@ -236,6 +275,20 @@ bool GameSession::ProcessPacket(const std::vector<char>& packet)
 		return false;
 	}
 
+	// ZG_HANDOFF를 보낸 뒤에는 처리하지 않고 Gateway로 돌려보냄 (ZG_HANDOFF_REPLAY)
+	if (_handedOff.load()) {
+		return service->OnHandedOffPacket(shared_from_this(), packet);
+	}
+
+	// Packet Trace 기록 중이면 Session마다 traceId를 받아서 도착 순서대로 기록 (Gateway Secret은 남기지 않음)
+	PacketRecorder* recorder = service->GetPacketRecorder();
+	if ((nullptr != recorder) and (packet[1] != static_cast<char>(GZ_HELLO))) {
+		if (0 == _traceId) {
+			_traceId = recorder->NewTraceId();
+		}
+		recorder->Record(_traceId, packet);
+	}
+
 	char packetType = packet[1];
 	bool handled = false;
 
@@ -252,6 +305,8 @@ bool GameSession::ProcessPacket(const std::vector<char>& packet)
 	case CS_USE_ITEM:
 	case CS_TALK_TO_NPC:
 	case CS_QUEST_ACCEPT:
+	case GZ_HANDOFF_IN:
+	case GZ_HELLO:
 		handled = service->OnPacket(shared_from_this(), packet);
 		break;
 
@@ -291,7 +346,7 @@ void GameSession::Die()
 	if (auto service = _service.lock()) {
 		service->OnPlayerDeath(shared_from_this());
 		service->_timerQueue.push(Event{ _id,
-			std::chrono::high_resolution_clock::now() + std::chrono::seconds(3),
+			GameClock::Now() + std::chrono::seconds(3),
 			EV_PLAYER_RESPAWN, 0 });
 	}
 }
@@ -309,7 +364,7 @@ void GameSession::Revive()
 	if (auto service = _service.lock()) {
 		service->OnPlayerRevive(shared_from_this());
 		service->_timerQueue.push(Event{ _id,
-				std::chrono::high_resolution_clock::now() + std::chrono::seconds(5),
+				GameClock::Now() + std::chrono::seconds(5),
 				EV_PLAYER_HEAL, 0 });
 	}
 }
@@ -325,17 +380,17 @@ void GameSession::OnHeal()
 		return;
 	}
 
-	// 1. ̹ maxHp  Event Pushϰ 
+	// 1. 이미 maxHp면 다음 Event Push하고 끝
 	if (_hp == _maxHp) {
 		service->_timerQueue.push(Event{ _id,
-			std::chrono::high_resolution_clock::now() + std::chrono::seconds(5),
+			GameClock::Now() + std::chrono::seconds(5),
 			EV_PLAYER_HEAL, 0 });
 		return;
 	}
 
 	short hp = _hp;
 
-	// 2. maxHp 10%ŭ ȸ
+	// 2. maxHp의 10%만큼 회복
 	_hp = std::min<short>(_hp + (_maxHp / 10), _maxHp);
 
 	short healHp = _hp - hp;
@@ -346,9 +401,9 @@ void GameSession::OnHeal()
 	std::string str = "Player[" + std::to_string(_userID) + "] recovered " + std::to_string(healHp) + " hp";
 	Send(PacketFactory::BuildChatPacket(shared_from_this(), str.c_str()));
 	
-	// 4,  Event Push
+	// 4, 다음 Event Push
 	service->_timerQueue.push(Event{ _id,
-		std::chrono::high_resolution_clock::now() + std::chrono::seconds(5),
+		GameClock::Now() + std::chrono::seconds(5),
 		EV_PLAYER_HEAL, 0 });
 }
 
@@ -385,33 +440,51 @@ UserData GameSession::GetUserInfo() const
 
 void GameSession::AddViewList(int id)
 {
-	while (true) {
-		auto oldViewList = _viewList.load();
-		auto newViewList = std::make_shared<std::unordered_set<int>>(*oldViewList);
-		newViewList->insert(id);
+	_viewList.insert(id);
+}
 
-		if (_viewList.compare_exchange_strong(oldViewList, newViewList)) {
-			break;
-		}
+void GameSession::RemoveViewList(int id)
+{
+	_viewList.erase(id);
+}
+
+void GameSession::ClearViewList()
+{
+	_viewList.clear();
+}
+
+bool GameSession::AcceptViewResult(unsigned int seq)
+{
+	if (seq <= _viewAppliedSeq) {
+		return false;
 	}
+
+	_viewAppliedSeq = seq;
+	return true;
 }
 
-void GameSession::RemoveViewList(int id)
+void GameSession::Post(Job job)
 {
-	while (true) {
-		auto oldViewList = _viewList.load();
-		auto newViewList = std::make_shared<std::unordered_set<int>>(*oldViewList);
-		newViewList->erase(id);
+	auto service = _service.lock();
+	if (nullptr == service) {
+		return;
+	}
 
-		if (_viewList.compare_exchange_strong(oldViewList, newViewList)) {
-			break;
-		}
+	if (_strand.Post(std::move(job))) {
+		service->PushJob([self = shared_from_this()]() { self->DrainStrand(); });
 	}
 }
 
-void GameSession::ClearViewList()
+void GameSession::DrainStrand()
 {
-	_viewList.store(std::make_shared<std::unordered_set<int>>());
+	if (not _strand.Drain()) {
+		return;
+	}
+
+	// 남은 Job은 Scheduler 뒤로 보내서 다른 Session도 실행될 수 있게 함
+	if (auto service = _service.lock()) {
+		service->PushJob([self = shared_from_this()]() { self->DrainStrand(); });
+	}
 }
 
 void GameSession::SetUserInfo(const UserData& userData)
@@ -3,6 +3,8 @@
 #include "ExpOver.h"
 #include "IocpCore.h"
 #include "GameObject.h"
+#include "JobScheduler.h"
+#include "Strand.h"
 
 enum State : char {
 	ST_ALLOC,
@@ -10,8 +12,6 @@ enum State : char {
 	ST_FREE
 };
 
-constexpr int VIEW_RANGE = 7;
-
 class RecvOver;
 class SendOver;
 class Service;
@@ -21,6 +21,9 @@ class Inventory;
 
 class Session : public IocpObject
 {
+public:
+	using SendSink = std::function<void(const std::vector<char>&)>;
+
 public:
 	Session()
 	{
@@ -42,18 +45,22 @@ public:
 
 	bool TryExchangeState(State from, State to) { return _state.compare_exchange_strong(from, to); }
 
+	// Socket 대신 sink로 Packet을 넘김 (Simulation). 원래 Socket은 닫음
+	void SetSendSink(SendSink sink);
+
 public:
 	void doRecv();
 	void doSend();
 
 	void RecvCallback(DWORD numBytes);
+	void RecvCompleted();
 	void SendCallback();
 
 public:
 	void Close();
 
 public:
-	// Interface 
+	// Interface 구현
 	virtual HANDLE GetHandle() override;
 	virtual void Dispatch(ExpOver* expOver, int numOfBytes = 0) abstract;
 
@@ -69,6 +76,9 @@ protected:
 protected:
 	concurrency::concurrent_queue<std::shared_ptr<std::vector<char>>> _sendQueue;
 	std::atomic<bool> _isSending{ false };
+	std::atomic<int> _sendQueueDepth{ 0 };
+
+	SendSink _sendSink;
 
 protected:
 	RecvOver	_recvOver;
@@ -99,31 +109,60 @@ public:
 public:
 	void OnHeal();
 
+public:
+	// 이 Session의 상태를 바꾸는 작업은 모두 Strand를 거쳐 순서대로 실행
+	void Post(Job job);
+	bool IsInStrand() const { return _strand.IsCurrent(); }
+
+public:
+	// 다른 Zone으로 넘긴 뒤에는 Gateway가 연결을 닫을 때까지 들어오는 Packet을 무시
+	bool TryBeginHandoff() { return not _handedOff.exchange(true); }
+	bool IsHandedOff() const { return _handedOff.load(); }
+
+	// GZ_HELLO로 Gateway Secret을 확인한 연결 (Strand 안에서만 접근)
+	bool IsGatewayTrusted() const { return _gatewayTrusted; }
+	void SetGatewayTrusted(bool trusted) { _gatewayTrusted = trusted; }
+
 public:
 	std::shared_ptr<GameSession> ConsumePendingPartyRequester();
 
 public:
 	std::shared_ptr<Inventory>& GetInventory() { return _inventory; }
 	std::shared_ptr<Party> GetParty() const { return _party.lock(); }
-	std::shared_ptr<const std::unordered_set<int>> GetViewList() const { return _viewList.load(); }
+	const std::unordered_set<int>& GetViewList() const { return _viewList; }
 	std::shared_ptr<GameSession> GetPendingPartyRequester() const { return _pendingPartyRequester.load().lock(); }
 	int GetUserID() const { return _userID; }
+	unsigned int GetMoveTimeEcho() const { return _moveTimeEcho; }
 	struct UserData GetUserInfo() const;
 
 	void SetParty(std::shared_ptr<Party> party) { _party = party; }
 	void SetInventory(std::shared_ptr<Inventory> inventory) { _inventory = inventory; }
 	void SetPendingPartyRequester(std::shared_ptr<GameSession> session) { _pendingPartyRequester.store(session); }
-	void SetViewList(const std::unordered_set<int>& newViewList) { _viewList.store(std::make_shared<std::unordered_set<int>>(newViewList)); }
+	void SetViewList(std::unordered_set<int>&& newViewList) { _viewList = std::move(newViewList); }
 	void AddViewList(int id);
 	void RemoveViewList(int id);
 	void ClearViewList();
 	void SetUserID(int userID) { _userID = userID; }
+	void SetMoveTimeEcho(unsigned int moveTime) { _moveTimeEcho = moveTime; }
 	void SetUserInfo(const UserData& userData);
 
+	// Region Thread에 시야 수집을 요청할 때 번호를 받고, 결과를 적용할 때 이미 더 최신 결과를 적용했으면 버림
+	// Region 경계를 넘어 이동하면 서로 다른 Region의 결과가 순서가 바뀌어 돌아올 수 있음
+	unsigned int NextViewRequest() { return ++_viewRequestSeq; }
+	bool AcceptViewResult(unsigned int seq);
+
 	virtual void AddExp(short exp);
 
 private:
-	std::atomic<std::shared_ptr<std::unordered_set<int>>> _viewList;
+	void DrainStrand();
+
+private:
+	Strand _strand;
+
+	// Strand 안에서만 접근
+	std::unordered_set<int> _viewList;
+	unsigned int _viewRequestSeq{ 0 };
+	unsigned int _viewAppliedSeq{ 0 };
 
 private:
 	std::weak_ptr<Party> _party;
@@ -134,4 +173,13 @@ private:
 
 private:
 	int _userID{ -1 };
+
+	// 처리 중인 CS_MOVE의 move_time. 본인에게 보내는 Move 응답에만 그대로 돌려줌
+	unsigned int _moveTimeEcho{ 0 };
+
+	std::atomic<bool> _handedOff{ false };
+	bool _gatewayTrusted{ false };
+
+	// Packet Trace에서 이 Session을 구분하는 값, 0이면 아직 기록 전 (Strand 안에서만 접근)
+	unsigned int _traceId{ 0 };
 };
\ No newline at end of file
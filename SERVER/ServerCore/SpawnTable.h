@@ -0,0 +1,26 @@
+#pragma once
+
+// monster_spawn.lua를 미리 변환한 Binary Spawn Table 파일 구조
+// GameServer.exe --compile-spawns로 만들고, Server는 Memory Map으로 읽음 (Lua 실행 없음)
+
+// Spawn Table 파일 : header 한 번, 이후 record count개 (little endian, padding 없음)
+//  header : magic[8], version:u32, count:u32
+//  record : x:i16, y:i16, monsterType:u8 (Peace 0, Agro 1), movementType:u8 (Fixed 0, Roaming 1), level:i16
+constexpr char SPAWN_TABLE_MAGIC[8] = { 'G', 'S', 'P', 'S', 'P', 'A', 'W', 'N' };
+constexpr unsigned int SPAWN_TABLE_VERSION = 1;
+
+#pragma pack (push, 1)
+struct SpawnTableHeader {
+	char				magic[8];
+	unsigned int		version;
+	unsigned int		count;
+};
+
+struct SpawnTableRecord {
+	short				x;
+	short				y;
+	unsigned char		monsterType;
+	unsigned char		movementType;
+	short				level;
+};
+#pragma pack (pop)
@@ -0,0 +1,417 @@
+// ServerCore pch를 쓰지 않는 File (vcxproj에서 PrecompiledHeader NotUsing)
+#include "SqliteStorage.h"
+
+#ifdef USE_SQLITE_STORAGE
+
+#include <cstdio>
+#include <cwchar>
+
+namespace
+{
+	constexpr int BUSY_TIMEOUT_MS{ 5000 };
+
+	// 새 User 기본값
+	constexpr int NEW_USER_LEVEL{ 1 };
+	constexpr int NEW_USER_HP{ 100 };
+	constexpr int NEW_USER_AREA{ 2000 };	// W_WIDTH / W_HEIGHT와 동일
+
+	const char* const SCHEMA =
+		"CREATE TABLE IF NOT EXISTS users ("
+		"  id INTEGER PRIMARY KEY,"
+		"  level INTEGER NOT NULL,"
+		"  exp INTEGER NOT NULL,"
+		"  hp INTEGER NOT NULL,"
+		"  max_hp INTEGER NOT NULL,"
+		"  x INTEGER NOT NULL,"
+		"  y INTEGER NOT NULL,"
+		"  party_id INTEGER NOT NULL DEFAULT -1);"
+		"CREATE TABLE IF NOT EXISTS user_items ("
+		"  user_id INTEGER NOT NULL,"
+		"  item_id INTEGER NOT NULL,"
+		"  count INTEGER NOT NULL,"
+		"  PRIMARY KEY (user_id, item_id)) WITHOUT ROWID;"
+		"CREATE TABLE IF NOT EXISTS user_quests ("
+		"  user_id INTEGER NOT NULL,"
+		"  quest_id INTEGER NOT NULL,"
+		"  progress INTEGER NOT NULL,"
+		"  PRIMARY KEY (user_id, quest_id)) WITHOUT ROWID;";
+}
+
+thread_local SqliteStorage::ThreadConnection SqliteStorage::t_connection;
+
+// Statement 순서와 일치해야 함
+const char* const SqliteStorage::STATEMENT_QUERIES[STATEMENT_COUNT]{
+	"SELECT id FROM users WHERE id = ?1",
+	"INSERT OR IGNORE INTO users (id, level, exp, hp, max_hp, x, y, party_id) VALUES (?1, ?2, 0, ?3, ?3, ?4, ?5, -1)",
+	"SELECT id, level, exp, hp, max_hp, x, y, party_id FROM users WHERE id = ?1",
+	"UPDATE users SET level = ?2, exp = ?3, hp = ?4, max_hp = ?5, x = ?6, y = ?7, party_id = ?8 WHERE id = ?1",
+	"SELECT item_id, count FROM user_items WHERE user_id = ?1",
+	"INSERT INTO user_items (user_id, item_id, count) VALUES (?1, ?2, ?3) "
+	"ON CONFLICT (user_id, item_id) DO UPDATE SET count = count + excluded.count",
+	"UPDATE user_items SET count = count - ?3 WHERE user_id = ?1 AND item_id = ?2 AND count >= ?3",
+	"DELETE FROM user_items WHERE user_id = ?1 AND item_id = ?2 AND count <= 0",
+	"SELECT quest_id, progress FROM user_quests WHERE user_id = ?1",
+	"DELETE FROM user_quests WHERE user_id = ?1",
+	"INSERT INTO user_quests (user_id, quest_id, progress) VALUES (?1, ?2, ?3)",
+	"BEGIN IMMEDIATE",
+	"COMMIT",
+	"ROLLBACK",
+};
+
+SqliteStorage::SqliteStorage(bool autoCreateUser) : _autoCreateUser(autoCreateUser)
+{
+}
+
+SqliteStorage::~SqliteStorage()
+{
+	Shutdown();
+}
+
+bool SqliteStorage::Init(const std::string& connection)
+{
+	_path = connection;
+
+	// 1. 초기화 Thread에서 한 번 열어서 WAL 전환 + Schema 생성
+	sqlite3* db{ nullptr };
+	if (not Open(db)) {
+		return false;
+	}
+
+	bool success = BootstrapSchema(db);
+	sqlite3_close(db);
+
+	if (success) {
+		fprintf(stderr, "[SqliteStorage] Open %s Success\n", _path.c_str());
+	}
+
+	return success;
+}
+
+void SqliteStorage::Shutdown()
+{
+	CloseThreadConnection();
+}
+
+bool SqliteStorage::CheckUserID(const std::wstring& userID)
+{
+	int id{ -1 };
+	if (not ParseUserID(userID, id)) {
+		return false;
+	}
+
+	// 1. 없는 ID면 기본값으로 생성
+	if (_autoCreateUser) {
+		sqlite3_stmt* insert = GetStatement(INSERT_USER);
+		if (nullptr == insert) {
+			return false;
+		}
+
+		sqlite3_bind_int(insert, 1, id);
+		sqlite3_bind_int(insert, 2, NEW_USER_LEVEL);
+		sqlite3_bind_int(insert, 3, NEW_USER_HP);
+		sqlite3_bind_int(insert, 4, id % NEW_USER_AREA);
+		sqlite3_bind_int(insert, 5, (id / NEW_USER_AREA * 7 + id * 13) % NEW_USER_AREA);
+
+		if (not Step(insert, INSERT_USER)) {
+			return false;
+		}
+	}
+
+	// 2. 존재 확인
+	sqlite3_stmt* stmt = GetStatement(SELECT_USER_ID);
+	if (nullptr == stmt) {
+		return false;
+	}
+
+	sqlite3_bind_int(stmt, 1, id);
+	bool found = (SQLITE_ROW == sqlite3_step(stmt));
+	sqlite3_reset(stmt);
+
+	return found;
+}
+
+bool SqliteStorage::GetUserInfo(const std::wstring& userID, UserData& outData)
+{
+	int id{ -1 };
+	if (not ParseUserID(userID, id)) {
+		return false;
+	}
+
+	sqlite3_stmt* stmt = GetStatement(SELECT_USER_INFO);
+	if (nullptr == stmt) {
+		return false;
+	}
+
+	sqlite3_bind_int(stmt, 1, id);
+
+	bool found{ false };
+	if (SQLITE_ROW == sqlite3_step(stmt)) {
+		outData.id = sqlite3_column_int(stmt, 0);
+		outData.level = sqlite3_column_int(stmt, 1);
+		outData.exp = sqlite3_column_int64(stmt, 2);
+		outData.hp = static_cast<short>(sqlite3_column_int(stmt, 3));
+		outData.maxHp = static_cast<short>(sqlite3_column_int(stmt, 4));
+		outData.x = static_cast<short>(sqlite3_column_int(stmt, 5));
+		outData.y = static_cast<short>(sqlite3_column_int(stmt, 6));
+		outData.partyId = sqlite3_column_int(stmt, 7);
+		found = true;
+	}
+
+	sqlite3_reset(stmt);
+	return found;
+}
+
+bool SqliteStorage::UpdateUserInfo(const UserData& userData)
+{
+	sqlite3_stmt* stmt = GetStatement(UPDATE_USER_INFO);
+	if (nullptr == stmt) {
+		return false;
+	}
+
+	sqlite3_bind_int(stmt, 1, userData.id);
+	sqlite3_bind_int(stmt, 2, userData.level);
+	sqlite3_bind_int64(stmt, 3, userData.exp);
+	sqlite3_bind_int(stmt, 4, userData.hp);
+	sqlite3_bind_int(stmt, 5, userData.maxHp);
+	sqlite3_bind_int(stmt, 6, userData.x);
+	sqlite3_bind_int(stmt, 7, userData.y);
+	sqlite3_bind_int(stmt, 8, userData.partyId);
+
+	return Step(stmt, UPDATE_USER_INFO);
+}
+
+std::vector<std::pair<int, int>> SqliteStorage::GetUserItems(const std::wstring& userID)
+{
+	std::vector<std::pair<int, int>> result;
+
+	int id{ -1 };
+	if (not ParseUserID(userID, id)) {
+		return result;
+	}
+
+	sqlite3_stmt* stmt = GetStatement(SELECT_USER_ITEMS);
+	if (nullptr == stmt) {
+		return result;
+	}
+
+	sqlite3_bind_int(stmt, 1, id);
+	while (SQLITE_ROW == sqlite3_step(stmt)) {
+		result.emplace_back(sqlite3_column_int(stmt, 0), sqlite3_column_int(stmt, 1));
+	}
+
+	sqlite3_reset(stmt);
+	return result;
+}
+
+bool SqliteStorage::UserGetItem(int userId, int itemId, int count)
+{
+	sqlite3_stmt* stmt = GetStatement(USER_GET_ITEM);
+	if (nullptr == stmt) {
+		return false;
+	}
+
+	sqlite3_bind_int(stmt, 1, userId);
+	sqlite3_bind_int(stmt, 2, itemId);
+	sqlite3_bind_int(stmt, 3, count);
+
+	return Step(stmt, USER_GET_ITEM);
+}
+
+bool SqliteStorage::UserUseItem(int userId, int itemId, int count)
+{
+	// 1. 보유 수량이 충분할 때만 차감
+	sqlite3_stmt* stmt = GetStatement(USER_USE_ITEM);
+	if (nullptr == stmt) {
+		return false;
+	}
+
+	sqlite3_bind_int(stmt, 1, userId);
+	sqlite3_bind_int(stmt, 2, itemId);
+	sqlite3_bind_int(stmt, 3, count);
+
+	if (not Step(stmt, USER_USE_ITEM)) {
+		return false;
+	}
+
+	if (0 == sqlite3_changes(t_connection.db)) {
+		return false;
+	}
+
+	// 2. 다 쓴 Item 행 삭제
+	sqlite3_stmt* cleanup = GetStatement(DELETE_EMPTY_ITEM);
+	if (nullptr == cleanup) {
+		return false;
+	}
+
+	sqlite3_bind_int(cleanup, 1, userId);
+	sqlite3_bind_int(cleanup, 2, itemId);
+
+	return Step(cleanup, DELETE_EMPTY_ITEM);
+}
+
+std::vector<QuestData> SqliteStorage::GetUserQuests(const std::wstring& userID)
+{
+	std::vector<QuestData> result;
+
+	int id{ -1 };
+	if (not ParseUserID(userID, id)) {
+		return result;
+	}
+
+	sqlite3_stmt* stmt = GetStatement(SELECT_USER_QUESTS);
+	if (nullptr == stmt) {
+		return result;
+	}
+
+	sqlite3_bind_int(stmt, 1, id);
+	while (SQLITE_ROW == sqlite3_step(stmt)) {
+		result.emplace_back(sqlite3_column_int(stmt, 0), sqlite3_column_int(stmt, 1));
+	}
+
+	sqlite3_reset(stmt);
+	return result;
+}
+
+bool SqliteStorage::UpdateUserQuests(int userId, const std::vector<QuestData>& quests)
+{
+	// 현재 진행 중인 Quest 목록으로 통째로 교체 (Transaction 하나)
+	if (not ExecuteStatement(BEGIN_TRANSACTION)) {
+		return false;
+	}
+
+	bool success{ false };
+
+	sqlite3_stmt* clear = GetStatement(DELETE_USER_QUESTS);
+	if (nullptr != clear) {
+		sqlite3_bind_int(clear, 1, userId);
+		success = Step(clear, DELETE_USER_QUESTS);
+	}
+
+	sqlite3_stmt* insert = GetStatement(INSERT_USER_QUEST);
+	for (const QuestData& quest : quests) {
+		if ((not success) or (nullptr == insert)) {
+			success = false;
+			break;
+		}
+
+		sqlite3_bind_int(insert, 1, userId);
+		sqlite3_bind_int(insert, 2, quest.questId);
+		sqlite3_bind_int(insert, 3, quest.progress);
+		success = Step(insert, INSERT_USER_QUEST);
+	}
+
+	if (not success) {
+		ExecuteStatement(ROLLBACK_TRANSACTION);
+		return false;
+	}
+
+	return ExecuteStatement(COMMIT_TRANSACTION);
+}
+
+void SqliteStorage::CloseThreadConnection()
+{
+	if (nullptr == t_connection.db) {
+		return;
+	}
+
+	for (sqlite3_stmt*& stmt : t_connection.statements) {
+		if (nullptr != stmt) {
+			sqlite3_finalize(stmt);
+			stmt = nullptr;
+		}
+	}
+
+	sqlite3_close(t_connection.db);
+	t_connection.db = nullptr;
+}
+
+bool SqliteStorage::Open(sqlite3*& outDb)
+{
+	// 연결은 Thread마다 따로 쓰므로 SQLite 내부 Mutex는 끔
+	int result = sqlite3_open_v2(_path.c_str(), &outDb,
+		SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX, nullptr);
+	if (SQLITE_OK != result) {
+		fprintf(stderr, "[SqliteStorage] Open %s failed : %s\n", _path.c_str(), sqlite3_errstr(result));
+		sqlite3_close(outDb);
+		outDb = nullptr;
+		return false;
+	}
+
+	// WAL : Reader가 Writer를 막지 않음, synchronous NORMAL은 WAL에서 Commit마다 fsync하지 않음
+	sqlite3_busy_timeout(outDb, BUSY_TIMEOUT_MS);
+	sqlite3_exec(outDb, "PRAGMA journal_mode = WAL; PRAGMA synchronous = NORMAL;", nullptr, nullptr, nullptr);
+
+	return true;
+}
+
+bool SqliteStorage::BootstrapSchema(sqlite3* db)
+{
+	char* error{ nullptr };
+	if (SQLITE_OK != sqlite3_exec(db, SCHEMA, nullptr, nullptr, &error)) {
+		fprintf(stderr, "[SqliteStorage] Schema bootstrap failed : %s\n", error);
+		sqlite3_free(error);
+		return false;
+	}
+
+	return true;
+}
+
+sqlite3_stmt* SqliteStorage::GetStatement(Statement id)
+{
+	// 1. 이 Thread의 연결이 없으면 새로 열기
+	if (nullptr == t_connection.db) {
+		if (not Open(t_connection.db)) {
+			return nullptr;
+		}
+	}
+
+	// 2. Prepare는 연결당 한 번
+	sqlite3_stmt*& stmt = t_connection.statements[id];
+	if (nullptr == stmt) {
+		if (SQLITE_OK != sqlite3_prepare_v3(t_connection.db, STATEMENT_QUERIES[id], -1, SQLITE_PREPARE_PERSISTENT, &stmt, nullptr)) {
+			fprintf(stderr, "[SqliteStorage] Prepare(%d) failed : %s\n", id, sqlite3_errmsg(t_connection.db));
+			stmt = nullptr;
+		}
+	}
+
+	return stmt;
+}
+
+bool SqliteStorage::Step(sqlite3_stmt* stmt, Statement id)
+{
+	int result = sqlite3_step(stmt);
+	sqlite3_reset(stmt);
+
+	if ((SQLITE_DONE != result) and (SQLITE_ROW != result)) {
+		fprintf(stderr, "[SqliteStorage] Step(%d) failed : %s\n", id, sqlite3_errmsg(t_connection.db));
+		return false;
+	}
+
+	return true;
+}
+
+bool SqliteStorage::ExecuteStatement(Statement id)
+{
+	sqlite3_stmt* stmt = GetStatement(id);
+	if (nullptr == stmt) {
+		return false;
+	}
+
+	return Step(stmt, id);
+}
+
+bool SqliteStorage::ParseUserID(const std::wstring& userID, int& outId)
+{
+	wchar_t* end{ nullptr };
+	long id = std::wcstol(userID.c_str(), &end, 10);
+
+	if (userID.empty() or (*end != L'\0')) {
+		fprintf(stderr, "[SqliteStorage] Invalid user id\n");
+		return false;
+	}
+
+	outId = static_cast<int>(id);
+	return true;
+}
+
+#endif
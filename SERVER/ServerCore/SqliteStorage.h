@@ -0,0 +1,83 @@
+#pragma once
+
+// SQLite(WAL) 저장소, MSSQL 없이 Server / 부하 Test를 돌리기 위한 Embedded Backend
+// Windows Server Build에서는 USE_SQLITE_STORAGE 정의 + sqlite3.h / sqlite3.lib가 있을 때만 사용
+// ServerCore pch 없이 Build되므로 (StorageBench) 표준 Header와 IStorage.h만 사용
+#ifdef USE_SQLITE_STORAGE
+
+#include <array>
+#include <string>
+
+#include <sqlite3.h>
+
+#include "IStorage.h"
+
+class SqliteStorage : public IStorage
+{
+	enum Statement : char {
+		SELECT_USER_ID,
+		INSERT_USER,
+		SELECT_USER_INFO,
+		UPDATE_USER_INFO,
+		SELECT_USER_ITEMS,
+		USER_GET_ITEM,
+		USER_USE_ITEM,
+		DELETE_EMPTY_ITEM,
+		SELECT_USER_QUESTS,
+		DELETE_USER_QUESTS,
+		INSERT_USER_QUEST,
+		BEGIN_TRANSACTION,
+		COMMIT_TRANSACTION,
+		ROLLBACK_TRANSACTION,
+		STATEMENT_COUNT
+	};
+
+	// Thread마다 따로 여는 연결과 Prepare된 Statement
+	struct ThreadConnection {
+		sqlite3* db{ nullptr };
+		std::array<sqlite3_stmt*, STATEMENT_COUNT> statements{};
+	};
+
+public:
+	// 처음 Login하는 ID를 기본값으로 생성 (부하 Test에서 계정을 미리 만들 필요 없음)
+	SqliteStorage(bool autoCreateUser = true);
+	virtual ~SqliteStorage();
+
+public:
+	// connection : DB File 경로, 없으면 Schema까지 생성
+	virtual bool Init(const std::string& connection) override;
+	virtual void Shutdown() override;
+
+	virtual bool CheckUserID(const std::wstring& userID) override;
+
+	virtual bool GetUserInfo(const std::wstring& userID, UserData& outData) override;
+	virtual bool UpdateUserInfo(const UserData& userData) override;
+
+	virtual std::vector<std::pair<int, int>> GetUserItems(const std::wstring& userID) override;
+	virtual bool UserGetItem(int userId, int itemId, int count) override;
+	virtual bool UserUseItem(int userId, int itemId, int count) override;
+
+	virtual std::vector<QuestData> GetUserQuests(const std::wstring& userID) override;
+	virtual bool UpdateUserQuests(int userId, const std::vector<QuestData>& quests) override;
+
+	virtual void CloseThreadConnection() override;
+
+private:
+	bool Open(sqlite3*& outDb);
+	bool BootstrapSchema(sqlite3* db);
+
+	sqlite3_stmt* GetStatement(Statement id);
+	bool Step(sqlite3_stmt* stmt, Statement id);
+	bool ExecuteStatement(Statement id);
+
+	static bool ParseUserID(const std::wstring& userID, int& outId);
+
+private:
+	std::string _path;
+	bool _autoCreateUser;
+
+	static thread_local ThreadConnection t_connection;
+	static const char* const STATEMENT_QUERIES[STATEMENT_COUNT];
+};
+
+#endif
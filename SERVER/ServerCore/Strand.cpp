@@ -0,0 +1,38 @@
+#include "pch.h"
+#include "Strand.h"
+
+thread_local Strand* Strand::t_current{ nullptr };
+
+bool Strand::Post(Job job)
+{
+	_mailbox.push(std::move(job));
+	return (_jobCount.fetch_add(1) == 0);
+}
+
+bool Strand::Drain(int maxCount)
+{
+	Strand* prev = t_current;
+	t_current = this;
+
+	bool remain{ true };
+	for (int i = 0; i < maxCount; ++i) {
+		// Post는 push 후에 count를 올리므로 count가 남아 있으면 Job도 반드시 보임
+		Job job;
+		if (not _mailbox.try_pop(job)) {
+			LOG_ERR("Strand mailbox empty while job count is %d", _jobCount.load());
+			break;
+		}
+
+		job();
+
+		if (_jobCount.fetch_sub(1) == 1) {
+			remain = false;
+			break;
+		}
+	}
+
+	t_current = prev;
+
+	// 한 Strand가 Worker를 독점하지 않도록 남은 Job은 다시 예약
+	return remain;
+}
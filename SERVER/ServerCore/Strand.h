@@ -0,0 +1,25 @@
+#pragma once
+
+// 한 Owner(Session 등)의 Job을 순서대로 하나씩만 실행하는 Mailbox
+// 실제 실행 Thread는 JobScheduler가 정하고, Strand는 동시에 두 Job이 돌지 않는 것만 보장
+class Strand
+{
+public:
+	static constexpr int MAX_DRAIN_COUNT{ 32 };
+
+public:
+	// 비어 있던 Strand에 처음 들어간 Job이면 true, 호출자가 Drain을 예약해야 함
+	bool Post(Job job);
+
+	// 최대 maxCount개의 Job 실행, 아직 남은 Job이 있으면 true
+	bool Drain(int maxCount = MAX_DRAIN_COUNT);
+
+public:
+	bool IsCurrent() const { return t_current == this; }
+
+private:
+	concurrency::concurrent_queue<Job> _mailbox;
+	std::atomic<int> _jobCount{ 0 };
+
+	static thread_local Strand* t_current;
+};
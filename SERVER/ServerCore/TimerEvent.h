@@ -0,0 +1,21 @@
+#pragma once
+
+enum EventType : char {
+	EV_NPC_TICK,
+	EV_HEAL,
+	EV_ATTACK,
+	EV_PLAYER_HEAL,
+	EV_PLAYER_RESPAWN
+};
+
+// Timer Thread의 concurrent_priority_queue에 들어가는 Event. wakeupTime이 빠른 것부터 pop
+struct Event {
+	int objId;
+	std::chrono::high_resolution_clock::time_point wakeupTime;
+	char eventId;
+	int targetId;
+
+	bool operator<(const Event& other) const {
+		return wakeupTime > other.wakeupTime;
+	}
+};
@@ -13,11 +13,11 @@ std::unordered_set<int> ViewListHelper::CollectViewList(const std::shared_ptr<Ga
 		return {};
 	}
 
-	// 1. self View Range ġ Sector ִ  client id 
+	// 1. self의 View Range가 걸치는 Sector에 있는 모든 client의 id 복사
 	std::unordered_set<int> targetViewList = service->collectVisibleObjects(self);
 	std::unordered_set<int> result;
 
-	// 2. Sector ȸϸ鼭  self View Rangeȿ ִ client id Search
+	// 2. Sector 순회하면서 실제 self의 View Range안에 있는 client의 id Search
 	for (int id : targetViewList) {
 		if (id == self->GetId()) continue;
 
@@ -44,24 +44,24 @@ ViewListDiff ViewListHelper::CalcViewListDiff(const std::unordered_set<int>& old
 {
 	ViewListDiff result;
 
-	// 1.   viewList ְ
+	// 1. 움직인 후 viewList에 있고
 	for (int id : newList) {
-		// ̱  viewList 
+		// 움직이기 전 viewList에는 없으면
 		if (not oldList.count(id)) {
 			// Add
 			result.addViewList.push_back(id);
 		}
 
-		// ̱  viewList ־
+		// 움직이기 전 viewList에도 있었으면
 		else {
 			// Move
 			result.moveViewList.push_back(id);
 		}
 	}
 
-	// 2. ̱  viewList ְ
+	// 2. 움직이기 전 viewList에 있고
 	for (int id : oldList) {
-		//   viewList 
+		// 움직인 후 viewList에는 없으면
 		if (not newList.count(id)) {
 			// Remove
 			result.removeViewList.push_back(id);
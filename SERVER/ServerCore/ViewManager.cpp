@@ -1,175 +1,121 @@
 #include "pch.h"
 #include "ViewManager.h"
 
-ViewManager::ViewManager(const std::shared_ptr<Service>& service) : _service(service)
+#undef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_VIEW
+
+ViewManager::ViewManager(const std::shared_ptr<Service>& service, int regionCountX, int regionCountY) : _service(service)
 {
+	_regionManager = std::make_unique<RegionManager>(regionCountX, regionCountY);
 }
 
-ViewListDiff ViewManager::SyncViewList(const std::shared_ptr<GameSession>& session) const
+ViewListDiff ViewManager::SyncViewList(const std::shared_ptr<GameSession>& session, std::unordered_set<int>&& newViewList) const
 {
-	ViewListDiff viewListDiff;
-
-	// 1. newViewList Get
-	std::unordered_set<int> newViewList = CollectViewList(session);
-
-	// 2. Session  viewList Get
-	const auto oldViewList = *(session->GetViewList());
+	PROFILE_ZONE("ViewManager::SyncViewList");
 
-	// 3. Add : newViewList - oldViewList
-	for (int id : newViewList) {
-		if (not oldViewList.contains(id)) {
-			viewListDiff.addViewList.push_back(id);
-		}
-	}
+	// 1. newViewList는 Region Thread에서 수집 (RequestPlayerView)
 
-	// 4. Remove : oldViewList - newViewList
-	for (int id : oldViewList) {
-		if (not newViewList.contains(id)) {
-			viewListDiff.removeViewList.push_back(id);
-		}
-
-		// 5. Move : oldViewList and newViewList
-		else {
-			viewListDiff.moveViewList.push_back(id);
-		}
-	}
+	// 2. Session의 기존 viewList와 Diff (Session Strand 안이므로 복사 없이 참조)
+	ViewListDiff viewListDiff = ViewQuery::Diff(session->GetViewList(), newViewList);
 
-	// 6. Session viewList Update
-	session->SetViewList(newViewList);
+	// 3. Session의 viewList Update
+	session->SetViewList(std::move(newViewList));
 	
 	return viewListDiff;
 }
 
 ViewListDiff ViewManager::SyncViewList(const std::unordered_set<int>& oldViewList, const std::unordered_set<int>& newViewList)
 {
-	ViewListDiff viewListDiff;
-
-	for (int id : newViewList) {
-		if (not oldViewList.contains(id)) {
-			viewListDiff.addViewList.push_back(id);
-		}
-	}
-
-	for (int id : oldViewList) {
-		if (not newViewList.contains(id)) {
-			viewListDiff.removeViewList.push_back(id);
-		}
-
-		else {
-			viewListDiff.moveViewList.push_back(id);
-		}
-	}
+	PROFILE_ZONE("ViewManager::SyncViewList");
 
-	return viewListDiff;
+	return ViewQuery::Diff(oldViewList, newViewList);
 }
 
 void ViewManager::HandlePlayerLoginNotify(const std::shared_ptr<GameSession>& session)
 {
+	PROFILE_ZONE("ViewManager::HandlePlayerLoginNotify");
+
 	auto service = _service.lock();
 	if (nullptr == service) {
 		return;
 	}
 
-	// 1. Login Player þ߿ ɸ Sector Range
-	auto [xRange, yRange] = Sector::GetSectorRange(session->GetX(), session->GetY());
+	// 1. Region Thread에서 주변 NPC WakeUp / 시야 수집
+	// 2. Session Strand에서 viewList 갱신 후 Add Packet Send
+	RequestPlayerView(session, WAKE_FORCE, [this, session](std::unordered_set<int>&& newViewList)
+		{
+			auto service = _service.lock();
+			if (nullptr == service) {
+				return;
+			}
 
-	// 2. ش Sector  NPC WakeUp
-	for (int sx = xRange.first; sx <= xRange.second; ++sx) {
-		for (int sy = yRange.first; sy <= yRange.second; ++sy) {
-			// 3. ش Sector Object List Get
-			std::unordered_set<int> sectorObjects;
-			_sectors[sx][sy].CollectObject(sectorObjects);
+			ViewListDiff viewListDiff = SyncViewList(session, std::move(newViewList));
 
-			for (int id : sectorObjects) {
+			for (int id : viewListDiff.addViewList) {
 				auto object = service->FindObject(id);
-				if ((nullptr != object) and (object->GetType() == ObjectType::MONSTER)) {
-					if (auto monster = static_pointer_cast<Monster>(object)) {
-						monster->WakeUp(true, session->GetId());
-					}
+				if (nullptr == object) continue;
 
-					else {
-						LOG_ERR("OnPlayerLogin FindObject failed");
-					}
+				auto symbol = service->GetQuestSymbol(session, object->GetId());
+				session->Send(PacketFactory::BuildAddPacket(*object, symbol));
+
+				if (object->GetType() == ObjectType::PLAYER) {
+					auto target = static_pointer_cast<GameSession>(object);
+					target->Send(PacketFactory::BuildAddPacket(*session));
 				}
 			}
-		}
-	}
-
-	ViewListDiff viewListDiff = SyncViewList(session);
-
-	for (int id : viewListDiff.addViewList) {
-		auto object = service->FindObject(id);
-		if (nullptr == object) continue;
-
-		auto symbol = service->GetQuestSymbol(session, object->GetId());
-		session->Send(PacketFactory::BuildAddPacket(*object, symbol));
-
-		if (object->GetType() == ObjectType::PLAYER) {
-			auto target = static_pointer_cast<GameSession>(object);
-			target->Send(PacketFactory::BuildAddPacket(*session));
-		}
-	}
+		});
 }
 
 void ViewManager::HandlePlayerMoveNotify(const std::shared_ptr<GameSession>& session)
 {
+	PROFILE_ZONE("ViewManager::HandlePlayerMoveNotify");
+
 	auto service = _service.lock();
 	if (nullptr == service) {
 		return;
 	}
 
-	// 1. Move Player þ߿ ɸ Sector Range
-	auto [xRange, yRange] = Sector::GetSectorRange(session->GetX(), session->GetY());
-
-	// 2. ش Sector  NPC WakeUp
-	for (int sx = xRange.first; sx <= xRange.second; ++sx) {
-		for (int sy = yRange.first; sy <= yRange.second; ++sy) {
-			// 3. ش Sector Object List Get
-			std::unordered_set<int> sectorObjects;
-			_sectors[sx][sy].CollectObject(sectorObjects);
-
-			for (int id : sectorObjects) {
-				auto object = service->FindObject(id);
-				if (object->GetType() == ObjectType::MONSTER) {
-					if (auto npc = static_pointer_cast<Monster>(object)) {
-						npc->WakeUp(false, session->GetId());
-					}
-
-					else {
-						LOG_ERR("OnPlayerLogin FindObject failed");
-					}
-				}
+	// 1. Region Thread에서 주변 NPC WakeUp / 시야 수집
+	// 2. Session Strand에서 Multicast. 결과가 돌아올 때는 다음 Move를 처리 중일 수 있으므로 move_time은 지금 값으로 전달
+	unsigned int moveTimeEcho = session->GetMoveTimeEcho();
+	RequestPlayerView(session, WAKE_NORMAL, [this, session, moveTimeEcho](std::unordered_set<int>&& newViewList)
+		{
+			if (auto service = _service.lock()) {
+				Multicast(session, service, std::move(newViewList), moveTimeEcho);
 			}
-		}
-	}
-
-	Multicast(session, service);
+		});
 }
 
 void ViewManager::HandlePlayerDeathNotify(const std::shared_ptr<GameSession>& session)
 {
+	PROFILE_ZONE("ViewManager::HandlePlayerDeathNotify");
+
 	auto service = _service.lock();
 	if (nullptr == service) {
 		return;
 	}
 
-	auto sector = Sector::GetSector(session->GetX(), session->GetY());
-
-	if (_sectors[sector.first][sector.second].Contains(session->GetId())) {
-		LeaveSector(session);
-	};
+	// Mirror의 Remove는 이미 없는 id면 무시하므로 소속 확인 없이 전달
+	LeaveSector(session);
 
-	std::unordered_set<int> candidates = CollectViewList(session);
+	// 주변 Player에게 Remove. 죽은 Player는 NPC를 깨우지 않음
+	RequestPlayerView(session, WAKE_NONE, [this, session](std::unordered_set<int>&& candidates)
+		{
+			auto service = _service.lock();
+			if (nullptr == service) {
+				return;
+			}
 
-	for (int id : candidates) {
-		auto object = service->FindObject(id);
+			for (int id : candidates) {
+				auto object = service->FindObject(id);
 
-		if ((nullptr != object) and (object->GetType() == ObjectType::PLAYER)) {
-			auto player = static_pointer_cast<GameSession>(object);
-			player->Send(PacketFactory::BuildRemovePacket(*session));
-			player->RemoveViewList(session->GetId());
-		}
-	}
+				if ((nullptr != object) and (object->GetType() == ObjectType::PLAYER)) {
+					auto player = static_pointer_cast<GameSession>(object);
+					player->Send(PacketFactory::BuildRemovePacket(*session));
+					player->Post([player, id = session->GetId()]() { player->RemoveViewList(id); });
+				}
+			}
+		});
 
 	session->Send(PacketFactory::BuildRemovePacket(*session));
 
@@ -181,6 +127,8 @@ void ViewManager::HandlePlayerDeathNotify(const std::shared_ptr<GameSession>& se
 
 void ViewManager::HandlePlayerReviveNotify(const std::shared_ptr<GameSession>& session)
 {
+	PROFILE_ZONE("ViewManager::HandlePlayerReviveNotify");
+
 	auto service = _service.lock();
 	if (nullptr == service) {
 		return;
@@ -192,52 +140,35 @@ void ViewManager::HandlePlayerReviveNotify(const std::shared_ptr<GameSession>& s
 
 	session->ClearViewList();
 
-	// 1. Sector 
+	// 1. Sector 갱신
 	EnterSector(session);
 
-	std::unordered_set<int> candidates = CollectViewList(session);
-
-	for (int id : candidates) {
-		auto object = service->FindObject(id);
-
-		if ((nullptr != object) and (object->GetType() == ObjectType::PLAYER)) {
-			auto player = static_pointer_cast<GameSession>(object);
-			player->Send(PacketFactory::BuildAddPacket(*session));
-			player->AddViewList(session->GetId());
-		}
-
-		char symbol = service->GetQuestSymbol(session, object->GetId());
-		session->Send(PacketFactory::BuildAddPacket(*object, symbol));
-		session->AddViewList(object->GetId());
-	}
-
-	session->Send(PacketFactory::BuildAddPacket(*session));
-	session->Send(PacketFactory::BuildStatChangePacket(*session));
-
-	// 1. Login Player þ߿ ɸ Sector Range
-	auto [xRange, yRange] = Sector::GetSectorRange(session->GetX(), session->GetY());
-
-	// 2. ش Sector  NPC WakeUp
-	for (int sx = xRange.first; sx <= xRange.second; ++sx) {
-		for (int sy = yRange.first; sy <= yRange.second; ++sy) {
-			// 3. ش Sector Object List Get
-			std::unordered_set<int> sectorObjects;
-			_sectors[sx][sy].CollectObject(sectorObjects);
+	// 2. Region Thread에서 주변 NPC WakeUp / 시야 수집, Session Strand에서 양쪽에 Add
+	RequestPlayerView(session, WAKE_FORCE, [this, session](std::unordered_set<int>&& candidates)
+		{
+			auto service = _service.lock();
+			if (nullptr == service) {
+				return;
+			}
 
-			for (int id : sectorObjects) {
+			for (int id : candidates) {
 				auto object = service->FindObject(id);
-				if (object->GetType() == ObjectType::MONSTER) {
-					if (auto npc = static_pointer_cast<Monster>(object)) {
-						npc->WakeUp(true, session->GetId());
-					}
+				if (nullptr == object) continue;
 
-					else {
-						LOG_ERR("OnPlayerRevive FindObject failed");
-					}
+				if (object->GetType() == ObjectType::PLAYER) {
+					auto player = static_pointer_cast<GameSession>(object);
+					player->Send(PacketFactory::BuildAddPacket(*session));
+					player->Post([player, id = session->GetId()]() { player->AddViewList(id); });
 				}
+
+				char symbol = service->GetQuestSymbol(session, object->GetId());
+				session->Send(PacketFactory::BuildAddPacket(*object, symbol));
+				session->AddViewList(object->GetId());
 			}
-		}
-	}
+
+			session->Send(PacketFactory::BuildAddPacket(*session));
+			session->Send(PacketFactory::BuildStatChangePacket(*session));
+		});
 
 	auto party = session->GetParty();
 	if (nullptr != party) {
@@ -247,24 +178,26 @@ void ViewManager::HandlePlayerReviveNotify(const std::shared_ptr<GameSession>& s
 
 void ViewManager::HandleNpcMove(const std::shared_ptr<Monster>& npc, int oldX, int oldY)
 {
+	PROFILE_ZONE("ViewManager::HandleNpcMove");
+
 	auto service = _service.lock();
 	if (nullptr == service) {
 		return;
 	}
 
-	// 1. ̵  viewList Get
-	auto oldViewList = CollectViewList(npc, oldX, oldY);
-	auto newViewList = CollectViewList(npc);
+	// 1. 이동 전후 viewList Get
+	// 한 Tick에 한 칸만 움직이므로 두 위치의 View Range 모두 현재 Region Mirror(소유 + Halo) 안
+	auto oldViewList = CollectRegionViewList(npc->GetId(), oldX, oldY);
+	auto newViewList = CollectRegionViewList(npc->GetId(), npc->GetX(), npc->GetY());
 
-	// 2. Sector 
+	// 2. Sector 갱신
+	// 이웃 Region 소유 Sector로 넘어가면 그 Region Mirror에도 Post, 다음 Tick은 NpcSystem::Schedule이
+	// 새 Sector Batch에 넣으므로 이후 이 NPC는 새 Region Thread가 처리 (Region 간 Handoff)
 	auto oldSector = Sector::GetSector(oldX, oldY);
 	auto newSector = Sector::GetSector(npc->GetX(), npc->GetY());
 
 	if (oldSector != newSector) {
-		if (_sectors[oldSector.first][oldSector.second].Contains(npc->GetId())) {
-			LeaveSector(npc, oldSector.first, oldSector.second);
-		}
-		EnterSector(npc);
+		MoveSector(npc, oldSector.first, oldSector.second, newSector.first, newSector.second);
 	}
 	
 	// 3. Packet Send
@@ -273,168 +206,217 @@ void ViewManager::HandleNpcMove(const std::shared_ptr<Monster>& npc, int oldX, i
 
 void ViewManager::HandleNpcDeath(const std::shared_ptr<Monster>& npc)
 {
-	auto service = _service.lock();
-	if (nullptr == service) {
-		return;
-	}
-	
-	auto sector = Sector::GetSector(npc->GetX(), npc->GetY());
+	PROFILE_ZONE("ViewManager::HandleNpcDeath");
+
+	// 죽은 NPC는 움직이지 않으므로 지금 위치의 소유 Region에서 처리
+	short x = npc->GetX();
+	short y = npc->GetY();
+	auto [sx, sy] = Sector::GetSector(x, y);
+
+	_regionManager->Run(sx, sy, [this, npc, x, y, sx, sy]()
+		{
+			auto service = _service.lock();
+			if (nullptr == service) {
+				return;
+			}
 
-	if (_sectors[sector.first][sector.second].Contains(npc->GetId())) {
-		LeaveSector(npc);
-	};
+			// 1. Sector 갱신
+			_regionManager->NotifyLeave(npc->GetId(), sx, sy);
 
-	std::unordered_set<int> candidates = CollectViewList(npc);
+			// 2. 주변 Player에게 Remove
+			std::unordered_set<int> candidates = CollectRegionViewList(npc->GetId(), x, y);
 
-	for (int id : candidates) {
-		auto object = service->FindObject(id);
+			for (int id : candidates) {
+				auto object = service->FindObject(id);
 
-		if (object->GetType() == ObjectType::PLAYER) {
-			auto player = static_pointer_cast<GameSession>(object);
-			player->Send(PacketFactory::BuildRemovePacket(*npc));
-			player->RemoveViewList(npc->GetId());
-		}
-	}
+				if ((nullptr != object) and (object->GetType() == ObjectType::PLAYER)) {
+					auto player = static_pointer_cast<GameSession>(object);
+					player->Send(PacketFactory::BuildRemovePacket(*npc));
+					player->Post([player, id = npc->GetId()]() { player->RemoveViewList(id); });
+				}
+			}
+		});
 }
 
 void ViewManager::HandleNpcRevive(const std::shared_ptr<Monster>& npc)
 {
-	auto service = _service.lock();
-	if (nullptr == service) {
-		return;
-	}
+	PROFILE_ZONE("ViewManager::HandleNpcRevive");
+
+	// 부활 위치(Default 위치)의 소유 Region에서 처리
+	short x = npc->GetX();
+	short y = npc->GetY();
+	auto [sx, sy] = Sector::GetSector(x, y);
+
+	_regionManager->Run(sx, sy, [this, npc, x, y, sx, sy]()
+		{
+			auto service = _service.lock();
+			if (nullptr == service) {
+				return;
+			}
 
-	// 1. Sector 
-	EnterSector(npc);
+			// 1. Sector 갱신
+			_regionManager->NotifyEnter(npc->GetId(), sx, sy);
 
-	std::unordered_set<int> candidates = CollectViewList(npc);
+			// 2. 주변 Player에게 Add
+			std::unordered_set<int> candidates = CollectRegionViewList(npc->GetId(), x, y);
 
-	for (int id : candidates) {
-		auto object = service->FindObject(id);
+			for (int id : candidates) {
+				auto object = service->FindObject(id);
 
-		if (object->GetType() == ObjectType::PLAYER) {
-			auto player = static_pointer_cast<GameSession>(object);
-			player->Send(PacketFactory::BuildAddPacket(*npc));
-			player->AddViewList(npc->GetId());
-		}
-	}
+				if ((nullptr != object) and (object->GetType() == ObjectType::PLAYER)) {
+					auto player = static_pointer_cast<GameSession>(object);
+					player->Send(PacketFactory::BuildAddPacket(*npc));
+					player->Post([player, id = npc->GetId()]() { player->AddViewList(id); });
+				}
+			}
+		});
 }
 
 void ViewManager::EnterSector(const std::shared_ptr<GameObject>& object)
 {
 	auto [sx, sy] = Sector::GetSector(object->GetX(), object->GetY());
-	_sectors[sx][sy].AddObject(object->GetId());
+	EnterSector(object, sx, sy);
 }
 
 void ViewManager::LeaveSector(const std::shared_ptr<GameObject>& object)
 {
 	auto [sx, sy] = Sector::GetSector(object->GetX(), object->GetY());
-	_sectors[sx][sy].RemoveObject(object->GetId());
+	LeaveSector(object, sx, sy);
 }
 
 void ViewManager::EnterSector(const std::shared_ptr<GameObject>& object, int sx, int sy)
 {
-	_sectors[sx][sy].AddObject(object->GetId());
+	_regionManager->NotifyEnter(object->GetId(), sx, sy);
 }
 
 void ViewManager::LeaveSector(const std::shared_ptr<GameObject>& object, int sx, int sy)
 {
-	_sectors[sx][sy].RemoveObject(object->GetId());
+	_regionManager->NotifyLeave(object->GetId(), sx, sy);
 }
 
-std::unordered_set<int> ViewManager::CollectVisibleObjects(const std::shared_ptr<GameObject>& object) const
+void ViewManager::MoveSector(const std::shared_ptr<GameObject>& object, int oldSx, int oldSy, int newSx, int newSy)
 {
-	auto [xRange, yRange] = Sector::GetSectorRange(object->GetX(), object->GetY());
-	std::unordered_set<int> result;
+	_regionManager->NotifyMove(object->GetId(), oldSx, oldSy, newSx, newSy);
+}
 
-	for (int sx = xRange.first; sx <= xRange.second; ++sx) {
-		for (int sy = yRange.first; sy <= yRange.second; ++sy) {
-			_sectors[sx][sy].CollectObject(result);
-		}
+void ViewManager::EnterSectors(const std::vector<std::shared_ptr<Monster>>& monsters)
+{
+	// [sx * SECTOR_COUNT + sy]
+	std::vector<std::vector<int>> sectorIds(SECTOR_COUNT * SECTOR_COUNT);
+	for (const auto& monster : monsters) {
+		auto [sx, sy] = Sector::GetSector(monster->GetX(), monster->GetY());
+		sectorIds[sx * SECTOR_COUNT + sy].push_back(monster->GetId());
 	}
 
-	return result;
+	for (int sx = 0; sx < SECTOR_COUNT; ++sx) {
+		for (int sy = 0; sy < SECTOR_COUNT; ++sy) {
+			std::vector<int>& ids = sectorIds[sx * SECTOR_COUNT + sy];
+			if (ids.empty()) continue;
+
+			_regionManager->NotifyEnter(std::move(ids), sx, sy);
+		}
+	}
 }
 
-std::unordered_set<int> ViewManager::CollectViewList(const std::shared_ptr<GameObject>& object) const
+std::unordered_set<int> ViewManager::CollectRegionViewList(int selfId, int x, int y) const
 {
+	PROFILE_ZONE("ViewManager::CollectRegionViewList");
+
 	auto service = _service.lock();
 	if (nullptr == service) {
 		return {};
 	}
 
-	// 1. self View Range ġ Sector ִ  client id 
-	std::unordered_set<int> targetViewList = CollectVisibleObjects(object);
-	std::unordered_set<int> result;
-
-	// 2. Sector ȸϸ鼭  self View Rangeȿ ִ client id Search
-	for (int id : targetViewList) {
-		if (id == object->GetId()) continue;
-
-		GameObjectPtr target = service->FindObject(id);
-		if (nullptr == target) continue;
-		if (not target->IsVisible()) continue;
-		if (not target->IsAlive()) continue;
-		if (CanSee(object, target)) {
-			result.insert(id);
-		}
+	Region* region = Region::GetCurrent();
+	if (nullptr == region) {
+		LOG_ERR("CollectRegionViewList called outside region thread (%d, %d)", x, y);
+		return {};
 	}
 
-	return result;
+	// 1. (x, y)의 View Range가 걸치는 Sector에 있는 모든 Object의 id를 Mirror에서 복사
+	// 2. 그중 실제 (x, y)의 View Range 안에 있는 Object만 남김
+	auto [xRange, yRange] = Sector::GetSectorRange(x, y);
+	return ViewQuery::FilterInView(region->CollectSectorObjects(xRange, yRange), selfId, x, y,
+		[this, &service](int id, short& tx, short& ty) { return LookupVisible(service, id, tx, ty); });
 }
 
-std::unordered_set<int> ViewManager::CollectVisibleObjects(int x, int y) const
+std::unordered_set<int> ViewManager::CollectRegionObjects(int sx, int sy, int radius) const
 {
-	auto [xRange, yRange] = Sector::GetSectorRange(x, y);
-	std::unordered_set<int> result;
-
-	for (int sx = xRange.first; sx <= xRange.second; ++sx) {
-		for (int sy = yRange.first; sy <= yRange.second; ++sy) {
-			_sectors[sx][sy].CollectObject(result);
-		}
-	}
-
-	return result;
+	// Region Thread 전용 Mirror를 Lock 없이 읽음
+	return _regionManager->GetRegion(sx, sy).CollectSectorObjects(sx, sy, radius);
 }
 
-std::unordered_set<int> ViewManager::CollectViewList(const std::shared_ptr<GameObject>& object, int x, int y) const
+void ViewManager::RequestPlayerView(const std::shared_ptr<GameSession>& session, ViewWakeUp wakeUp, ViewResultHandler onResult)
 {
-	auto service = _service.lock();
-	if (nullptr == service) {
-		return {};
-	}
+	// 요청 시점의 위치로 수집. 이동 한 칸마다 요청하므로 Player 위치는 항상 소유 Region 또는 Halo 안쪽 가장자리
+	short x = session->GetX();
+	short y = session->GetY();
+	auto [sx, sy] = Sector::GetSector(x, y);
+	unsigned int seq = session->NextViewRequest();
+
+	Region* region = &_regionManager->GetRegion(sx, sy);
+	region->Post([this, region, session, x, y, wakeUp, seq, onResult = std::move(onResult)]() mutable
+		{
+			PROFILE_ZONE("ViewManager::CollectPlayerView");
+
+			auto service = _service.lock();
+			if (nullptr == service) {
+				return;
+			}
 
-	// 1. self View Range ġ Sector ִ  client id 
-	std::unordered_set<int> targetViewList = CollectVisibleObjects(x, y);
-	std::unordered_set<int> result;
+			// 1. 시야에 걸리는 Sector의 Object를 Region Mirror에서 Lock 없이 수집
+			auto [xRange, yRange] = Sector::GetSectorRange(x, y);
+			std::unordered_set<int> sectorObjects = region->CollectSectorObjects(xRange, yRange);
+
+			// 2. NPC WakeUp, 실제 View Range 안의 Object만 남김
+			std::unordered_set<int> viewList = ViewQuery::FilterInView(sectorObjects, session->GetId(), x, y,
+				[&service, &session, wakeUp](int id, short& tx, short& ty)
+				{
+					GameObjectPtr target = service->FindObject(id);
+					if (nullptr == target) {
+						return false;
+					}
 
-	// 2. Sector ȸϸ鼭  self View Rangeȿ ִ client id Search
-	for (int id : targetViewList) {
-		if (id == object->GetId()) continue;
+					if ((WAKE_NONE != wakeUp) and (target->GetType() == ObjectType::MONSTER)) {
+						static_pointer_cast<Monster>(target)->WakeUp(WAKE_FORCE == wakeUp, session->GetId());
+					}
 
-		GameObjectPtr target = service->FindObject(id);
-		if (nullptr == target) continue;
-		if (not target->IsVisible()) continue;
-		if (not target->IsAlive()) continue;
-		if (CanSee(object, target)) {
-			result.insert(id);
-		}
-	}
+					tx = target->GetX();
+					ty = target->GetY();
+					return target->IsVisible() and target->IsAlive();
+				});
+
+			// 3. viewList는 Session Strand 소유이므로 결과 적용은 Strand에서
+			session->Post([session, seq, viewList = std::move(viewList), onResult = std::move(onResult)]() mutable
+				{
+					if ((ST_INGAME != session->GetState()) or (not session->AcceptViewResult(seq))) {
+						return;
+					}
 
-	return result;
+					onResult(std::move(viewList));
+				});
+		});
 }
 
-bool ViewManager::CanSee(const std::shared_ptr<GameObject>& self, const std::shared_ptr<GameObject>& target) const
+bool ViewManager::LookupVisible(const std::shared_ptr<Service>& service, int id, short& x, short& y) const
 {
-	if (abs(self->GetX() - target->GetX()) > VIEW_RANGE) return false;
-	return abs(self->GetY() - target->GetY()) <= VIEW_RANGE;
+	GameObjectPtr target = service->FindObject(id);
+	if ((nullptr == target) or (not target->IsVisible()) or (not target->IsAlive())) {
+		return false;
+	}
+
+	x = target->GetX();
+	y = target->GetY();
+	return true;
 }
 
-void ViewManager::Multicast(const std::shared_ptr<GameSession>& session, const std::shared_ptr<Service>& service)
+void ViewManager::Multicast(const std::shared_ptr<GameSession>& session, const std::shared_ptr<Service>& service, std::unordered_set<int>&& newViewList, unsigned int moveTimeEcho)
 {
-	ViewListDiff viewListDiff = SyncViewList(session);
+	PROFILE_ZONE("ViewManager::Multicast");
 
-	session->Send(PacketFactory::BuildMovePacket(*session));
+	ViewListDiff viewListDiff = SyncViewList(session, std::move(newViewList));
+
+	session->Send(PacketFactory::BuildMovePacket(*session, moveTimeEcho));
 
 	for (int id : viewListDiff.addViewList) {
 		auto object = service->FindObject(id);
@@ -476,6 +458,8 @@ void ViewManager::Multicast(const std::shared_ptr<GameSession>& session, const s
 
 void ViewManager::Multicast(const std::unordered_set<int>& oldViewList, const std::unordered_set<int>& newViewList, const std::shared_ptr<GameObject>& npc, const std::shared_ptr<Service>& service)
 {
+	PROFILE_ZONE("ViewManager::Multicast");
+
 	ViewListDiff viewListDiff = SyncViewList(oldViewList, newViewList);
 
 	for (int id : viewListDiff.addViewList) {
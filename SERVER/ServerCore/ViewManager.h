@@ -1,23 +1,27 @@
 #pragma once
 
-struct ViewListDiff {
-	std::vector<int> addViewList;
-	std::vector<int> moveViewList;
-	std::vector<int> removeViewList;
-};
-
-class Sector;
 class Service;
 class GameSession;
 class Monster;
+class RegionManager;
+
+// RequestPlayerView에서 시야 안 NPC를 깨우는 방식 (Monster::WakeUp의 force)
+enum ViewWakeUp : char {
+	WAKE_NONE,
+	WAKE_NORMAL,
+	WAKE_FORCE,
+};
+
+// Region Thread에서 수집한 시야 목록을 Session Strand에서 받음
+using ViewResultHandler = std::function<void(std::unordered_set<int>&&)>;
 
 class ViewManager
 {
 public:
-	ViewManager(const std::shared_ptr<Service>& service);
+	ViewManager(const std::shared_ptr<Service>& service, int regionCountX, int regionCountY);
 	~ViewManager() = default;
 
-	ViewListDiff SyncViewList(const std::shared_ptr<GameSession>& session) const;
+	ViewListDiff SyncViewList(const std::shared_ptr<GameSession>& session, std::unordered_set<int>&& newViewList) const;
 	ViewListDiff SyncViewList(const std::unordered_set<int>& oldViewList, const std::unordered_set<int>& newViewList);
 
 	void HandlePlayerLoginNotify(const std::shared_ptr<GameSession>& session);
@@ -25,26 +29,39 @@ public:
 	void HandlePlayerDeathNotify(const std::shared_ptr<GameSession>& session);
 	void HandlePlayerReviveNotify(const std::shared_ptr<GameSession>& session);
 
+	// NPC 이동은 이동 전 Sector를 소유한 Region Thread에서 호출 (NPC Tick)
+	// Death / Revive는 어느 Thread에서든 호출, NPC가 있는 Sector의 소유 Region에서 처리
 	void HandleNpcMove(const std::shared_ptr<Monster>& npc, int oldX, int oldY);
 	void HandleNpcDeath(const std::shared_ptr<Monster>& npc);
 	void HandleNpcRevive(const std::shared_ptr<Monster>& npc);
 
+	// Sector 소속은 Region Mirror에만 있음. 소유 Region과 Halo로 보는 Region에 전달
 	void EnterSector(const std::shared_ptr<GameObject>& object);
 	void LeaveSector(const std::shared_ptr<GameObject>& object);
 	void EnterSector(const std::shared_ptr<GameObject>& object, int sx, int sy);
 	void LeaveSector(const std::shared_ptr<GameObject>& object, int sx, int sy);
+	void MoveSector(const std::shared_ptr<GameObject>& object, int oldSx, int oldSy, int newSx, int newSy);
+
+	// 초기 Spawn용 : Sector별로 모아서 Region Job을 Sector마다 한 번씩만 사용
+	void EnterSectors(const std::vector<std::shared_ptr<Monster>>& monsters);
+
+	// Region Thread 전용 : 호출 Thread의 Region Mirror(소유 + Halo)에서 Lock 없이 수집
+	std::unordered_set<int> CollectRegionViewList(int selfId, int x, int y) const;
+	std::unordered_set<int> CollectRegionObjects(int sx, int sy, int radius) const;
+
+	// Player 시야는 Player가 있는 Sector를 소유한 Region Thread가 Mirror에서 수집 (전역 Sector Lock 없음)
+	// 결과는 Session Strand에서 onResult로 전달, 이미 더 최신 결과를 적용했거나 Session이 Game을 떠났으면 버림
+	void RequestPlayerView(const std::shared_ptr<GameSession>& session, ViewWakeUp wakeUp, ViewResultHandler onResult);
 
-	std::unordered_set<int> CollectVisibleObjects(const std::shared_ptr<GameObject>& object) const;
-	std::unordered_set<int> CollectViewList(const std::shared_ptr<GameObject>& object) const;
-	std::unordered_set<int> CollectVisibleObjects(int x, int y) const;
-	std::unordered_set<int> CollectViewList(const std::shared_ptr<GameObject>& object, int x, int y) const;
+	RegionManager& GetRegionManager() { return *_regionManager; }
 
 private:
-	std::array<std::array<Sector, SECTOR_COUNT>, SECTOR_COUNT> _sectors;
+	std::unique_ptr<RegionManager> _regionManager;
 	std::weak_ptr<Service> _service;
 
-	bool CanSee(const std::shared_ptr<GameObject>& self, const std::shared_ptr<GameObject>& target) const;
-	void Multicast(const std::shared_ptr<GameSession>& session, const std::shared_ptr<Service>& service);
+	// FindObject로 찾은 Object가 보일 수 있으면 위치를 채움 (ViewQuery::FilterInView의 lookup)
+	bool LookupVisible(const std::shared_ptr<Service>& service, int id, short& x, short& y) const;
+	void Multicast(const std::shared_ptr<GameSession>& session, const std::shared_ptr<Service>& service, std::unordered_set<int>&& newViewList, unsigned int moveTimeEcho);
 	void Multicast(const std::unordered_set<int>& oldViewList, const std::unordered_set<int>& newViewList, const std::shared_ptr<GameObject>& npc, const std::shared_ptr<Service>& service);
 
 };
\ No newline at end of file
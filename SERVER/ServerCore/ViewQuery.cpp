@@ -0,0 +1,39 @@
+#include "pch.h"
+#include "ViewQuery.h"
+
+std::unordered_set<int> ViewQuery::CollectSectorObjects(const SectorGrid& sectors, int x, int y)
+{
+	auto [xRange, yRange] = Sector::GetSectorRange(x, y);
+	std::unordered_set<int> result;
+
+	for (int sx = xRange.first; sx <= xRange.second; ++sx) {
+		for (int sy = yRange.first; sy <= yRange.second; ++sy) {
+			sectors[sx][sy].CollectObject(result);
+		}
+	}
+
+	return result;
+}
+
+ViewListDiff ViewQuery::Diff(const std::unordered_set<int>& oldViewList, const std::unordered_set<int>& newViewList)
+{
+	ViewListDiff viewListDiff;
+
+	for (int id : newViewList) {
+		if (not oldViewList.contains(id)) {
+			viewListDiff.addViewList.push_back(id);
+		}
+	}
+
+	for (int id : oldViewList) {
+		if (not newViewList.contains(id)) {
+			viewListDiff.removeViewList.push_back(id);
+		}
+
+		else {
+			viewListDiff.moveViewList.push_back(id);
+		}
+	}
+
+	return viewListDiff;
+}
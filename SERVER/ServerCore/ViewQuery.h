@@ -0,0 +1,46 @@
+#pragma once
+
+using SectorGrid = std::array<std::array<Sector, SECTOR_COUNT>, SECTOR_COUNT>;
+
+struct ViewListDiff {
+	std::vector<int> addViewList;
+	std::vector<int> moveViewList;
+	std::vector<int> removeViewList;
+};
+
+// 시야 계산 중 Object 종류와 상관없는 부분 (Sector 순회, View Range 판정, viewList Diff)
+// Windows 의존이 없어서 SERVERCORE_PORTABLE 빌드(MicroBench)도 ViewManager와 같은 코드를 측정
+class ViewQuery
+{
+public:
+	// (x, y)의 시야가 걸치는 Sector의 Object 전부
+	static std::unordered_set<int> CollectSectorObjects(const SectorGrid& sectors, int x, int y);
+
+	// candidates 중 (x, y)에서 보이는 Object만 남김
+	// lookup(id, tx, ty) : 보일 수 있는 Object(존재, Visible, 살아 있음)면 위치를 채우고 true
+	template<typename Lookup>
+	static std::unordered_set<int> FilterInView(const std::unordered_set<int>& candidates, int selfId, int x, int y, Lookup&& lookup)
+	{
+		std::unordered_set<int> result;
+
+		for (int id : candidates) {
+			if (id == selfId) continue;
+
+			short tx, ty;
+			if (not lookup(id, tx, ty)) continue;
+			if (InViewRange(x, y, tx, ty)) {
+				result.insert(id);
+			}
+		}
+
+		return result;
+	}
+
+	static bool InViewRange(int x, int y, int tx, int ty)
+	{
+		return (std::abs(x - tx) <= VIEW_RANGE) and (std::abs(y - ty) <= VIEW_RANGE);
+	}
+
+	// Add : new - old, Remove : old - new, Move : old and new
+	static ViewListDiff Diff(const std::unordered_set<int>& oldViewList, const std::unordered_set<int>& newViewList);
+};
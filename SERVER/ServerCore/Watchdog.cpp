@@ -0,0 +1,182 @@
+#include "pch.h"
+#include "Watchdog.h"
+
+#include <fstream>
+
+namespace
+{
+	long long ToMs(long long ns)
+	{
+		return ns / 1'000'000;
+	}
+
+	// 누적 Histogram 두 개의 차이로 직전 검사 구간의 분포만 계산
+	MetricSummary GetWindow(const MetricSummary& current, const MetricSummary& previous)
+	{
+		MetricSummary window;
+		for (int i = 0; i < METRIC_BUCKET_COUNT; ++i) {
+			window.buckets[i] = (current.buckets[i] > previous.buckets[i]) ? (current.buckets[i] - previous.buckets[i]) : 0;
+			if (window.buckets[i] > 0) {
+				window.max = MetricHistogram::GetBucketUpperBound(i);
+			}
+		}
+
+		window.count = (current.count > previous.count) ? (current.count - previous.count) : 0;
+		window.sum = (current.sum > previous.sum) ? (current.sum - previous.sum) : 0;
+		return window;
+	}
+}
+
+void Watchdog::RegisterWorker(const std::string& name)
+{
+	auto slot = std::make_unique<WatchdogSlot>();
+	slot->name = name;
+	slot->heartbeatNs.store(Now());
+
+	WatchdogSlot* raw = slot.get();
+	{
+		std::lock_guard lock{ _slotsLock };
+		_slots.push_back(std::move(slot));
+	}
+
+	_threadSlot = raw;
+}
+
+void Watchdog::UnregisterWorker()
+{
+	if (WatchdogSlot* slot = _threadSlot) {
+		slot->active.store(false);
+		_threadSlot = nullptr;
+	}
+}
+
+void Watchdog::Start(const std::string& path, const WatchdogConfig& config, MetricGaugeProvider queueProvider)
+{
+	Stop();
+
+	{
+		std::lock_guard lock{ _watchLock };
+		_watchStop = false;
+	}
+	_watchThread = std::thread(&Watchdog::WatchThread, path, config, std::move(queueProvider));
+}
+
+void Watchdog::Stop()
+{
+	{
+		std::lock_guard lock{ _watchLock };
+		_watchStop = true;
+	}
+	_watchCv.notify_all();
+
+	if (_watchThread.joinable()) {
+		_watchThread.join();
+	}
+}
+
+void Watchdog::WatchThread(std::string path, WatchdogConfig config, MetricGaugeProvider queueProvider)
+{
+	Profiler::SetThreadName("Watchdog");
+
+	MetricSummary previousLag;
+	previousLag.Merge(_timerLag);
+
+	long long lastReportNs{ 0 };
+	unsigned long long reportCount{ 0 };
+
+	std::unique_lock lock{ _watchLock };
+	while (not _watchStop) {
+		_watchCv.wait_for(lock, std::chrono::milliseconds(config.checkIntervalMs), []() { return _watchStop; });
+		if (_watchStop) {
+			break;
+		}
+		lock.unlock();
+
+		long long now = Now();
+		std::vector<std::string> reasons;
+
+		// 1. Timer 지연 분포 (직전 검사 구간)
+		MetricSummary currentLag;
+		currentLag.Merge(_timerLag);
+		MetricSummary lag = GetWindow(currentLag, previousLag);
+		previousLag = currentLag;
+
+		unsigned long long lagP99 = lag.GetPercentile(99.0);
+		if (static_cast<long long>(lagP99) > config.timerLagP99Us) {
+			reasons.push_back("timer_lag");
+		}
+
+		// 2. Queue 길이
+		MetricGauges queues;
+		if (queueProvider) {
+			queueProvider(queues);
+		}
+
+		for (const auto& [name, depth] : queues) {
+			if (depth > config.queueDepthLimit) {
+				reasons.push_back("queue:" + name);
+			}
+		}
+
+		// 3. Worker Heartbeat, Idle 상태인 Worker는 기다리는 중이므로 제외
+		std::string workers;
+		{
+			std::lock_guard slotsLock{ _slotsLock };
+			for (auto& slot : _slots) {
+				if (not slot->active.load()) continue;
+
+				bool idle = slot->idle.load(std::memory_order_relaxed);
+				long long heartbeatAgeMs = ToMs(now - slot->heartbeatNs.load(std::memory_order_relaxed));
+				const char* handler = slot->handler.load(std::memory_order_relaxed);
+				long long handlerMs = (nullptr != handler) ? ToMs(now - slot->handlerStartNs.load(std::memory_order_relaxed)) : 0;
+
+				if ((not idle) and (heartbeatAgeMs > config.heartbeatStallMs)) {
+					reasons.push_back("stall:" + slot->name);
+				}
+
+				if (not workers.empty()) workers += ',';
+				workers += "{\"name\":\"" + slot->name + "\",\"idle\":" + (idle ? "true" : "false")
+					+ ",\"heartbeatAgeMs\":" + std::to_string(heartbeatAgeMs)
+					+ ",\"handler\":" + ((nullptr != handler) ? ("\"" + std::string{ handler } + "\"") : std::string{ "null" })
+					+ ",\"handlerMs\":" + std::to_string(handlerMs) + '}';
+			}
+		}
+
+		lock.lock();
+
+		if (reasons.empty() or ((0 != lastReportNs) and (ToMs(now - lastReportNs) < config.reportCooldownMs))) {
+			continue;
+		}
+		lastReportNs = now;
+		++reportCount;
+
+		// 4. Stall Report 한 줄
+		// {"time":..,"reasons":[..],"timerLagUs":{..},"queues":{..},"workers":[..]}
+		std::string out = "{\"time\":" + std::to_string(std::time(nullptr)) + ",\"report\":" + std::to_string(reportCount) + ",\"reasons\":[";
+		for (size_t i = 0; i < reasons.size(); ++i) {
+			if (i > 0) out += ',';
+			out += '"' + reasons[i] + '"';
+		}
+
+		out += "],\"timerLagUs\":{\"count\":" + std::to_string(lag.count)
+			+ ",\"p50\":" + std::to_string(lag.GetPercentile(50.0))
+			+ ",\"p99\":" + std::to_string(lagP99)
+			+ ",\"max\":" + std::to_string(lag.max) + "},\"queues\":{";
+
+		for (size_t i = 0; i < queues.size(); ++i) {
+			if (i > 0) out += ',';
+			out += '"' + queues[i].first + "\":" + std::to_string(queues[i].second);
+		}
+		out += "},\"workers\":[" + workers + "]}";
+
+		std::ofstream ofs{ path, std::ios::app };
+		if (ofs) {
+			ofs << out << '\n';
+		}
+		else {
+			LOG_WRN("Watchdog report open failed: %s", path);
+		}
+
+		LOG_WRN("Watchdog stall report #%llu (%s, timer lag p99 %llu us) written to %s", reportCount, reasons.front(), lagP99, path);
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Metrics.h"
+
+// Watchdog 판정 기준. 한 번 보고한 뒤 reportCooldownMs 동안은 다시 보고하지 않음
+struct WatchdogConfig {
+	int checkIntervalMs{ 500 };
+	int heartbeatStallMs{ 2000 };		// 일하는 중인 Worker가 이 시간 넘게 다음 Job으로 못 넘어가면 Stall
+	long long timerLagP99Us{ 100000 };	// 직전 검사 구간의 Timer 지연 p99
+	long long queueDepthLimit{ 10000 };	// Queue Provider가 알려준 Queue 하나의 길이
+	int reportCooldownMs{ 10000 };
+};
+
+// Worker Thread 하나의 상태. 소유 Thread만 쓰고 Watchdog Thread는 읽기만 함
+// 한 번 등록되면 Thread가 끝나도 해제하지 않고 active만 내림 (Metrics Shard와 같은 방식)
+struct WatchdogSlot {
+	std::string name;
+
+	std::atomic<bool> active{ true };
+	std::atomic<bool> idle{ true };
+	std::atomic<long long> heartbeatNs{ 0 };
+
+	// 실행 중인 가장 안쪽 PROFILE_ZONE 이름과 시작 시각
+	std::atomic<const char*> handler{ nullptr };
+	std::atomic<long long> handlerStartNs{ 0 };
+};
+
+class Watchdog
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+public:
+	// 감시할 Thread가 시작할 때 / 끝날 때 호출
+	static void RegisterWorker(const std::string& name);
+	static void UnregisterWorker();
+
+	// Job 하나를 시작할 때 Heartbeat, Job을 기다리며 잠들기 전에 Idle
+	static void Heartbeat()
+	{
+		if (WatchdogSlot* slot = _threadSlot) {
+			slot->heartbeatNs.store(Now(), std::memory_order_relaxed);
+			slot->idle.store(false, std::memory_order_relaxed);
+		}
+	}
+
+	static void Idle()
+	{
+		if (WatchdogSlot* slot = _threadSlot) {
+			slot->heartbeatNs.store(Now(), std::memory_order_relaxed);
+			slot->idle.store(true, std::memory_order_relaxed);
+		}
+	}
+
+	static WatchdogSlot* GetSlot() { return _threadSlot; }
+	static long long Now() { return Clock::now().time_since_epoch().count(); }
+
+	// Timer Thread에서만 호출 (Event 예정 시각 ~ 실제 처리 시각)
+	static void RecordTimerLag(long long lagUs) { _timerLag.Record(static_cast<unsigned long long>(std::max(0LL, lagUs))); }
+
+public:
+	// checkIntervalMs마다 검사하고 기준을 넘으면 path에 Stall Report를 JSON 한 줄로 추가
+	static void Start(const std::string& path, const WatchdogConfig& config, MetricGaugeProvider queueProvider);
+	static void Stop();
+
+private:
+	static void WatchThread(std::string path, WatchdogConfig config, MetricGaugeProvider queueProvider);
+
+private:
+	static inline thread_local WatchdogSlot*					_threadSlot{ nullptr };
+	static inline std::mutex									_slotsLock;
+	static inline std::vector<std::unique_ptr<WatchdogSlot>>	_slots;
+
+	static inline MetricHistogram								_timerLag;
+
+	static inline std::thread									_watchThread;
+	static inline std::mutex									_watchLock;
+	static inline std::condition_variable						_watchCv;
+	static inline bool											_watchStop{ false };
+};
+
+// PROFILE_ZONE과 함께 생성. 등록된 Worker에서만 현재 Handler를 기록하고 소멸 시 바깥 Zone으로 되돌림
+class WatchdogZone
+{
+public:
+	explicit WatchdogZone(const char* name) : _slot(Watchdog::GetSlot())
+	{
+		if (nullptr != _slot) {
+			_prevHandler = _slot->handler.load(std::memory_order_relaxed);
+			_prevStartNs = _slot->handlerStartNs.load(std::memory_order_relaxed);
+
+			_slot->handlerStartNs.store(Watchdog::Now(), std::memory_order_relaxed);
+			_slot->handler.store(name, std::memory_order_relaxed);
+		}
+	}
+
+	~WatchdogZone()
+	{
+		if (nullptr != _slot) {
+			_slot->handler.store(_prevHandler, std::memory_order_relaxed);
+			_slot->handlerStartNs.store(_prevStartNs, std::memory_order_relaxed);
+		}
+	}
+
+	WatchdogZone(const WatchdogZone&) = delete;
+	WatchdogZone& operator=(const WatchdogZone&) = delete;
+
+private:
+	WatchdogSlot* _slot;
+	const char* _prevHandler{ nullptr };
+	long long _prevStartNs{ 0 };
+};
@@ -0,0 +1,135 @@
+#pragma once
+
+// Gateway <-> Zone Server 사이에서만 쓰는 Packet, Client는 이 Packet을 보내거나 받지 않음
+// Gateway는 Client 하나당 현재 Zone으로 Local TCP 연결 하나를 열고 Client Packet을 그대로 전달
+// Windows 타입을 쓰지 않으므로 Gateway(Linux)에서도 그대로 include
+
+constexpr int ZONE_BASE_PORT = PORT_NUM + 1;	// Zone i는 ZONE_BASE_PORT + i에서 Listen
+constexpr int MAX_ZONE_COUNT = 8;
+
+// Gateway와 Zone Server가 같은 값을 GSPG_ZONE_SECRET 환경 변수로 받음 (앞 ZONE_SECRET_SIZE byte만 사용)
+// Zone Server는 GZ_HELLO로 Secret을 확인한 연결의 Packet만 처리
+constexpr int ZONE_SECRET_SIZE = 32;
+constexpr const char* ZONE_SECRET_ENV = "GSPG_ZONE_SECRET";
+
+// Zone Server Listen 주소 (기본 Loopback, Gateway가 다른 Host면 GSPG_ZONE_BIND로 지정)
+constexpr const char* ZONE_BIND_ENV = "GSPG_ZONE_BIND";
+constexpr const char* ZONE_DEFAULT_BIND = "127.0.0.1";
+
+constexpr int MAX_HANDOFF_QUESTS = 8;
+constexpr int MAX_HANDOFF_ITEMS = 16;
+
+enum ZonePacketID : unsigned char {
+	ZG_HANDOFF = 100,	// Zone -> Gateway : Player가 Zone 경계를 넘음, Gateway는 targetZone으로 다시 연결
+	GZ_HANDOFF_IN,		// Gateway -> Zone : GZ_HELLO 다음 Packet, CS_LOGIN 대신 상태를 그대로 넘김
+	GZ_HELLO,			// Gateway -> Zone : 모든 Zone 연결의 첫 Packet, 공유 Secret으로 Gateway임을 증명
+	ZG_HANDOFF_REPLAY,	// Zone -> Gateway : ZG_HANDOFF 뒤에 받은 Client Packet을 그대로 감싸서 돌려보냄, Gateway가 새 Zone으로 보냄
+	GZ_HANDOFF_DRAIN,	// Gateway -> Zone : ZG_HANDOFF를 받은 뒤 이전 Zone 연결로 보내는 마지막 Packet
+	ZG_HANDOFF_DONE,	// Zone -> Gateway : GZ_HANDOFF_DRAIN 응답, 이 앞의 ZG_HANDOFF_REPLAY가 전부
+};
+
+// 이 값 이상의 Packet Type은 Gateway가 Client에서 받으면 버림
+constexpr unsigned char ZONE_PACKET_BEGIN = ZG_HANDOFF;
+
+#pragma pack (push, 1)
+struct HandoffQuest {
+	int		questId;
+	int		progress;
+};
+
+struct HandoffItem {
+	char	itemId;
+	int		count;
+};
+
+// Zone을 옮길 때 넘기는 Player 상태 (UserData + Quest + Inventory)
+struct HandoffState {
+	int			userId;
+	char		name[NAME_SIZE];
+	int			level;
+	long long	exp;
+	short		hp, maxHp;
+	short		x, y;
+	int			partyId;
+
+	unsigned char	questCount;
+	HandoffQuest	quests[MAX_HANDOFF_QUESTS];
+
+	unsigned char	itemCount;
+	HandoffItem		items[MAX_HANDOFF_ITEMS];
+};
+
+struct GZ_HELLO_PACKET {
+	unsigned char size;
+	char	type;
+	char	secret[ZONE_SECRET_SIZE];
+};
+
+struct ZG_HANDOFF_PACKET {
+	unsigned char size;
+	char	type;
+	char	targetZone;
+	HandoffState state;
+};
+
+struct GZ_HANDOFF_IN_PACKET {
+	unsigned char size;
+	char	type;
+	HandoffState state;
+};
+
+// ZG_HANDOFF_REPLAY : 이 Header 바로 뒤에 Client Packet 하나 (size byte 포함 그대로)
+struct ZG_HANDOFF_REPLAY_HEADER {
+	unsigned char size;
+	char	type;
+};
+
+struct GZ_HANDOFF_DRAIN_PACKET {
+	unsigned char size;
+	char	type;
+};
+
+struct ZG_HANDOFF_DONE_PACKET {
+	unsigned char size;
+	char	type;
+};
+#pragma pack (pop)
+
+// ZG_HANDOFF_REPLAY로 감쌀 수 있는 Client Packet 최대 크기
+constexpr int MAX_REPLAY_PACKET_SIZE = 255 - static_cast<int>(sizeof(ZG_HANDOFF_REPLAY_HEADER));
+
+static_assert(sizeof(ZG_HANDOFF_PACKET) <= 255, "Handoff packet must fit in the 1-byte size field");
+static_assert(sizeof(GZ_HANDOFF_IN_PACKET) <= 255, "Handoff packet must fit in the 1-byte size field");
+
+// Secret 문자열을 고정 크기로 채움 (남는 부분은 0)
+inline void FillZoneSecret(char (&out)[ZONE_SECRET_SIZE], const char* secret)
+{
+	for (int i = 0; i < ZONE_SECRET_SIZE; ++i) {
+		out[i] = (nullptr != secret) ? secret[i] : '\0';
+		if ('\0' == out[i]) {
+			for (; i < ZONE_SECRET_SIZE; ++i) out[i] = '\0';
+			break;
+		}
+	}
+}
+
+// 비교 시간이 일치한 길이에 따라 달라지지 않도록 끝까지 비교
+inline bool ZoneSecretEquals(const char (&a)[ZONE_SECRET_SIZE], const char (&b)[ZONE_SECRET_SIZE])
+{
+	unsigned char diff{ 0 };
+	for (int i = 0; i < ZONE_SECRET_SIZE; ++i) {
+		diff |= static_cast<unsigned char>(a[i] ^ b[i]);
+	}
+	return 0 == diff;
+}
+
+// x 좌표를 zoneCount개의 세로 띠로 나눔
+inline int GetZoneOf(short x, int zoneCount)
+{
+	if (zoneCount <= 1) {
+		return 0;
+	}
+
+	int zone = x * zoneCount / W_WIDTH;
+	return (zone < 0) ? 0 : ((zone >= zoneCount) ? zoneCount - 1 : zone);
+}
@@ -1,5 +1,9 @@
 ﻿#pragma once
 
+#ifdef SERVERCORE_PORTABLE
+#include "PortablePch.h"
+#else
 #define WIN_LEAN_AND_WEAN
 
-#include "CorePch.h"
\ No newline at end of file
+#include "CorePch.h"
+#endif
\ No newline at end of file
@@ -0,0 +1,347 @@
+#include "pch.h"
+#include "SimStorage.h"
+
+#include <fstream>
+#include <map>
+#include <sstream>
+
+// SimHarness.exe [--players N] [--ticks N] [--tick-ms N] [--seed N] [--script <file>] [--capture <file>] [--map <file>]
+// Socket / Thread 없이 Service를 한 Thread에서 Tick 단위로 돌림 (Virtual Clock, 고정 Seed)
+// 같은 Seed + Script면 출력 Packet이 Byte 단위로 같으므로 hash / capture를 최적화 Branch끼리 비교
+//
+// Script : 한 줄에 "<timeMs> <userId> <action> [args]", action = login / move <0~3> / attack / chat <text> / teleport / logout
+// Script가 없으면 Seed로 입력을 만듦 (시작 시 전원 Login, 이후 Tick마다 이동 / 공격 / 채팅)
+// monster_spawn.lua와 map을 읽으므로 GameServer 실행 Directory에서 실행
+namespace
+{
+	struct Options {
+		int players{ MAX_USER };
+		int ticks{ 600 };
+		int tickMs{ 100 };
+		unsigned int seed{ 1 };
+		std::string script;
+		std::string capture;
+		std::string map{ "mapdata.txt" };
+	};
+
+	struct ScriptInput {
+		long long timeMs;
+		int userId;
+		std::string action;
+		std::string args;
+	};
+
+	// 출력 Packet 기록. Record = [timeMs 8][userId 4][size 2][bytes]
+	class PacketCapture
+	{
+	public:
+		bool Open(const std::string& path)
+		{
+			_file.open(path, std::ios::binary | std::ios::trunc);
+			return _file.is_open();
+		}
+
+		void Write(long long timeMs, int userId, const std::vector<char>& data)
+		{
+			unsigned short size = static_cast<unsigned short>(data.size());
+
+			Append(&timeMs, sizeof(timeMs));
+			Append(&userId, sizeof(userId));
+			Append(&size, sizeof(size));
+			Append(data.data(), data.size());
+
+			++_packets;
+			_bytes += data.size();
+		}
+
+		unsigned long long GetHash() const { return _hash; }
+		unsigned long long GetPackets() const { return _packets; }
+		unsigned long long GetBytes() const { return _bytes; }
+
+	private:
+		void Append(const void* data, size_t size)
+		{
+			// FNV-1a 64
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			for (size_t i = 0; i < size; ++i) {
+				_hash ^= bytes[i];
+				_hash *= 1099511628211ULL;
+			}
+
+			if (_file.is_open()) {
+				_file.write(static_cast<const char*>(data), size);
+			}
+		}
+
+	private:
+		std::ofstream _file;
+		unsigned long long _hash{ 14695981039346656037ULL };
+		unsigned long long _packets{ 0 };
+		unsigned long long _bytes{ 0 };
+	};
+
+	bool ParseOptions(int argc, char* argv[], Options& options)
+	{
+		for (int i = 1; i < argc; ++i) {
+			std::string arg = argv[i];
+			if (i + 1 >= argc) {
+				std::cerr << "missing value: " << arg << '\n';
+				return false;
+			}
+
+			std::string value = argv[++i];
+			if ("--players" == arg) options.players = std::clamp(std::atoi(value.c_str()), 1, MAX_USER);
+			else if ("--ticks" == arg) options.ticks = std::max(1, std::atoi(value.c_str()));
+			else if ("--tick-ms" == arg) options.tickMs = std::max(1, std::atoi(value.c_str()));
+			else if ("--seed" == arg) options.seed = static_cast<unsigned int>(std::stoul(value));
+			else if ("--script" == arg) options.script = value;
+			else if ("--capture" == arg) options.capture = value;
+			else if ("--map" == arg) options.map = value;
+			else {
+				std::cerr << "unknown option: " << arg << '\n';
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool LoadScript(const std::string& path, std::vector<ScriptInput>& inputs)
+	{
+		std::ifstream in{ path };
+		if (not in) {
+			std::cerr << "script open failed: " << path << '\n';
+			return false;
+		}
+
+		std::string line;
+		while (std::getline(in, line)) {
+			if (line.empty() or ('#' == line[0])) {
+				continue;
+			}
+
+			std::istringstream iss{ line };
+			ScriptInput input;
+			if (not (iss >> input.timeMs >> input.userId >> input.action)) {
+				continue;
+			}
+
+			std::getline(iss >> std::ws, input.args);
+			inputs.push_back(std::move(input));
+		}
+
+		// 같은 시각은 파일 순서 유지
+		std::stable_sort(inputs.begin(), inputs.end(),
+			[](const ScriptInput& a, const ScriptInput& b) { return a.timeMs < b.timeMs; });
+		return true;
+	}
+
+	// Script 없이 돌릴 때 Tick마다 입력 생성 (User당 이동 80%, 공격 15%, 채팅 1%)
+	void GenerateInputs(std::mt19937& rng, long long timeMs, int players, std::vector<ScriptInput>& inputs)
+	{
+		if (0 == timeMs) {
+			for (int userId = 1; userId <= players; ++userId) {
+				inputs.push_back(ScriptInput{ timeMs, userId, "login", "" });
+			}
+			return;
+		}
+
+		std::uniform_int_distribution<int> percent{ 0, 99 };
+		std::uniform_int_distribution<int> direction{ 0, 3 };
+		for (int userId = 1; userId <= players; ++userId) {
+			int roll = percent(rng);
+			if (roll < 80) {
+				inputs.push_back(ScriptInput{ timeMs, userId, "move", std::to_string(direction(rng)) });
+			}
+			else if (roll < 95) {
+				inputs.push_back(ScriptInput{ timeMs, userId, "attack", "" });
+			}
+			else if (roll < 96) {
+				inputs.push_back(ScriptInput{ timeMs, userId, "chat", "hello" });
+			}
+		}
+	}
+
+	std::vector<char> BuildPacket(const ScriptInput& input, long long timeMs)
+	{
+		if ("login" == input.action) {
+			CS_LOGIN_PACKET packet{ sizeof(CS_LOGIN_PACKET), CS_LOGIN };
+			snprintf(packet.name, NAME_SIZE, "sim%d", input.userId);
+			packet.id = input.userId;
+			return PacketFactory::Serialize(packet);
+		}
+
+		if ("move" == input.action) {
+			CS_MOVE_PACKET packet{ sizeof(CS_MOVE_PACKET), CS_MOVE };
+			packet.direction = static_cast<char>(std::atoi(input.args.c_str()));
+			packet.move_time = static_cast<unsigned int>(timeMs);
+			return PacketFactory::Serialize(packet);
+		}
+
+		if ("attack" == input.action) {
+			CS_ATTACK_PACKET packet{ sizeof(CS_ATTACK_PACKET), CS_ATTACK };
+			packet.attack_time = static_cast<unsigned int>(timeMs);
+			return PacketFactory::Serialize(packet);
+		}
+
+		if ("chat" == input.action) {
+			CS_CHAT_PACKET packet{ sizeof(CS_CHAT_PACKET), CS_CHAT };
+			snprintf(packet.message, CHAT_SIZE, "%s", input.args.c_str());
+			return PacketFactory::Serialize(packet);
+		}
+
+		if ("teleport" == input.action) {
+			CS_TELEPORT_PACKET packet{ sizeof(CS_TELEPORT_PACKET), CS_TELEPORT };
+			return PacketFactory::Serialize(packet);
+		}
+
+		if ("logout" == input.action) {
+			CS_LOGOUT_PACKET packet{ sizeof(CS_LOGOUT_PACKET), CS_LOGOUT };
+			return PacketFactory::Serialize(packet);
+		}
+
+		return {};
+	}
+
+	// 시작 위치는 Seed로 고른 이동 가능한 칸
+	void RegisterUsers(SimStorage& storage, const ServicePtr& service, std::mt19937& rng, int players)
+	{
+		std::uniform_int_distribution<int> coord{ 0, MAP_SIZE - 1 };
+
+		for (int userId = 1; userId <= players; ++userId) {
+			short x{ 0 }, y{ 0 };
+			do {
+				x = static_cast<short>(coord(rng));
+				y = static_cast<short>(coord(rng));
+			} while (not service->_navigationMap[y][x]);
+
+			storage.AddUser(UserData{ userId, 1, 0, 100, 100, x, y, -1 });
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	using namespace std::chrono;
+
+	Options options;
+	if (not ParseOptions(argc, argv, options)) {
+		return 1;
+	}
+
+	Logger::Init();
+	Logger::SetLevel(LogLevel::Error);
+
+	// 1. Virtual Clock / 고정 Seed (Service 시작 전에 설정해야 초기 Timer Event도 Virtual Clock 기준)
+	GameClock::EnableVirtual(GameClock::Clock::time_point{ hours(1) });
+	GameRandom::SetSeed(options.seed);
+	srand(options.seed);
+
+	std::vector<ScriptInput> scriptInputs;
+	if ((not options.script.empty()) and (not LoadScript(options.script, scriptInputs))) {
+		return 1;
+	}
+
+	PacketCapture capture;
+	if ((not options.capture.empty()) and (not capture.Open(options.capture))) {
+		std::cerr << "capture open failed: " << options.capture << '\n';
+		return 1;
+	}
+
+	// 2. Service 시작 (Socket / Thread 없음)
+	IocpCorePtr iocpCore = std::make_shared<IocpCore>();
+	ServicePtr service = Service::Create(iocpCore, MAX_USER);
+
+	auto storage = std::make_shared<SimStorage>();
+	if (not service->StartSimulation(storage, options.map)) {
+		std::cerr << "StartSimulation failed\n";
+		return 1;
+	}
+
+	std::mt19937 rng{ options.seed };
+	RegisterUsers(*storage, service, rng, options.players);
+
+	// 3. Tick : 입력 주입 -> 할 일이 없을 때까지 실행 -> Virtual Clock 전진
+	long long timeMs{ 0 };
+	std::map<int, std::shared_ptr<GameSession>> sessions;
+	std::vector<long long> tickUs;
+	tickUs.reserve(options.ticks);
+
+	size_t nextInput{ 0 };
+	unsigned long long inputCount{ 0 };
+	std::vector<ScriptInput> generated;
+
+	for (int tick = 0; tick < options.ticks; ++tick) {
+		auto tickStart = steady_clock::now();
+
+		generated.clear();
+		if (options.script.empty()) {
+			GenerateInputs(rng, timeMs, options.players, generated);
+		}
+		else {
+			while ((nextInput < scriptInputs.size()) and (scriptInputs[nextInput].timeMs <= timeMs)) {
+				generated.push_back(scriptInputs[nextInput++]);
+			}
+		}
+
+		for (const ScriptInput& input : generated) {
+			std::shared_ptr<GameSession>& session = sessions[input.userId];
+
+			// Login은 새 연결로 취급
+			if ("login" == input.action) {
+				session = service->CreateSimulationSession([&capture, &timeMs, userId = input.userId](const std::vector<char>& data)
+					{
+						capture.Write(timeMs, userId, data);
+					});
+			}
+
+			if (nullptr == session) {
+				continue;
+			}
+
+			std::vector<char> packet = BuildPacket(input, timeMs);
+			if (packet.empty()) {
+				std::cerr << "unknown action: " << input.action << '\n';
+				continue;
+			}
+
+			session->Post([session, packet = std::move(packet)]() { session->ProcessPacket(packet); });
+			++inputCount;
+		}
+
+		service->RunSimulation();
+
+		tickUs.push_back(duration_cast<microseconds>(steady_clock::now() - tickStart).count());
+
+		GameClock::Advance(milliseconds(options.tickMs));
+		timeMs += options.tickMs;
+	}
+
+	// 4. 종료 (남은 DB 요청까지 처리)
+	service->CloseService();
+
+	std::vector<long long> sorted = tickUs;
+	std::sort(sorted.begin(), sorted.end());
+
+	long long totalUs{ 0 };
+	for (long long us : tickUs) {
+		totalUs += us;
+	}
+
+	char hash[32];
+	snprintf(hash, sizeof(hash), "%016llx", capture.GetHash());
+
+	std::cout << "{\"players\":" << options.players
+		<< ",\"ticks\":" << options.ticks
+		<< ",\"tickMs\":" << options.tickMs
+		<< ",\"seed\":" << options.seed
+		<< ",\"inputs\":" << inputCount
+		<< ",\"tickAvgUs\":" << (totalUs / static_cast<long long>(tickUs.size()))
+		<< ",\"tickP99Us\":" << sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)]
+		<< ",\"tickMaxUs\":" << sorted.back()
+		<< ",\"packets\":" << capture.GetPackets()
+		<< ",\"bytes\":" << capture.GetBytes()
+		<< ",\"hash\":\"" << hash << "\"}\n";
+
+	Logger::Shutdown();
+	return 0;
+}
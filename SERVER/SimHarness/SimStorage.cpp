@@ -0,0 +1,135 @@
+#include "pch.h"
+#include "SimStorage.h"
+
+void SimStorage::AddUser(const UserData& userData)
+{
+	std::lock_guard lock{ _lock };
+	_users[userData.id].userData = userData;
+}
+
+bool SimStorage::Init(const std::string& connection)
+{
+	return true;
+}
+
+void SimStorage::Shutdown()
+{
+}
+
+bool SimStorage::CheckUserID(const std::wstring& userID)
+{
+	std::lock_guard lock{ _lock };
+	return nullptr != FindUser(userID);
+}
+
+bool SimStorage::GetUserInfo(const std::wstring& userID, UserData& outData)
+{
+	std::lock_guard lock{ _lock };
+
+	UserRecord* record = FindUser(userID);
+	if (nullptr == record) {
+		return false;
+	}
+
+	outData = record->userData;
+	return true;
+}
+
+bool SimStorage::UpdateUserInfo(const UserData& userData)
+{
+	std::lock_guard lock{ _lock };
+
+	UserRecord* record = FindUser(userData.id);
+	if (nullptr == record) {
+		return false;
+	}
+
+	record->userData = userData;
+	return true;
+}
+
+std::vector<std::pair<int, int>> SimStorage::GetUserItems(const std::wstring& userID)
+{
+	std::lock_guard lock{ _lock };
+
+	std::vector<std::pair<int, int>> items;
+	if (UserRecord* record = FindUser(userID)) {
+		items.assign(record->items.begin(), record->items.end());
+	}
+	return items;
+}
+
+bool SimStorage::UserGetItem(int userId, int itemId, int count)
+{
+	std::lock_guard lock{ _lock };
+
+	UserRecord* record = FindUser(userId);
+	if (nullptr == record) {
+		return false;
+	}
+
+	record->items[itemId] += count;
+	return true;
+}
+
+bool SimStorage::UserUseItem(int userId, int itemId, int count)
+{
+	std::lock_guard lock{ _lock };
+
+	UserRecord* record = FindUser(userId);
+	if (nullptr == record) {
+		return false;
+	}
+
+	auto it = record->items.find(itemId);
+	if ((it == record->items.end()) or (it->second < count)) {
+		return false;
+	}
+
+	it->second -= count;
+	if (0 == it->second) {
+		record->items.erase(it);
+	}
+	return true;
+}
+
+std::vector<QuestData> SimStorage::GetUserQuests(const std::wstring& userID)
+{
+	std::lock_guard lock{ _lock };
+
+	if (UserRecord* record = FindUser(userID)) {
+		return record->quests;
+	}
+	return {};
+}
+
+bool SimStorage::UpdateUserQuests(int userId, const std::vector<QuestData>& quests)
+{
+	std::lock_guard lock{ _lock };
+
+	UserRecord* record = FindUser(userId);
+	if (nullptr == record) {
+		return false;
+	}
+
+	record->quests = quests;
+	return true;
+}
+
+SimStorage::UserRecord* SimStorage::FindUser(const std::wstring& userID)
+{
+	wchar_t* end{ nullptr };
+	long id = std::wcstol(userID.c_str(), &end, 10);
+
+	if (userID.empty() or (*end != L'\0')) {
+		return nullptr;
+	}
+
+	return FindUser(static_cast<int>(id));
+}
+
+SimStorage::UserRecord* SimStorage::FindUser(int userId)
+{
+	auto it = _users.find(userId);
+	return (it != _users.end()) ? &it->second : nullptr;
+}
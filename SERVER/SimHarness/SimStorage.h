@@ -0,0 +1,42 @@
+#pragma once
+
+#include <map>
+
+// Simulation용 In-Memory 저장소. ODBC / SQLite 없이 Login / 저장 흐름을 그대로 태움
+// DBExecutor Manual 모드에서는 RunSimulation Thread 하나만 호출하지만 IStorage 계약대로 Lock을 잡음
+class SimStorage : public IStorage
+{
+	struct UserRecord {
+		UserData userData;
+		std::map<int, int> items;
+		std::vector<QuestData> quests;
+	};
+
+public:
+	// Simulation 시작 전에 User를 등록 (시작 위치를 Harness가 정함)
+	void AddUser(const UserData& userData);
+
+public:
+	virtual bool Init(const std::string& connection) override;
+	virtual void Shutdown() override;
+
+	virtual bool CheckUserID(const std::wstring& userID) override;
+
+	virtual bool GetUserInfo(const std::wstring& userID, UserData& outData) override;
+	virtual bool UpdateUserInfo(const UserData& userData) override;
+
+	virtual std::vector<std::pair<int, int>> GetUserItems(const std::wstring& userID) override;
+	virtual bool UserGetItem(int userId, int itemId, int count) override;
+	virtual bool UserUseItem(int userId, int itemId, int count) override;
+
+	virtual std::vector<QuestData> GetUserQuests(const std::wstring& userID) override;
+	virtual bool UpdateUserQuests(int userId, const std::vector<QuestData>& quests) override;
+
+private:
+	UserRecord* FindUser(const std::wstring& userID);
+	UserRecord* FindUser(int userId);
+
+private:
+	std::mutex _lock;
+	std::map<int, UserRecord> _users;
+};
@@ -0,0 +1,139 @@
+// SqliteStorage Login / Logout 처리량 측정
+// Server와 같은 방식으로 User ID % threadCount로 Thread를 고정해서 실행
+//
+// usage : storagebench [userCount] [threadCount] [rounds] [dbPath]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../ServerCore/SqliteStorage.h"
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct PhaseResult {
+		long long ops{ 0 };
+		long long failures{ 0 };
+		std::vector<long long> latenciesUs;
+	};
+
+	// Login : Server의 OnLogin과 같은 LoadUser 한 번
+	bool Login(SqliteStorage& storage, int userId)
+	{
+		UserLoadResult result;
+		return storage.LoadUser(std::to_wstring(userId), result);
+	}
+
+	// Logout : PlayerCache Flush 한 번 (UserData + Quest + Item 증감)
+	bool Logout(SqliteStorage& storage, int userId, int round)
+	{
+		UserData userData{ userId, 1 + round, round * 100LL, 80, 100,
+			static_cast<short>((userId + round) % 2000), static_cast<short>(userId % 2000), -1 };
+
+		std::vector<QuestData> quests{ { 1, round }, { 2, round * 2 } };
+
+		bool success = storage.UpdateUserInfo(userData);
+		success = storage.UpdateUserQuests(userId, quests) and success;
+		success = storage.UserGetItem(userId, 1, 2) and success;
+		success = storage.UserUseItem(userId, 1, 1) and success;
+		return success;
+	}
+
+	template <typename Func>
+	PhaseResult RunPhase(SqliteStorage& storage, int userCount, int threadCount, Func func)
+	{
+		std::vector<PhaseResult> results(threadCount);
+		std::vector<std::thread> threads;
+
+		for (int t = 0; t < threadCount; ++t) {
+			threads.emplace_back([&, t]()
+				{
+					PhaseResult& result = results[t];
+					for (int userId = 1 + t; userId <= userCount; userId += threadCount) {
+						auto begin = Clock::now();
+						bool success = func(userId);
+						auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin).count();
+
+						++result.ops;
+						if (not success) ++result.failures;
+						result.latenciesUs.push_back(elapsed);
+					}
+
+					storage.CloseThreadConnection();
+				});
+		}
+
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+
+		PhaseResult total;
+		for (PhaseResult& result : results) {
+			total.ops += result.ops;
+			total.failures += result.failures;
+			total.latenciesUs.insert(total.latenciesUs.end(), result.latenciesUs.begin(), result.latenciesUs.end());
+		}
+
+		return total;
+	}
+
+	void Report(const char* name, PhaseResult& result, double seconds)
+	{
+		auto& lat = result.latenciesUs;
+		std::sort(lat.begin(), lat.end());
+
+		auto percentile = [&](double p) -> long long {
+			if (lat.empty()) return 0;
+			return lat[std::min(lat.size() - 1, static_cast<size_t>(p * lat.size()))];
+		};
+
+		printf("%-8s %8lld ops  %10.0f ops/s  p50 %6lld us  p99 %6lld us  max %7lld us  fail %lld\n",
+			name, result.ops, result.ops / seconds, percentile(0.50), percentile(0.99),
+			lat.empty() ? 0 : lat.back(), result.failures);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int userCount = (argc > 1) ? std::atoi(argv[1]) : 5000;
+	int threadCount = (argc > 2) ? std::atoi(argv[2]) : 2;
+	int rounds = (argc > 3) ? std::atoi(argv[3]) : 3;
+	std::string dbPath = (argc > 4) ? argv[4] : "storagebench.db";
+
+	if ((userCount <= 0) or (threadCount <= 0) or (rounds <= 0)) {
+		fprintf(stderr, "usage : storagebench [userCount] [threadCount] [rounds] [dbPath]\n");
+		return 1;
+	}
+
+	SqliteStorage storage;
+	if (not storage.Init(dbPath)) {
+		return 1;
+	}
+
+	printf("SqliteStorage bench : %d users, %d threads, %d rounds, %s\n", userCount, threadCount, rounds, dbPath.c_str());
+
+	for (int round = 0; round < rounds; ++round) {
+		printf("-- round %d\n", round);
+
+		// 1. Login (첫 Round는 계정 생성 포함)
+		auto begin = Clock::now();
+		PhaseResult login = RunPhase(storage, userCount, threadCount, [&](int userId) { return Login(storage, userId); });
+		Report("login", login, std::chrono::duration<double>(Clock::now() - begin).count());
+
+		// 2. Logout
+		begin = Clock::now();
+		PhaseResult logout = RunPhase(storage, userCount, threadCount, [&](int userId) { return Logout(storage, userId, round); });
+		Report("logout", logout, std::chrono::duration<double>(Clock::now() - begin).count());
+	}
+
+	storage.Shutdown();
+	return 0;
+}
@@ -0,0 +1,932 @@
+// Linux Headless 부하 생성기 (STRESS_TEST의 Win32 IOCP / 화면 없이 동작)
+// Thread마다 epoll 하나와 Bot 일부를 맡아서 Login 후 move / attack / chat을 비율대로 전송
+// 주기마다 stdout에 JSON 한 줄로 처리량과 Latency Percentile 출력, 진행 메시지는 stderr
+//
+// usage : loadgen [--host 127.0.0.1] [--port 4000] [--bots 1000] [--threads 4] [--duration 60]
+//                 [--ramp instant | linear:<sec> | step:<count>:<sec>] [--rate <actions/sec per bot>]
+//                 [--mix move=80,attack=15,chat=5] [--id-base 1] [--interval 1] [--no-teleport]
+//                 [--hgrm <prefix>]  : 종료 시 action별 <prefix>.<action>.hgrm (HdrHistogram Percentile 분포) 저장
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../SERVER/ServerCore/protocol.h"
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	enum BotState : char
+	{
+		BOT_IDLE,
+		BOT_CONNECTING,
+		BOT_LOGIN_SENT,
+		BOT_INGAME,
+		BOT_CLOSED
+	};
+
+	enum ActionType : char
+	{
+		ACTION_LOGIN,
+		ACTION_MOVE,
+		ACTION_ATTACK,
+		ACTION_CHAT,
+		ACTION_COUNT
+	};
+
+	constexpr const char* ACTION_NAMES[ACTION_COUNT] = { "login", "move", "attack", "chat" };
+
+	enum RampType : char
+	{
+		RAMP_INSTANT,
+		RAMP_LINEAR,
+		RAMP_STEP
+	};
+
+	struct Config {
+		std::string	host{ "127.0.0.1" };
+		int			port{ PORT_NUM };
+		int			bots{ 1000 };
+		int			threads{ 4 };
+		double		duration{ 60.0 };
+		RampType	ramp{ RAMP_LINEAR };
+		double		rampSeconds{ 30.0 };
+		int			stepCount{ 100 };
+		double		rate{ 1.0 };
+		int			mix[ACTION_COUNT]{ 0, 80, 15, 5 };
+		int			idBase{ 1 };
+		double		interval{ 1.0 };
+		bool		teleport{ true };
+		std::string	hgrmPrefix;
+	};
+
+	struct Bot {
+		int					index{ 0 };
+		int					fd{ -1 };
+		int					userId{ -1 };
+		BotState			state{ BOT_IDLE };
+
+		std::vector<char>	in;
+		std::vector<char>	out;
+
+		Clock::time_point	nextAction;
+		Clock::time_point	loginSent;
+
+		// 응답을 기다리는 마지막 요청. 응답 없이 다음 요청을 보내면 unacked로 집계
+		// move는 Server가 본인 Move 응답에 move_time(us)을 그대로 돌려주므로 그 값으로 맞춤
+		unsigned int		pendingMoveTime{ 0 };
+		Clock::time_point	pendingChat;
+		bool				hasPendingMove{ false };
+		bool				hasPendingChat{ false };
+	};
+
+	// HdrHistogram과 같은 Bucket 구조 (유효숫자 3자리, 1us ~ 60s)
+	// 기록과 합치기가 O(1)이고 표본 수와 관계없이 크기가 고정
+	class LatencyHistogram
+	{
+	public:
+		static constexpr long long HIGHEST_US = 60'000'000;
+		static constexpr int SUB_BUCKET_HALF_MAGNITUDE = 10;	// 2 * 10^3 <= 2^11
+		static constexpr long long SUB_BUCKET_COUNT = 1LL << (SUB_BUCKET_HALF_MAGNITUDE + 1);
+		static constexpr long long SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2;
+		static constexpr long long SUB_BUCKET_MASK = SUB_BUCKET_COUNT - 1;
+
+	public:
+		LatencyHistogram() : _counts(GetCountsLength(), 0) {}
+
+	public:
+		void Record(long long valueUs)
+		{
+			valueUs = std::clamp(valueUs, 0LL, HIGHEST_US);
+			++_counts[GetIndex(valueUs)];
+			++_totalCount;
+			_sum += valueUs;
+			_sumSquares += static_cast<double>(valueUs) * valueUs;
+			_max = std::max(_max, valueUs);
+		}
+
+		void Add(const LatencyHistogram& other)
+		{
+			for (size_t i = 0; i < _counts.size(); ++i) {
+				_counts[i] += other._counts[i];
+			}
+			_totalCount += other._totalCount;
+			_sum += other._sum;
+			_sumSquares += other._sumSquares;
+			_max = std::max(_max, other._max);
+		}
+
+		long long GetTotalCount() const { return _totalCount; }
+		long long GetMax() const { return _max; }
+		double GetMean() const { return (0 == _totalCount) ? 0.0 : static_cast<double>(_sum) / _totalCount; }
+		double GetStdDeviation() const
+		{
+			if (0 == _totalCount) return 0.0;
+			double mean = GetMean();
+			return std::sqrt(std::max(0.0, _sumSquares / _totalCount - mean * mean));
+		}
+
+		// percentile : 0 ~ 100
+		long long GetValueAtPercentile(double percentile) const
+		{
+			if (0 == _totalCount) return 0;
+
+			long long target = std::max(1LL, static_cast<long long>(std::ceil(percentile / 100.0 * _totalCount)));
+			long long running{ 0 };
+			for (size_t i = 0; i < _counts.size(); ++i) {
+				running += _counts[i];
+				if (running >= target) {
+					return std::min(GetHighestEquivalent(i), _max);
+				}
+			}
+			return _max;
+		}
+
+		// HdrHistogram outputPercentileDistribution 형식 (값은 ms), HistogramLogAnalyzer / plotter로 바로 읽힘
+		void WritePercentiles(FILE* file) const
+		{
+			constexpr int TICKS_PER_HALF_DISTANCE = 5;
+			std::fprintf(file, "%12s %14s %10s %14s\n\n", "Value", "Percentile", "TotalCount", "1/(1-Percentile)");
+
+			if (_totalCount > 0) {
+				double percentile{ 0.0 };
+				while (true) {
+					long long value = GetValueAtPercentile(percentile);
+					long long countAtValue = GetCountAtOrBelow(value);
+
+					if (countAtValue >= _totalCount) {
+						std::fprintf(file, "%12.3f %2.12f %10lld\n", value / 1000.0, 1.0, _totalCount);
+						break;
+					}
+
+					std::fprintf(file, "%12.3f %2.12f %10lld %14.2f\n", value / 1000.0, percentile / 100.0, countAtValue,
+						1.0 / (1.0 - percentile / 100.0));
+
+					// 100%에 가까워질수록 간격을 절반씩 줄임
+					double halfDistance = std::pow(2.0, std::floor(std::log2(100.0 / (100.0 - percentile))) + 1);
+					percentile += 100.0 / (halfDistance * TICKS_PER_HALF_DISTANCE);
+				}
+			}
+
+			std::fprintf(file, "#[Mean    = %12.3f, StdDeviation   = %12.3f]\n", GetMean() / 1000.0, GetStdDeviation() / 1000.0);
+			std::fprintf(file, "#[Max     = %12.3f, Total count    = %12lld]\n", _max / 1000.0, _totalCount);
+			std::fprintf(file, "#[Buckets = %12lld, SubBuckets     = %12lld]\n",
+				static_cast<long long>(_counts.size() / SUB_BUCKET_HALF_COUNT) - 1, SUB_BUCKET_COUNT);
+		}
+
+	private:
+		static size_t GetCountsLength()
+		{
+			long long smallestUntrackable = SUB_BUCKET_COUNT;
+			size_t bucketCount{ 1 };
+			while (smallestUntrackable <= HIGHEST_US) {
+				smallestUntrackable <<= 1;
+				++bucketCount;
+			}
+			return (bucketCount + 1) * SUB_BUCKET_HALF_COUNT;
+		}
+
+		static size_t GetIndex(long long value)
+		{
+			int bucketIndex = (64 - __builtin_clzll(value | SUB_BUCKET_MASK)) - (SUB_BUCKET_HALF_MAGNITUDE + 1);
+			long long subBucketIndex = value >> bucketIndex;
+			return (static_cast<size_t>(bucketIndex + 1) << SUB_BUCKET_HALF_MAGNITUDE) + (subBucketIndex - SUB_BUCKET_HALF_COUNT);
+		}
+
+		// index가 담당하는 범위 [lowest, highest]의 highest
+		static long long GetHighestEquivalent(size_t index)
+		{
+			int bucketIndex = static_cast<int>(index >> SUB_BUCKET_HALF_MAGNITUDE) - 1;
+			long long subBucketIndex = static_cast<long long>(index & (SUB_BUCKET_HALF_COUNT - 1)) + SUB_BUCKET_HALF_COUNT;
+			if (bucketIndex < 0) {
+				subBucketIndex -= SUB_BUCKET_HALF_COUNT;
+				bucketIndex = 0;
+			}
+			return (subBucketIndex << bucketIndex) + (1LL << bucketIndex) - 1;
+		}
+
+		long long GetCountAtOrBelow(long long value) const
+		{
+			size_t last = GetIndex(std::clamp(value, 0LL, HIGHEST_US));
+			long long count{ 0 };
+			for (size_t i = 0; i <= last; ++i) {
+				count += _counts[i];
+			}
+			return count;
+		}
+
+	private:
+		std::vector<long long>	_counts;
+		long long				_totalCount{ 0 };
+		long long				_sum{ 0 };
+		double					_sumSquares{ 0.0 };
+		long long				_max{ 0 };
+	};
+
+	// Thread 하나가 기록하고 Report Thread가 주기마다 가져감
+	struct Stats {
+		long long			sent[ACTION_COUNT]{};
+		long long			acked[ACTION_COUNT]{};
+		long long			unacked[ACTION_COUNT]{};
+		long long			recvPackets{ 0 };
+		long long			rxBytes{ 0 };
+		long long			txBytes{ 0 };
+		long long			connectFailed{ 0 };
+		long long			loginFailed{ 0 };
+		long long			disconnected{ 0 };
+		LatencyHistogram	latency[ACTION_COUNT];
+
+		void Merge(const Stats& other)
+		{
+			for (int i = 0; i < ACTION_COUNT; ++i) {
+				sent[i] += other.sent[i];
+				acked[i] += other.acked[i];
+				unacked[i] += other.unacked[i];
+				latency[i].Add(other.latency[i]);
+			}
+			recvPackets += other.recvPackets;
+			rxBytes += other.rxBytes;
+			txBytes += other.txBytes;
+			connectFailed += other.connectFailed;
+			loginFailed += other.loginFailed;
+			disconnected += other.disconnected;
+		}
+	};
+
+	struct Worker {
+		int						index{ 0 };
+		int						epollFd{ -1 };
+		std::vector<Bot>		bots;
+		std::thread				thread;
+
+		std::mutex				statsLock;
+		Stats					stats;
+		std::atomic<int>		connected{ 0 };
+		std::atomic<int>		inGame{ 0 };
+	};
+
+	Config					g_config;
+	Clock::time_point		g_startTime;
+	std::atomic<bool>		g_stop{ false };
+	sockaddr_in				g_serverAddr{};
+
+	void OnSignal(int)
+	{
+		g_stop.store(true);
+	}
+
+	double ElapsedSeconds(Clock::time_point now)
+	{
+		return std::chrono::duration<double>(now - g_startTime).count();
+	}
+
+	long long ToUs(Clock::duration d)
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+	}
+
+	// Ramp 설정에 따라 지금까지 접속해 있어야 하는 전체 Bot 수
+	int GetRampTarget(double elapsed)
+	{
+		switch (g_config.ramp) {
+		case RAMP_INSTANT:
+			return g_config.bots;
+
+		case RAMP_LINEAR:
+			if (g_config.rampSeconds <= 0.0) return g_config.bots;
+			return std::min(g_config.bots, static_cast<int>(g_config.bots * (elapsed / g_config.rampSeconds)));
+
+		case RAMP_STEP: {
+			int steps = (g_config.rampSeconds <= 0.0) ? 0 : static_cast<int>(elapsed / g_config.rampSeconds);
+			return std::min(g_config.bots, (steps + 1) * g_config.stepCount);
+		}
+		}
+
+		return g_config.bots;
+	}
+
+	bool SetNonBlocking(int fd)
+	{
+		int flags = fcntl(fd, F_GETFL, 0);
+		return (flags >= 0) and (fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0);
+	}
+
+	void CloseBot(Worker& worker, Bot& bot, bool failed)
+	{
+		if (bot.fd >= 0) {
+			epoll_ctl(worker.epollFd, EPOLL_CTL_DEL, bot.fd, nullptr);
+			close(bot.fd);
+			bot.fd = -1;
+		}
+
+		if (bot.state == BOT_INGAME) {
+			worker.inGame.fetch_sub(1);
+		}
+		if ((bot.state == BOT_LOGIN_SENT) or (bot.state == BOT_INGAME)) {
+			worker.connected.fetch_sub(1);
+		}
+
+		if (failed and (bot.state != BOT_CLOSED)) {
+			std::lock_guard lock{ worker.statsLock };
+			++worker.stats.disconnected;
+		}
+
+		bot.state = BOT_CLOSED;
+	}
+
+	// 보낼 수 있는 만큼 보내고 나머지는 out에 남김 (EPOLLOUT에서 이어서 전송)
+	bool Flush(Worker& worker, Bot& bot)
+	{
+		long long sentBytes{ 0 };
+		while (not bot.out.empty()) {
+			ssize_t sent = send(bot.fd, bot.out.data(), bot.out.size(), MSG_NOSIGNAL);
+			if (sent < 0) {
+				if ((errno == EAGAIN) or (errno == EWOULDBLOCK)) {
+					break;
+				}
+				return false;
+			}
+
+			sentBytes += sent;
+			bot.out.erase(bot.out.begin(), bot.out.begin() + sent);
+		}
+
+		std::lock_guard lock{ worker.statsLock };
+		worker.stats.txBytes += sentBytes;
+		return true;
+	}
+
+	template<typename T>
+	void Append(Bot& bot, const T& packet)
+	{
+		const char* raw = reinterpret_cast<const char*>(&packet);
+		bot.out.insert(bot.out.end(), raw, raw + sizeof(T));
+	}
+
+	// move_time은 Server가 해석하지 않고 돌려주기만 하므로 us 단위로 사용 (71분마다 wrap, 차이는 unsigned로 계산)
+	unsigned int NowUs()
+	{
+		return static_cast<unsigned int>(std::chrono::duration_cast<std::chrono::microseconds>(
+			Clock::now().time_since_epoch()).count());
+	}
+
+	bool StartConnect(Worker& worker, Bot& bot)
+	{
+		bot.fd = socket(AF_INET, SOCK_STREAM, 0);
+		if (bot.fd < 0) {
+			return false;
+		}
+
+		int noDelay{ 1 };
+		setsockopt(bot.fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+		SetNonBlocking(bot.fd);
+
+		if ((connect(bot.fd, reinterpret_cast<const sockaddr*>(&g_serverAddr), sizeof(g_serverAddr)) != 0)
+			and (errno != EINPROGRESS)) {
+			close(bot.fd);
+			bot.fd = -1;
+			return false;
+		}
+
+		epoll_event ev{};
+		ev.events = EPOLLIN | EPOLLOUT | EPOLLET;
+		ev.data.u32 = static_cast<unsigned int>(bot.index);
+		epoll_ctl(worker.epollFd, EPOLL_CTL_ADD, bot.fd, &ev);
+
+		bot.state = BOT_CONNECTING;
+		return true;
+	}
+
+	// Non-Blocking Connect 완료 후 Login 전송
+	bool OnConnected(Worker& worker, Bot& bot)
+	{
+		int error{ 0 };
+		socklen_t len = sizeof(error);
+		if ((getsockopt(bot.fd, SOL_SOCKET, SO_ERROR, &error, &len) != 0) or (error != 0)) {
+			std::lock_guard lock{ worker.statsLock };
+			++worker.stats.connectFailed;
+			return false;
+		}
+
+		int userId = g_config.idBase + bot.index;
+
+		CS_LOGIN_PACKET login{};
+		login.size = sizeof(login);
+		login.type = CS_LOGIN;
+		login.id = userId;
+		std::snprintf(login.name, sizeof(login.name), "bot%d", userId);
+		Append(bot, login);
+
+		bot.state = BOT_LOGIN_SENT;
+		bot.loginSent = Clock::now();
+		worker.connected.fetch_add(1);
+
+		std::lock_guard lock{ worker.statsLock };
+		++worker.stats.sent[ACTION_LOGIN];
+		return true;
+	}
+
+	void RecordAck(Worker& worker, ActionType action, long long latencyUs)
+	{
+		std::lock_guard lock{ worker.statsLock };
+		++worker.stats.acked[action];
+		worker.stats.latency[action].Record(latencyUs);
+	}
+
+	void ProcessPacket(Worker& worker, Bot& bot, const char* packet)
+	{
+		switch (packet[1]) {
+		case SC_LOGIN_INFO: {
+			// Gateway 뒤에서는 Zone Handoff마다 새 Zone이 다시 보냄. Login 응답이 아니므로 다시 Teleport하지 않음
+			if (bot.state != BOT_LOGIN_SENT) {
+				break;
+			}
+
+			auto loginInfo = reinterpret_cast<const SC_LOGIN_INFO_PACKET*>(packet);
+			bot.userId = loginInfo->id;
+			bot.state = BOT_INGAME;
+			worker.inGame.fetch_add(1);
+			RecordAck(worker, ACTION_LOGIN, ToUs(Clock::now() - bot.loginSent));
+
+			// 기존 STRESS_TEST처럼 접속 직후 임의 위치로 흩어짐
+			if (g_config.teleport) {
+				CS_TELEPORT_PACKET teleport{};
+				teleport.size = sizeof(teleport);
+				teleport.type = CS_TELEPORT;
+				Append(bot, teleport);
+			}
+			break;
+		}
+
+		case SC_LOGIN_FAIL: {
+			{
+				std::lock_guard lock{ worker.statsLock };
+				++worker.stats.loginFailed;
+			}
+			CloseBot(worker, bot, false);
+			break;
+		}
+
+		case SC_MOVE_OBJECT: {
+			auto move = reinterpret_cast<const SC_MOVE_OBJECT_PACKET*>(packet);
+			// Teleport / 다른 Player의 Move는 move_time이 0이거나 다르므로 걸러짐
+			if ((move->id == bot.userId) and bot.hasPendingMove and (move->move_time == bot.pendingMoveTime)) {
+				bot.hasPendingMove = false;
+				RecordAck(worker, ACTION_MOVE, static_cast<long long>(NowUs() - move->move_time));
+			}
+			break;
+		}
+
+		case SC_CHAT: {
+			auto chat = reinterpret_cast<const SC_CHAT_PACKET*>(packet);
+			if ((chat->id == bot.userId) and bot.hasPendingChat) {
+				bot.hasPendingChat = false;
+				RecordAck(worker, ACTION_CHAT, ToUs(Clock::now() - bot.pendingChat));
+			}
+			break;
+		}
+
+		case SC_PARTY_REQUEST: {
+			CS_PARTY_RESPONSE_PACKET response{};
+			response.size = sizeof(response);
+			response.type = CS_PARTY_RESPONSE;
+			response.acceptFlag = false;
+			Append(bot, response);
+			break;
+		}
+
+		default:
+			break;
+		}
+	}
+
+	bool OnReadable(Worker& worker, Bot& bot)
+	{
+		// 1. Socket에서 읽을 수 있는 만큼 읽기 (Edge Trigger)
+		char buf[8192];
+		long long readBytes{ 0 };
+		while (true) {
+			ssize_t received = recv(bot.fd, buf, sizeof(buf), 0);
+			if (received > 0) {
+				bot.in.insert(bot.in.end(), buf, buf + received);
+				readBytes += received;
+				continue;
+			}
+
+			if (received == 0) {
+				return false;
+			}
+
+			if ((errno == EAGAIN) or (errno == EWOULDBLOCK)) {
+				break;
+			}
+			return false;
+		}
+
+		// 2. Packet 단위로 잘라서 처리
+		size_t offset{ 0 };
+		long long packets{ 0 };
+		while (bot.in.size() - offset >= 2) {
+			unsigned char size = static_cast<unsigned char>(bot.in[offset]);
+			if (size < 2) {
+				return false;
+			}
+			if (bot.in.size() - offset < size) {
+				break;
+			}
+
+			ProcessPacket(worker, bot, bot.in.data() + offset);
+			if (bot.state == BOT_CLOSED) {
+				return true;
+			}
+
+			offset += size;
+			++packets;
+		}
+		bot.in.erase(bot.in.begin(), bot.in.begin() + offset);
+
+		std::lock_guard lock{ worker.statsLock };
+		worker.stats.rxBytes += readBytes;
+		worker.stats.recvPackets += packets;
+		return true;
+	}
+
+	ActionType PickAction(std::mt19937& rng)
+	{
+		int total = g_config.mix[ACTION_MOVE] + g_config.mix[ACTION_ATTACK] + g_config.mix[ACTION_CHAT];
+		int roll = std::uniform_int_distribution<int>(0, std::max(total, 1) - 1)(rng);
+
+		if (roll < g_config.mix[ACTION_MOVE]) return ACTION_MOVE;
+		if (roll < g_config.mix[ACTION_MOVE] + g_config.mix[ACTION_ATTACK]) return ACTION_ATTACK;
+		return ACTION_CHAT;
+	}
+
+	void DoAction(Worker& worker, Bot& bot, std::mt19937& rng)
+	{
+		ActionType action = PickAction(rng);
+		auto now = Clock::now();
+		bool unacked{ false };
+
+		switch (action) {
+		case ACTION_MOVE: {
+			CS_MOVE_PACKET move{};
+			move.size = sizeof(move);
+			move.type = CS_MOVE;
+			move.direction = static_cast<char>(std::uniform_int_distribution<int>(0, 3)(rng));
+			move.move_time = NowUs();
+			if (0 == move.move_time) {
+				move.move_time = 1;
+			}
+			Append(bot, move);
+
+			unacked = bot.hasPendingMove;
+			bot.pendingMoveTime = move.move_time;
+			bot.hasPendingMove = true;
+			break;
+		}
+
+		case ACTION_ATTACK: {
+			// Attacker 본인에게는 응답이 없으므로 전송 수만 집계
+			CS_ATTACK_PACKET attack{};
+			attack.size = sizeof(attack);
+			attack.type = CS_ATTACK;
+			attack.attack_time = NowUs();
+			Append(bot, attack);
+			break;
+		}
+
+		case ACTION_CHAT: {
+			CS_CHAT_PACKET chat{};
+			chat.size = sizeof(chat);
+			chat.type = CS_CHAT;
+			std::snprintf(chat.message, sizeof(chat.message), "loadgen %d", bot.userId);
+			Append(bot, chat);
+
+			unacked = bot.hasPendingChat;
+			bot.pendingChat = now;
+			bot.hasPendingChat = true;
+			break;
+		}
+
+		default:
+			return;
+		}
+
+		std::lock_guard lock{ worker.statsLock };
+		++worker.stats.sent[action];
+		if (unacked) {
+			++worker.stats.unacked[action];
+		}
+	}
+
+	void WorkerThread(Worker& worker)
+	{
+		std::mt19937 rng{ static_cast<unsigned int>(worker.index * 7919 + 17) };
+		auto actionInterval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / g_config.rate));
+		std::uniform_real_distribution<double> jitter(0.0, 1.0 / g_config.rate);
+
+		size_t nextConnect{ 0 };
+		epoll_event events[256];
+
+		while (not g_stop.load()) {
+			// 1. Ramp 목표까지 이 Thread 몫의 Bot 접속
+			int target = GetRampTarget(ElapsedSeconds(Clock::now()));
+			while ((nextConnect < worker.bots.size()) and (worker.bots[nextConnect].index < target)) {
+				Bot& bot = worker.bots[nextConnect++];
+				if (not StartConnect(worker, bot)) {
+					std::lock_guard lock{ worker.statsLock };
+					++worker.stats.connectFailed;
+					bot.state = BOT_CLOSED;
+				}
+			}
+
+			// 2. Network Event 처리
+			int count = epoll_wait(worker.epollFd, events, 256, 1);
+			for (int i = 0; i < count; ++i) {
+				Bot& bot = worker.bots[events[i].data.u32 / g_config.threads];
+				if (bot.state == BOT_CLOSED) continue;
+
+				bool ok{ true };
+				if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+					ok = (bot.state == BOT_CONNECTING) ? OnConnected(worker, bot) : false;
+				}
+				else {
+					if ((bot.state == BOT_CONNECTING) and (events[i].events & EPOLLOUT)) {
+						ok = OnConnected(worker, bot);
+						bot.nextAction = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(jitter(rng)));
+					}
+					if (ok and (events[i].events & EPOLLIN)) {
+						ok = OnReadable(worker, bot);
+					}
+				}
+
+				if (ok and (bot.state != BOT_CLOSED)) {
+					ok = Flush(worker, bot);
+				}
+				if (not ok) {
+					CloseBot(worker, bot, true);
+				}
+			}
+
+			// 3. 행동 주기가 된 Bot마다 Action 전송
+			auto now = Clock::now();
+			for (Bot& bot : worker.bots) {
+				if ((bot.state != BOT_INGAME) or (bot.nextAction > now)) continue;
+
+				DoAction(worker, bot, rng);
+				bot.nextAction += actionInterval;
+				if (bot.nextAction < now) {
+					bot.nextAction = now + actionInterval;
+				}
+
+				if (not Flush(worker, bot)) {
+					CloseBot(worker, bot, true);
+				}
+			}
+		}
+
+		for (Bot& bot : worker.bots) {
+			if (bot.fd >= 0) {
+				CloseBot(worker, bot, false);
+			}
+		}
+	}
+
+	// {"type":"interval", ...} 또는 {"type":"summary", ...} 한 줄
+	void PrintReport(const char* type, double elapsed, double window, Stats& stats, int connected, int inGame)
+	{
+		std::string line;
+		char buf[256];
+
+		std::snprintf(buf, sizeof(buf), "{\"type\":\"%s\",\"elapsed\":%.3f,\"window\":%.3f,\"bots\":%d,\"connected\":%d,\"ingame\":%d,",
+			type, elapsed, window, g_config.bots, connected, inGame);
+		line += buf;
+
+		std::snprintf(buf, sizeof(buf), "\"recvPackets\":%lld,\"rxBytes\":%lld,\"txBytes\":%lld,\"connectFailed\":%lld,\"loginFailed\":%lld,\"disconnected\":%lld,\"actions\":{",
+			stats.recvPackets, stats.rxBytes, stats.txBytes, stats.connectFailed, stats.loginFailed, stats.disconnected);
+		line += buf;
+
+		// Latency 단위는 ms (해상도 us)
+		for (int i = 0; i < ACTION_COUNT; ++i) {
+			const auto& latency = stats.latency[i];
+
+			double perSecond = (window > 0.0) ? stats.sent[i] / window : 0.0;
+			std::snprintf(buf, sizeof(buf),
+				"%s\"%s\":{\"sent\":%lld,\"perSec\":%.1f,\"acked\":%lld,\"unacked\":%lld,\"mean\":%.3f,\"p50\":%.3f,\"p90\":%.3f,\"p99\":%.3f,\"p999\":%.3f,\"max\":%.3f}",
+				(i == 0) ? "" : ",", ACTION_NAMES[i], stats.sent[i], perSecond, stats.acked[i], stats.unacked[i],
+				latency.GetMean() / 1000.0, latency.GetValueAtPercentile(50.0) / 1000.0, latency.GetValueAtPercentile(90.0) / 1000.0,
+				latency.GetValueAtPercentile(99.0) / 1000.0, latency.GetValueAtPercentile(99.9) / 1000.0, latency.GetMax() / 1000.0);
+			line += buf;
+		}
+
+		line += "}}\n";
+		std::fwrite(line.data(), 1, line.size(), stdout);
+		std::fflush(stdout);
+	}
+
+	bool ParseMix(const char* text)
+	{
+		int mix[ACTION_COUNT]{};
+		std::string s{ text };
+		size_t pos{ 0 };
+
+		while (pos < s.size()) {
+			size_t comma = s.find(',', pos);
+			std::string item = s.substr(pos, (comma == std::string::npos) ? std::string::npos : comma - pos);
+			pos = (comma == std::string::npos) ? s.size() : comma + 1;
+
+			size_t eq = item.find('=');
+			if (eq == std::string::npos) return false;
+
+			std::string name = item.substr(0, eq);
+			int weight = std::atoi(item.c_str() + eq + 1);
+			if (weight < 0) return false;
+
+			if (name == "move") mix[ACTION_MOVE] = weight;
+			else if (name == "attack") mix[ACTION_ATTACK] = weight;
+			else if (name == "chat") mix[ACTION_CHAT] = weight;
+			else return false;
+		}
+
+		if (mix[ACTION_MOVE] + mix[ACTION_ATTACK] + mix[ACTION_CHAT] <= 0) return false;
+		std::copy(std::begin(mix), std::end(mix), std::begin(g_config.mix));
+		return true;
+	}
+
+	bool ParseRamp(const char* text)
+	{
+		if (0 == std::strcmp(text, "instant")) {
+			g_config.ramp = RAMP_INSTANT;
+			return true;
+		}
+
+		if (0 == std::strncmp(text, "linear:", 7)) {
+			g_config.ramp = RAMP_LINEAR;
+			g_config.rampSeconds = std::atof(text + 7);
+			return g_config.rampSeconds >= 0.0;
+		}
+
+		int count{ 0 };
+		double seconds{ 0.0 };
+		if (2 == std::sscanf(text, "step:%d:%lf", &count, &seconds)) {
+			g_config.ramp = RAMP_STEP;
+			g_config.stepCount = count;
+			g_config.rampSeconds = seconds;
+			return (count > 0) and (seconds > 0.0);
+		}
+
+		return false;
+	}
+
+	bool ParseArgs(int argc, char* argv[])
+	{
+		for (int i = 1; i < argc; ++i) {
+			std::string arg{ argv[i] };
+			if (arg == "--no-teleport") {
+				g_config.teleport = false;
+				continue;
+			}
+
+			if (i + 1 >= argc) return false;
+			const char* value = argv[++i];
+
+			if (arg == "--host") g_config.host = value;
+			else if (arg == "--port") g_config.port = std::atoi(value);
+			else if (arg == "--bots") g_config.bots = std::atoi(value);
+			else if (arg == "--threads") g_config.threads = std::atoi(value);
+			else if (arg == "--duration") g_config.duration = std::atof(value);
+			else if (arg == "--rate") g_config.rate = std::atof(value);
+			else if (arg == "--id-base") g_config.idBase = std::atoi(value);
+			else if (arg == "--interval") g_config.interval = std::atof(value);
+			else if (arg == "--hgrm") g_config.hgrmPrefix = value;
+			else if (arg == "--mix") { if (not ParseMix(value)) return false; }
+			else if (arg == "--ramp") { if (not ParseRamp(value)) return false; }
+			else return false;
+		}
+
+		return (g_config.bots > 0) and (g_config.threads > 0) and (g_config.rate > 0.0) and (g_config.interval > 0.0);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (not ParseArgs(argc, argv)) {
+		std::fprintf(stderr,
+			"usage : %s [--host 127.0.0.1] [--port %d] [--bots 1000] [--threads 4] [--duration 60]\n"
+			"          [--ramp instant | linear:<sec> | step:<count>:<sec>] [--rate <actions/sec per bot>]\n"
+			"          [--mix move=80,attack=15,chat=5] [--id-base 1] [--interval 1] [--no-teleport] [--hgrm <prefix>]\n",
+			argv[0], PORT_NUM);
+		return 1;
+	}
+
+	g_serverAddr.sin_family = AF_INET;
+	g_serverAddr.sin_port = htons(static_cast<unsigned short>(g_config.port));
+	if (inet_pton(AF_INET, g_config.host.c_str(), &g_serverAddr.sin_addr) != 1) {
+		std::fprintf(stderr, "invalid host %s\n", g_config.host.c_str());
+		return 1;
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+	signal(SIGINT, OnSignal);
+	signal(SIGTERM, OnSignal);
+
+	// 1. Bot i는 Worker (i % threads)가 담당, 접속 순서는 i 순서
+	g_config.threads = std::min(g_config.threads, g_config.bots);
+	std::vector<std::unique_ptr<Worker>> workers;
+	for (int t = 0; t < g_config.threads; ++t) {
+		auto worker = std::make_unique<Worker>();
+		worker->index = t;
+		worker->epollFd = epoll_create1(0);
+		for (int i = t; i < g_config.bots; i += g_config.threads) {
+			Bot bot;
+			bot.index = i;
+			worker->bots.push_back(std::move(bot));
+		}
+		workers.push_back(std::move(worker));
+	}
+
+	std::fprintf(stderr, "[LoadGen] %d bots on %d threads -> %s:%d for %.0fs\n",
+		g_config.bots, g_config.threads, g_config.host.c_str(), g_config.port, g_config.duration);
+
+	g_startTime = Clock::now();
+	for (auto& worker : workers) {
+		worker->thread = std::thread(WorkerThread, std::ref(*worker));
+	}
+
+	// 2. 주기마다 각 Worker의 Stats를 가져와서 출력, 전체 누적은 Summary로 출력
+	Stats total;
+	auto lastReport = g_startTime;
+	while (not g_stop.load()) {
+		std::this_thread::sleep_for(std::chrono::duration<double>(g_config.interval));
+
+		auto now = Clock::now();
+		double elapsed = ElapsedSeconds(now);
+		if (elapsed >= g_config.duration) {
+			g_stop.store(true);
+		}
+
+		Stats window;
+		int connected{ 0 };
+		int inGame{ 0 };
+		for (auto& worker : workers) {
+			Stats taken;
+			{
+				std::lock_guard lock{ worker->statsLock };
+				std::swap(taken, worker->stats);
+			}
+			window.Merge(taken);
+			connected += worker->connected.load();
+			inGame += worker->inGame.load();
+		}
+
+		total.Merge(window);
+		PrintReport("interval", elapsed, std::chrono::duration<double>(now - lastReport).count(), window, connected, inGame);
+		lastReport = now;
+	}
+
+	for (auto& worker : workers) {
+		worker->thread.join();
+		close(worker->epollFd);
+	}
+
+	PrintReport("summary", ElapsedSeconds(Clock::now()), ElapsedSeconds(lastReport), total, 0, 0);
+
+	// 3. 전체 구간의 Percentile 분포를 action별 파일로 저장
+	if (not g_config.hgrmPrefix.empty()) {
+		for (int i = 0; i < ACTION_COUNT; ++i) {
+			if (0 == total.latency[i].GetTotalCount()) continue;
+
+			std::string path = g_config.hgrmPrefix + "." + ACTION_NAMES[i] + ".hgrm";
+			FILE* file = std::fopen(path.c_str(), "w");
+			if (nullptr == file) {
+				std::fprintf(stderr, "cannot write %s\n", path.c_str());
+				continue;
+			}
+
+			total.latency[i].WritePercentiles(file);
+			std::fclose(file);
+		}
+	}
+	return 0;
+}
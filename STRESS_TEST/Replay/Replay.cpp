@@ -0,0 +1,395 @@
+// Packet Trace 재생기 (GameServer의 PacketRecorder가 기록한 파일을 Server에 다시 보냄)
+// trace의 Session(traceId)마다 연결 하나를 열고, 기록된 도착 시각에 맞춰 Packet을 그대로 전송
+// 받은 Packet은 수만 세고 버림. 진행 메시지는 stderr, 종료 시 stdout에 JSON 한 줄
+//
+// usage : replay --trace <file> [--host 127.0.0.1] [--port 4000] [--speed 1 | <N> | max]
+//                [--id-offset 0] [--linger 2]
+//   --speed     : 1 = 기록 속도, N = N배 빠르게, max = 대기 없이 최대 속도 (Session 안의 순서는 유지)
+//   --id-offset : CS_LOGIN의 id에 더할 값 (같은 Trace를 여러 번 동시에 재생할 때 중복 Login 방지)
+//   --linger    : 마지막 Packet 전송 후 응답을 더 받을 시간(초)
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../SERVER/ServerCore/protocol.h"
+#include "../../SERVER/ServerCore/PacketTrace.h"
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	enum ConnState : char
+	{
+		CONN_CONNECTING,
+		CONN_OPEN,
+		CONN_CLOSED
+	};
+
+	struct Config {
+		std::string	host{ "127.0.0.1" };
+		int			port{ PORT_NUM };
+		std::string	trace;
+		double		speed{ 1.0 };	// 0이면 max
+		int			idOffset{ 0 };
+		double		linger{ 2.0 };
+	};
+
+	// Trace 파일 안의 Packet 위치
+	struct TraceEntry {
+		unsigned long long	timeUs;
+		unsigned int		traceId;
+		size_t				offset;
+		unsigned short		size;
+	};
+
+	struct Connection {
+		int					fd{ -1 };
+		ConnState			state{ CONN_CONNECTING };
+		std::vector<char>	out;
+	};
+
+	struct Stats {
+		long long	sessions{ 0 };
+		long long	sentPackets{ 0 };
+		long long	txBytes{ 0 };
+		long long	rxBytes{ 0 };
+		long long	dropped{ 0 };
+		long long	connectFailed{ 0 };
+		long long	disconnected{ 0 };
+		long long	maxLagUs{ 0 };
+		long long	totalLagUs{ 0 };
+	};
+
+	Config					g_config;
+	std::atomic<bool>		g_stop{ false };
+	sockaddr_in				g_serverAddr{};
+
+	void OnSignal(int)
+	{
+		g_stop.store(true);
+	}
+
+	bool SetNonBlocking(int fd)
+	{
+		int flags = fcntl(fd, F_GETFL, 0);
+		return (flags >= 0) and (fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0);
+	}
+
+	// 1. Header 확인 후 record 목록을 도착 시각 순서로 정렬 (같은 시각은 기록 순서 유지)
+	bool LoadTrace(const std::string& path, std::vector<char>& data, std::vector<TraceEntry>& entries)
+	{
+		std::ifstream in{ path, std::ios::binary };
+		if (not in) {
+			std::fprintf(stderr, "cannot open %s\n", path.c_str());
+			return false;
+		}
+
+		data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+		PacketTraceHeader header{};
+		if ((data.size() < sizeof(header))
+			or (0 != std::memcmp(data.data(), PACKET_TRACE_MAGIC, sizeof(PACKET_TRACE_MAGIC)))) {
+			std::fprintf(stderr, "%s is not a packet trace\n", path.c_str());
+			return false;
+		}
+
+		std::memcpy(&header, data.data(), sizeof(header));
+		if (header.version != PACKET_TRACE_VERSION) {
+			std::fprintf(stderr, "unsupported trace version %u\n", header.version);
+			return false;
+		}
+
+		size_t offset = sizeof(header);
+		while (offset + sizeof(PacketTraceRecord) <= data.size()) {
+			PacketTraceRecord record;
+			std::memcpy(&record, data.data() + offset, sizeof(record));
+			offset += sizeof(record);
+
+			// 기록 중 종료로 잘린 마지막 record는 버림
+			if (offset + record.size > data.size()) {
+				break;
+			}
+
+			entries.push_back(TraceEntry{ record.timeUs, record.traceId, offset, record.size });
+			offset += record.size;
+		}
+
+		std::stable_sort(entries.begin(), entries.end(),
+			[](const TraceEntry& a, const TraceEntry& b) { return a.timeUs < b.timeUs; });
+		return true;
+	}
+
+	bool StartConnect(int epollFd, unsigned int traceId, Connection& conn)
+	{
+		conn.fd = socket(AF_INET, SOCK_STREAM, 0);
+		if (conn.fd < 0) {
+			return false;
+		}
+
+		int noDelay{ 1 };
+		setsockopt(conn.fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+		SetNonBlocking(conn.fd);
+
+		if ((connect(conn.fd, reinterpret_cast<const sockaddr*>(&g_serverAddr), sizeof(g_serverAddr)) != 0)
+			and (errno != EINPROGRESS)) {
+			close(conn.fd);
+			conn.fd = -1;
+			return false;
+		}
+
+		epoll_event ev{};
+		ev.events = EPOLLIN | EPOLLOUT | EPOLLET;
+		ev.data.u32 = traceId;
+		epoll_ctl(epollFd, EPOLL_CTL_ADD, conn.fd, &ev);
+
+		conn.state = CONN_CONNECTING;
+		return true;
+	}
+
+	void CloseConnection(int epollFd, Connection& conn)
+	{
+		if (conn.fd >= 0) {
+			epoll_ctl(epollFd, EPOLL_CTL_DEL, conn.fd, nullptr);
+			close(conn.fd);
+			conn.fd = -1;
+		}
+		conn.state = CONN_CLOSED;
+	}
+
+	bool Flush(Connection& conn, Stats& stats)
+	{
+		while (not conn.out.empty()) {
+			ssize_t sent = send(conn.fd, conn.out.data(), conn.out.size(), MSG_NOSIGNAL);
+			if (sent < 0) {
+				if ((errno == EAGAIN) or (errno == EWOULDBLOCK)) {
+					break;
+				}
+				return false;
+			}
+
+			stats.txBytes += sent;
+			conn.out.erase(conn.out.begin(), conn.out.begin() + sent);
+		}
+		return true;
+	}
+
+	bool Drain(Connection& conn, Stats& stats)
+	{
+		char buf[8192];
+		while (true) {
+			ssize_t received = recv(conn.fd, buf, sizeof(buf), 0);
+			if (received > 0) {
+				stats.rxBytes += received;
+				continue;
+			}
+
+			if (received == 0) {
+				return false;
+			}
+
+			return (errno == EAGAIN) or (errno == EWOULDBLOCK);
+		}
+	}
+
+	// Trace의 Packet 하나를 해당 Session 연결의 out에 추가. Login id는 id-offset만큼 옮김
+	void AppendEntry(Connection& conn, const std::vector<char>& data, const TraceEntry& entry)
+	{
+		size_t begin = conn.out.size();
+		conn.out.insert(conn.out.end(), data.begin() + entry.offset, data.begin() + entry.offset + entry.size);
+
+		if ((0 != g_config.idOffset) and (entry.size >= sizeof(CS_LOGIN_PACKET)) and (CS_LOGIN == conn.out[begin + 1])) {
+			CS_LOGIN_PACKET login;
+			std::memcpy(&login, conn.out.data() + begin, sizeof(login));
+			login.id += g_config.idOffset;
+			std::memcpy(conn.out.data() + begin, &login, sizeof(login));
+		}
+	}
+
+	bool ParseArgs(int argc, char* argv[])
+	{
+		for (int i = 1; i + 1 < argc; i += 2) {
+			std::string arg{ argv[i] };
+			const char* value = argv[i + 1];
+
+			if (arg == "--trace") g_config.trace = value;
+			else if (arg == "--host") g_config.host = value;
+			else if (arg == "--port") g_config.port = std::atoi(value);
+			else if (arg == "--id-offset") g_config.idOffset = std::atoi(value);
+			else if (arg == "--linger") g_config.linger = std::atof(value);
+			else if (arg == "--speed") {
+				g_config.speed = (0 == std::strcmp(value, "max")) ? 0.0 : std::atof(value);
+				if ((0 != std::strcmp(value, "max")) and (g_config.speed <= 0.0)) return false;
+			}
+			else return false;
+		}
+
+		return (argc % 2 == 1) and (not g_config.trace.empty()) and (g_config.linger >= 0.0);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (not ParseArgs(argc, argv)) {
+		std::fprintf(stderr,
+			"usage : %s --trace <file> [--host 127.0.0.1] [--port %d] [--speed 1 | <N> | max]\n"
+			"          [--id-offset 0] [--linger 2]\n",
+			argv[0], PORT_NUM);
+		return 1;
+	}
+
+	g_serverAddr.sin_family = AF_INET;
+	g_serverAddr.sin_port = htons(static_cast<unsigned short>(g_config.port));
+	if (inet_pton(AF_INET, g_config.host.c_str(), &g_serverAddr.sin_addr) != 1) {
+		std::fprintf(stderr, "invalid host %s\n", g_config.host.c_str());
+		return 1;
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+	signal(SIGINT, OnSignal);
+	signal(SIGTERM, OnSignal);
+
+	std::vector<char> data;
+	std::vector<TraceEntry> entries;
+	if (not LoadTrace(g_config.trace, data, entries)) {
+		return 1;
+	}
+
+	double traceSeconds = entries.empty() ? 0.0 : entries.back().timeUs / 1'000'000.0;
+	std::fprintf(stderr, "[Replay] %zu packets over %.1fs -> %s:%d (speed %s)\n",
+		entries.size(), traceSeconds, g_config.host.c_str(), g_config.port,
+		(0.0 == g_config.speed) ? "max" : std::to_string(g_config.speed).c_str());
+
+	int epollFd = epoll_create1(0);
+	std::unordered_map<unsigned int, Connection> connections;
+	Stats stats;
+
+	size_t next{ 0 };
+	epoll_event events[256];
+	auto startTime = Clock::now();
+	Clock::time_point lingerUntil{};
+
+	while (not g_stop.load()) {
+		auto now = Clock::now();
+		long long elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(now - startTime).count();
+
+		// 1. 예정 시각이 된 Packet 전송. max는 한 번에 일정량만 보내고 Network Event도 처리
+		size_t batchEnd = (0.0 == g_config.speed) ? std::min(entries.size(), next + 1024) : entries.size();
+		while (next < batchEnd) {
+			const TraceEntry& entry = entries[next];
+
+			long long dueUs = (0.0 == g_config.speed) ? 0 : static_cast<long long>(entry.timeUs / g_config.speed);
+			if (dueUs > elapsedUs) {
+				break;
+			}
+			++next;
+
+			auto [it, inserted] = connections.try_emplace(entry.traceId);
+			Connection& conn = it->second;
+			if (inserted) {
+				++stats.sessions;
+				if (not StartConnect(epollFd, entry.traceId, conn)) {
+					++stats.connectFailed;
+					conn.state = CONN_CLOSED;
+				}
+			}
+
+			if (CONN_CLOSED == conn.state) {
+				++stats.dropped;
+				continue;
+			}
+
+			AppendEntry(conn, data, entry);
+			++stats.sentPackets;
+
+			// 예정 시각보다 늦게 보낸 정도 (max는 예정 시각이 없으므로 제외)
+			if (0.0 != g_config.speed) {
+				long long lagUs = elapsedUs - dueUs;
+				stats.totalLagUs += lagUs;
+				stats.maxLagUs = std::max(stats.maxLagUs, lagUs);
+			}
+
+			if ((CONN_OPEN == conn.state) and (not Flush(conn, stats))) {
+				++stats.disconnected;
+				CloseConnection(epollFd, conn);
+			}
+		}
+
+		// 2. 모두 보냈으면 linger 동안 응답을 받고 종료
+		if (next >= entries.size()) {
+			if (Clock::time_point{} == lingerUntil) {
+				lingerUntil = now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(g_config.linger));
+			}
+			else if (now >= lingerUntil) {
+				break;
+			}
+		}
+
+		// 3. Network Event 처리
+		int count = epoll_wait(epollFd, events, 256, 1);
+		for (int i = 0; i < count; ++i) {
+			auto it = connections.find(events[i].data.u32);
+			if ((it == connections.end()) or (CONN_CLOSED == it->second.state)) continue;
+
+			Connection& conn = it->second;
+			bool ok{ true };
+
+			if (CONN_CONNECTING == conn.state) {
+				int error{ 0 };
+				socklen_t len = sizeof(error);
+				if ((getsockopt(conn.fd, SOL_SOCKET, SO_ERROR, &error, &len) != 0) or (error != 0)) {
+					++stats.connectFailed;
+					CloseConnection(epollFd, conn);
+					continue;
+				}
+				conn.state = CONN_OPEN;
+			}
+
+			if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+				ok = false;
+			}
+			if (ok and (events[i].events & EPOLLIN)) {
+				ok = Drain(conn, stats);
+			}
+			if (ok) {
+				ok = Flush(conn, stats);
+			}
+
+			if (not ok) {
+				++stats.disconnected;
+				CloseConnection(epollFd, conn);
+			}
+		}
+	}
+
+	for (auto& [traceId, conn] : connections) {
+		CloseConnection(epollFd, conn);
+	}
+	close(epollFd);
+
+	double elapsed = std::chrono::duration<double>(Clock::now() - startTime).count();
+	std::printf("{\"trace\":\"%s\",\"speed\":%.3f,\"traceSeconds\":%.3f,\"elapsed\":%.3f,\"sessions\":%lld,"
+		"\"packets\":%lld,\"txBytes\":%lld,\"rxBytes\":%lld,\"dropped\":%lld,\"connectFailed\":%lld,\"disconnected\":%lld,"
+		"\"lagMeanMs\":%.3f,\"lagMaxMs\":%.3f}\n",
+		g_config.trace.c_str(), g_config.speed, traceSeconds, elapsed, stats.sessions,
+		stats.sentPackets, stats.txBytes, stats.rxBytes, stats.dropped, stats.connectFailed, stats.disconnected,
+		(stats.sentPackets > 0) ? stats.totalLagUs / 1000.0 / stats.sentPackets : 0.0, stats.maxLagUs / 1000.0);
+	return 0;
+}
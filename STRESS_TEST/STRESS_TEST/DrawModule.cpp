@@ -515,7 +515,7 @@ int main()
 {
 	std::string line;
 	while (true) {
-		std::cout << " IP ּҸ Էϼ (⺻ 127.0.0.1): ";
+		std::cout << "서버 IP 주소를 입력하세요 (기본 127.0.0.1): ";
 		if (not std::getline(std::cin, line)) {
 			std::cin.clear();
 			std::cin.ignore((std::numeric_limits<std::streamsize>::max)(), '\n');
@@ -532,7 +532,7 @@ int main()
 			break;
 		}
 
-		std::cout << "ùٸ IPv4 (: 127.0.0.1) ƴմϴ. ٽ õϼ.\n";
+		std::cout << "올바른 IPv4 형식(예: 127.0.0.1)이 아닙니다. 다시 시도하세요.\n";
 	}
 
 	WinMain(0, 0, 0, 0);
@@ -65,14 +65,14 @@ atomic_int num_connections;
 atomic_int client_to_close;
 atomic_int active_clients;
 
-int			global_delay;				// ms, 1000  Ŭ̾Ʈ  
+int			global_delay;				// ms단위, 1000이 넘으면 클라이언트 증가 종료
 
 vector <thread*> worker_threads;
 thread test_thread;
 
 float point_cloud[MAX_TEST * 2];
 
-// ߿ NPC ߰ Ȯ 
+// 나중에 NPC까지 추가 확장 용
 struct ALIEN {
 	int id;
 	int x, y;
@@ -89,7 +89,7 @@ void error_display(const char* msg, int err_no)
 		MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
 		(LPTSTR)&lpMsgBuf, 0, NULL);
 	std::cout << msg;
-	std::wcout << L"" << lpMsgBuf << std::endl;
+	std::wcout << L"에러" << lpMsgBuf << std::endl;
 
 	MessageBox(hWnd, lpMsgBuf, L"ERROR", 0);
 	LocalFree(lpMsgBuf);
@@ -173,7 +173,7 @@ void ProcessPacket(int ci, unsigned char packet[])
 	}
 
 	case SC_PARTY_REQUEST: {
-		// ڵ  Ǵ  (50% Ȯ)
+		// 자동 수락 또는 거절 (50% 확률)
 		CS_PARTY_RESPONSE_PACKET rsp;
 		rsp.size = sizeof(rsp);
 		rsp.type = CS_PARTY_RESPONSE;
@@ -243,7 +243,7 @@ void Worker_Thread()
 			while (io_size > 0) {
 				if (0 == psize) psize = buf[0];
 				if (io_size + pr_size >= psize) {
-					//  Ŷ ϼ 
+					// 지금 패킷 완성 가능
 					unsigned char packet[MAX_PACKET_SIZE];
 					memcpy(packet, g_clients[ci].packet_buf, pr_size);
 					memcpy(packet + pr_size, buf, psize - pr_size);